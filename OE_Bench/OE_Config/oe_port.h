@@ -0,0 +1,148 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_PORT_H
+#define OE_PORT_H
+
+/**
+ * @brief This is the pthread port of the benchmarks. Unlike the port of the tests,
+ * a wakeup is remembered if the kernel is not idle yet. This way no wakeup is lost
+ * between checking the message queue and entering the idle state.
+ *
+ * The idle strategy can be switched at runtime to measure the cost of waking up
+ * a kernel. It must only be changed while no kernel thread runs.
+ */
+
+/* Include necessary headers. */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include "oe_config.h"
+
+typedef enum Bench_IdleStrategy_e
+{
+    /* Block on a condition variable. */
+    BENCH_IDLE_CONDVAR,
+    /* Busy wait for the wakeup. */
+    BENCH_IDLE_SPIN,
+    /* Give the CPU to other threads until the wakeup arrives. */
+    BENCH_IDLE_YIELD,
+    /* Busy wait for a while, then block on the condition variable. */
+    BENCH_IDLE_HYBRID,
+
+    BENCH_NUMBER_OF_IDLE_STRATEGIES
+} Bench_IdleStrategy_t;
+
+/* The number of busy wait rounds before the hybrid strategy blocks. */
+#define BENCH_HYBRID_SPINS 2000
+
+/* Idle strategy, mutexes, conds and wakeup flags, defined in bench.c. */
+extern Bench_IdleStrategy_t idle_strategy;
+extern pthread_mutex_t condition_mutexes[OE_NUMBER_OF_KERNELS];
+extern pthread_cond_t condition_conds[OE_NUMBER_OF_KERNELS];
+extern atomic_bool wakeup_pending[OE_NUMBER_OF_KERNELS];
+
+/* Mutex for critical sections. */
+extern pthread_mutex_t critical_section_mutex;
+
+/* No operation. May be omitted or optimizable. */
+#define OE_NOP()
+
+static inline void __CPU_RELAX(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ volatile("yield");
+#endif
+}
+
+static inline bool __TAKE_WAKEUP(uint8_t KernelID)
+{
+    return atomic_exchange_explicit(&wakeup_pending[KernelID], false, memory_order_acquire);
+}
+
+static inline void __IDLE(uint8_t KernelID)
+{
+    switch (idle_strategy)
+    {
+    case BENCH_IDLE_SPIN:
+        while (!__TAKE_WAKEUP(KernelID))
+        {
+            __CPU_RELAX();
+        }
+        return;
+
+    case BENCH_IDLE_YIELD:
+        while (!__TAKE_WAKEUP(KernelID))
+        {
+            sched_yield();
+        }
+        return;
+
+    case BENCH_IDLE_HYBRID:
+        for (int Spin = 0; Spin < BENCH_HYBRID_SPINS; Spin++)
+        {
+            if (__TAKE_WAKEUP(KernelID))
+            {
+                return;
+            }
+            __CPU_RELAX();
+        }
+        /* Fall through and block. */
+
+    default:
+        pthread_mutex_lock(&condition_mutexes[KernelID]);
+        while (!__TAKE_WAKEUP(KernelID))
+        {
+            pthread_cond_wait(&condition_conds[KernelID], &condition_mutexes[KernelID]); 
+        }
+        pthread_mutex_unlock(&condition_mutexes[KernelID]);
+        return;
+    }
+}
+
+/**
+ * Idle, e.g. some sort of low power mode. This operating mode
+ * MUST be interruptable by ISRs. If such an option is not available, define
+ * it as NOP().
+ *
+ * @param KernelID The ID of the kernel that calls this macro.
+ * Only needed when there are more than one kernels.
+ */
+#define OE_IDLE(KernelID) __IDLE(KernelID)
+
+static inline void __RESUME(uint8_t KernelID)
+{
+    atomic_store_explicit(&wakeup_pending[KernelID], true, memory_order_release);
+
+    if (idle_strategy == BENCH_IDLE_CONDVAR || idle_strategy == BENCH_IDLE_HYBRID)
+    {
+        /* Taking the mutex makes sure the kernel either sees the flag or is already waiting. */
+        pthread_mutex_lock(&condition_mutexes[KernelID]);
+        pthread_cond_signal(&condition_conds[KernelID]);
+        pthread_mutex_unlock(&condition_mutexes[KernelID]);
+    }
+}
+
+/**
+ * The kernel uses this macro to return from idle state.
+ * The given function should match the OE_IDLE() macro.
+ *
+ * @param KernelID The ID of the kernel that will leave the idle state.
+ * Only needed when there are more than one kernels.
+ */
+#define OE_RESUME(KernelID) __RESUME(KernelID)
+
+/* Enter a section of the programm that must not be interrupted. */
+#define OE_ENTER_CRITICAL() pthread_mutex_lock(&critical_section_mutex)
+
+/* Exit a section of the programm that must not be interrupted. */
+#define OE_EXIT_CRITICAL() pthread_mutex_unlock(&critical_section_mutex)
+
+#endif // OE_PORT_H
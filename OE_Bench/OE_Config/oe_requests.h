@@ -0,0 +1,27 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_REQUESTS_H
+#define OE_REQUESTS_H
+
+/**
+ * @brief The benchmarks do not use generated modules. They register their
+ * handlers directly with the kernels, so the request IDs are listed by hand.
+ */
+
+/* Define all requests by giving them a request ID. */
+typedef enum OE_RequestID_e
+{
+	/* Benchmarks */
+	RID_Bench_Request,
+	RID_Bench_Stop,
+	RID_Bench_Ping,
+
+	/* The LAST element in this enum MUST be "OE_NUMBER_OF_REQESTS"! */
+    OE_NUMBER_OF_REQUESTS
+} OE_RequestID_t;
+
+#endif // OE_REQUESTS_H
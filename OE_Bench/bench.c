@@ -0,0 +1,323 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+/* Needed for pthread_setaffinity_np(). */
+#define _GNU_SOURCE
+
+#include "bench.h"
+#include <time.h>
+#include <string.h>
+#include <sched.h>
+
+/* Port globals, see oe_port.h. */
+pthread_mutex_t critical_section_mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_mutex_t condition_mutexes[OE_NUMBER_OF_KERNELS] = {
+    [0 ... OE_NUMBER_OF_KERNELS - 1] = PTHREAD_MUTEX_INITIALIZER};
+pthread_cond_t condition_conds[OE_NUMBER_OF_KERNELS] = {
+    [0 ... OE_NUMBER_OF_KERNELS - 1] = PTHREAD_COND_INITIALIZER};
+atomic_bool wakeup_pending[OE_NUMBER_OF_KERNELS];
+Bench_IdleStrategy_t idle_strategy = BENCH_IDLE_CONDVAR;
+
+OE_Core_t Bench_Core;
+OE_Kernel_t Bench_Kernels[OE_NUMBER_OF_KERNELS];
+_Thread_local OE_KernelID_t Bench_CurrentKernel = OE_NO_KERNEL;
+
+static pthread_t KernelThreads[OE_NUMBER_OF_KERNELS];
+
+/* Cleared by the stop handler in the kernel thread. */
+static _Thread_local bool KernelRunning;
+
+/* State of the JSON output. */
+static FILE *Output;
+static bool FirstResult;
+static bool FirstValue;
+
+uint64_t Bench_now(void)
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (uint64_t)Time.tv_sec * 1000000000ull + (uint64_t)Time.tv_nsec;
+}
+
+OE_Error_t Bench_initCore(
+    size_t NumberOfKernels)
+{
+    OE_Error_t Error;
+
+#if OE_USE_FAST_BOOT
+    /* Each benchmark starts as after a reset. */
+    memset(&Bench_Core, 0, sizeof(Bench_Core));
+    memset(Bench_Kernels, 0, sizeof(Bench_Kernels));
+#endif // OE_USE_FAST_BOOT
+
+    initModule_OE_Core(&Bench_Core, NULL, NULL);
+
+    for (size_t KernelID = 0; KernelID < OE_NUMBER_OF_KERNELS; KernelID++)
+    {
+        atomic_store(&wakeup_pending[KernelID], false);
+    }
+
+    for (size_t KernelID = 0; KernelID < NumberOfKernels; KernelID++)
+    {
+        Error = OE_Kernel_staticInit(&Bench_Kernels[KernelID]);
+
+        if (Error != OE_ERROR_NONE)
+        {
+            return Error;
+        }
+    }
+
+    return OE_ERROR_NONE;
+}
+
+static void handleRequest_Bench_Stop(OE_MessageHeader_t *Header)
+{
+    (void)Header;
+
+    KernelRunning = false;
+}
+
+static void *Bench_kernelThread(void *Args)
+{
+    OE_Kernel_t *Kernel = Args;
+
+    Bench_CurrentKernel = Kernel->KernelID;
+    KernelRunning = true;
+
+    while (KernelRunning)
+    {
+        if (!OE_Kernel_runOnce(Kernel))
+        {
+            OE_IDLE(Kernel->KernelID);
+        }
+    }
+
+    Bench_CurrentKernel = OE_NO_KERNEL;
+
+    return NULL;
+}
+
+OE_Error_t Bench_startKernels(
+    size_t NumberOfKernels)
+{
+    OE_RequestID_t RequestID = RID_Bench_Stop;
+    OE_MessageHandler_t Handler = (OE_MessageHandler_t)handleRequest_Bench_Stop;
+    OE_Error_t Error;
+
+    for (size_t KernelID = 0; KernelID < NumberOfKernels; KernelID++)
+    {
+        Error = OE_Kernel_registerHandlers(
+            &Bench_Kernels[KernelID],
+            &RequestID,
+            &Handler,
+            1);
+
+        if (Error != OE_ERROR_NONE)
+        {
+            return Error;
+        }
+    }
+
+    for (size_t KernelID = 0; KernelID < NumberOfKernels; KernelID++)
+    {
+        if (pthread_create(&KernelThreads[KernelID], NULL, Bench_kernelThread, &Bench_Kernels[KernelID]) != 0)
+        {
+            return OE_ERROR_UNSPECIFIED;
+        }
+    }
+
+    return OE_ERROR_NONE;
+}
+
+void Bench_stopKernels(
+    size_t NumberOfKernels)
+{
+    OE_MessageHeader_t Header = OE_EMPTY_HEADER;
+
+    Header.RequestID = RID_Bench_Stop;
+
+    /* The queues might still be full, so retry until the request is queued everywhere. */
+    while (OE_Core_sendRequest(&Header, NULL) != OE_ERROR_NONE)
+    {
+        sched_yield();
+    }
+
+    for (size_t KernelID = 0; KernelID < NumberOfKernels; KernelID++)
+    {
+        pthread_join(KernelThreads[KernelID], NULL);
+    }
+}
+
+bool Bench_setAffinity(
+    size_t KernelID,
+    int Cpu)
+{
+    cpu_set_t CpuSet;
+
+    CPU_ZERO(&CpuSet);
+
+    if (Cpu < 0)
+    {
+        for (int Count = 0; Count < CPU_SETSIZE; Count++)
+        {
+            CPU_SET(Count, &CpuSet);
+        }
+    }
+    else
+    {
+        CPU_SET(Cpu, &CpuSet);
+    }
+
+    return pthread_setaffinity_np(KernelThreads[KernelID], sizeof(cpu_set_t), &CpuSet) == 0;
+}
+
+void Bench_Histogram_reset(Bench_Histogram_t *Histogram)
+{
+    memset(Histogram, 0, sizeof(Bench_Histogram_t));
+}
+
+static size_t Bench_Histogram_bucket(uint64_t Value)
+{
+    int Exponent;
+
+    if (Value < BENCH_HISTOGRAM_LINEAR)
+    {
+        return Value;
+    }
+
+    Exponent = 63 - __builtin_clzll(Value);
+
+    return BENCH_HISTOGRAM_LINEAR + (Exponent - 10) * 64 + ((Value >> (Exponent - 6)) & 63);
+}
+
+static uint64_t Bench_Histogram_value(size_t Bucket)
+{
+    size_t Exponent;
+
+    if (Bucket < BENCH_HISTOGRAM_LINEAR)
+    {
+        return Bucket;
+    }
+
+    Bucket -= BENCH_HISTOGRAM_LINEAR;
+    Exponent = Bucket / 64 + 10;
+
+    return (uint64_t)(64 + Bucket % 64) << (Exponent - 6);
+}
+
+void Bench_Histogram_add(Bench_Histogram_t *Histogram, uint64_t Value)
+{
+    Histogram->Counts[Bench_Histogram_bucket(Value)]++;
+    Histogram->Total++;
+
+    if (Value > Histogram->Max)
+    {
+        Histogram->Max = Value;
+    }
+}
+
+void Bench_Histogram_merge(Bench_Histogram_t *Destination, const Bench_Histogram_t *Source)
+{
+    for (size_t Bucket = 0; Bucket < BENCH_HISTOGRAM_BUCKETS; Bucket++)
+    {
+        Destination->Counts[Bucket] += Source->Counts[Bucket];
+    }
+
+    Destination->Total += Source->Total;
+
+    if (Source->Max > Destination->Max)
+    {
+        Destination->Max = Source->Max;
+    }
+}
+
+uint64_t Bench_Histogram_percentile(const Bench_Histogram_t *Histogram, double Percentile)
+{
+    uint64_t Rank = (uint64_t)(Percentile / 100.0 * Histogram->Total);
+    uint64_t Count = 0;
+
+    for (size_t Bucket = 0; Bucket < BENCH_HISTOGRAM_BUCKETS; Bucket++)
+    {
+        Count += Histogram->Counts[Bucket];
+
+        if (Count > Rank)
+        {
+            return Bench_Histogram_value(Bucket);
+        }
+    }
+
+    return Histogram->Max;
+}
+
+void Bench_addHistogram(const char *Prefix, const Bench_Histogram_t *Histogram)
+{
+    char Key[64];
+
+    snprintf(Key, sizeof(Key), "%s_p50_ns", Prefix);
+    Bench_addInteger(Key, Bench_Histogram_percentile(Histogram, 50.0));
+    snprintf(Key, sizeof(Key), "%s_p99_ns", Prefix);
+    Bench_addInteger(Key, Bench_Histogram_percentile(Histogram, 99.0));
+    snprintf(Key, sizeof(Key), "%s_p999_ns", Prefix);
+    Bench_addInteger(Key, Bench_Histogram_percentile(Histogram, 99.9));
+    snprintf(Key, sizeof(Key), "%s_max_ns", Prefix);
+    Bench_addInteger(Key, Histogram->Max);
+}
+
+void Bench_beginResults(FILE *File)
+{
+    Output = File;
+    FirstResult = true;
+
+    fprintf(Output, "[");
+}
+
+void Bench_endResults(void)
+{
+    fprintf(Output, "\n]\n");
+    fflush(Output);
+}
+
+void Bench_beginResult(const char *Benchmark)
+{
+    fprintf(Output, FirstResult ? "\n  {" : ",\n  {");
+    FirstResult = false;
+    FirstValue = true;
+
+    Bench_addString("benchmark", Benchmark);
+    Bench_addInteger("payload", OE_MESSAGE_DATA_SIZE);
+}
+
+static void Bench_addKey(const char *Key)
+{
+    fprintf(Output, FirstValue ? "\"%s\": " : ", \"%s\": ", Key);
+    FirstValue = false;
+}
+
+void Bench_addInteger(const char *Key, long long Value)
+{
+    Bench_addKey(Key);
+    fprintf(Output, "%lld", Value);
+}
+
+void Bench_addNumber(const char *Key, double Value)
+{
+    Bench_addKey(Key);
+    fprintf(Output, "%.6g", Value);
+}
+
+void Bench_addString(const char *Key, const char *Value)
+{
+    Bench_addKey(Key);
+    fprintf(Output, "\"%s\"", Value);
+}
+
+void Bench_endResult(void)
+{
+    fprintf(Output, "}");
+    fflush(Output);
+}
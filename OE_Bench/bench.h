@@ -0,0 +1,187 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/**
+ * @brief This file holds the helpers that are shared by all benchmarks:
+ * Timing, the setup of the core and kernels and the JSON output.
+ */
+
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+#include <stdio.h>
+
+/* The options given on the command line. */
+typedef struct Bench_Options_s
+{
+    /* Run shorter measurements, e.g. as a smoke test. */
+    bool Quick;
+
+    /* The minimum time one measurement runs. */
+    uint64_t MinTimeNs;
+
+} Bench_Options_t;
+
+/**
+ * Latencies are counted in a histogram. Values below 1024 ns have their own bucket,
+ * larger values are split into 64 buckets per power of two (error < 1.6 %).
+ */
+#define BENCH_HISTOGRAM_LINEAR 1024
+#define BENCH_HISTOGRAM_BUCKETS (BENCH_HISTOGRAM_LINEAR + (64 - 10) * 64)
+
+typedef struct Bench_Histogram_s
+{
+    uint64_t Counts[BENCH_HISTOGRAM_BUCKETS];
+    uint64_t Total;
+    uint64_t Max;
+
+} Bench_Histogram_t;
+
+/* A benchmark is a function that measures and writes its results. */
+typedef void (*Bench_Function_t)(const Bench_Options_t *Options);
+
+/* The core and the kernels used by the benchmarks. */
+extern OE_Core_t Bench_Core;
+extern OE_Kernel_t Bench_Kernels[OE_NUMBER_OF_KERNELS];
+
+/* The ID of the kernel that runs in the calling thread or OE_NO_KERNEL. */
+extern _Thread_local OE_KernelID_t Bench_CurrentKernel;
+
+/**
+ * @brief Get the time of a monotonic clock.
+ *
+ * @return uint64_t The time in nanoseconds.
+ */
+uint64_t Bench_now(void);
+
+/**
+ * @brief Initialize the core and connect a number of kernels.
+ *
+ * All handlers and messages of a previous benchmark are dropped.
+ *
+ * @param NumberOfKernels The number of kernels to connect.
+ * @return OE_Error_t An error is returned if
+ * - a kernel cannot be connected.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t Bench_initCore(
+    size_t NumberOfKernels);
+
+/**
+ * @brief Run the connected kernels in threads.
+ *
+ * Each kernel handles messages until it receives the request Bench_Stop.
+ * The handler for this request is registered by this function.
+ *
+ * @param NumberOfKernels The number of kernels to start.
+ * @return OE_Error_t An error is returned if
+ * - registering the stop handler fails.
+ * - a thread cannot be created.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t Bench_startKernels(
+    size_t NumberOfKernels);
+
+/**
+ * @brief Stop the kernels started with Bench_startKernels() and wait for them.
+ *
+ * @param NumberOfKernels The number of kernels that were started.
+ */
+void Bench_stopKernels(
+    size_t NumberOfKernels);
+
+/**
+ * @brief Pin the thread of a started kernel to a CPU.
+ *
+ * @param KernelID The ID of the kernel.
+ * @param Cpu The CPU to run on. If Cpu is negative, the kernel may run on all CPUs.
+ * @return bool Returns true if the affinity was set.
+ */
+bool Bench_setAffinity(
+    size_t KernelID,
+    int Cpu);
+
+/**
+ * @brief Reset a histogram.
+ */
+void Bench_Histogram_reset(Bench_Histogram_t *Histogram);
+
+/**
+ * @brief Count a value in a histogram.
+ *
+ * @param Histogram The histogram.
+ * @param Value The value in nanoseconds.
+ */
+void Bench_Histogram_add(Bench_Histogram_t *Histogram, uint64_t Value);
+
+/**
+ * @brief Add all values of one histogram to another.
+ */
+void Bench_Histogram_merge(Bench_Histogram_t *Destination, const Bench_Histogram_t *Source);
+
+/**
+ * @brief Get a percentile of the counted values.
+ *
+ * @param Histogram The histogram.
+ * @param Percentile The percentile between 0 and 100.
+ * @return uint64_t The lower bound of the bucket that holds the percentile.
+ */
+uint64_t Bench_Histogram_percentile(const Bench_Histogram_t *Histogram, double Percentile);
+
+/**
+ * @brief Add the usual percentiles of a histogram to the current result.
+ *
+ * @param Prefix The prefix of the keys, e.g. "enqueue" gives "enqueue_p50_ns".
+ */
+void Bench_addHistogram(const char *Prefix, const Bench_Histogram_t *Histogram);
+
+/**
+ * @brief Start the list of results.
+ *
+ * @param File The file the results are written to.
+ */
+void Bench_beginResults(FILE *File);
+
+/**
+ * @brief Finish the list of results.
+ */
+void Bench_endResults(void);
+
+/**
+ * @brief Start a new result.
+ *
+ * @param Benchmark The name of the benchmark that measured the result.
+ */
+void Bench_beginResult(const char *Benchmark);
+
+/**
+ * @brief Add an integer value to the current result.
+ */
+void Bench_addInteger(const char *Key, long long Value);
+
+/**
+ * @brief Add a floating point value to the current result.
+ */
+void Bench_addNumber(const char *Key, double Value);
+
+/**
+ * @brief Add a string to the current result.
+ */
+void Bench_addString(const char *Key, const char *Value);
+
+/**
+ * @brief Finish the current result.
+ */
+void Bench_endResult(void);
+
+/* Benchmarks */
+void Bench_throughput(const Bench_Options_t *Options);
+void Bench_scaling(const Bench_Options_t *Options);
+void Bench_pingPong(const Bench_Options_t *Options);
+
+#endif // BENCH_H
@@ -0,0 +1,229 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+/**
+ * @brief This benchmark measures the round trip time of a request and its response
+ * between two kernels. Kernel 0 sends Bench_Ping to kernel 1, kernel 1 responds and
+ * kernel 0 sends the next ping from the response handler. Each round trip wakes up
+ * both kernels once, so the results show the cost of OE_IDLE() and OE_RESUME().
+ *
+ * The round trips are measured for each idle strategy of the port, for different
+ * CPU pinnings of the kernel threads and with or without background load.
+ */
+
+#include "bench.h"
+#include <stdatomic.h>
+#include <string.h>
+#include <unistd.h>
+
+/* The first round trips are not counted. */
+#define WARMUP_ROUND_TRIPS 10
+
+typedef enum Pinning_e
+{
+    /* The scheduler places the kernels. */
+    PINNING_NONE,
+    /* Both kernels run on the same CPU. */
+    PINNING_SAME_CPU,
+    /* The kernels run on different CPUs. */
+    PINNING_SPLIT,
+
+    NUMBER_OF_PINNINGS
+} Pinning_t;
+
+static const char *IdleStrategyNames[BENCH_NUMBER_OF_IDLE_STRATEGIES] = {
+    [BENCH_IDLE_CONDVAR] = "condvar",
+    [BENCH_IDLE_SPIN] = "spin",
+    [BENCH_IDLE_YIELD] = "yield",
+    [BENCH_IDLE_HYBRID] = "hybrid",
+};
+
+static const char *PinningNames[NUMBER_OF_PINNINGS] = {
+    [PINNING_NONE] = "none",
+    [PINNING_SAME_CPU] = "same_cpu",
+    [PINNING_SPLIT] = "split",
+};
+
+/* State of the ping-pong, only used by kernel 0 after the first ping. */
+static Bench_Histogram_t RoundTrips;
+static uint64_t SendTime;
+static uint64_t Deadline;
+static uint64_t Count;
+static atomic_bool Done;
+
+/* Background load. */
+static atomic_bool LoadRunning;
+
+static void handleResponse_Bench_Ping(OE_MessageHeader_t *Header, uint8_t *Data);
+
+static OE_Error_t Bench_sendPing(void)
+{
+    OE_MessageHeader_t Header = {
+        .RequestID = RID_Bench_Ping,
+        .ResponseHandler = (OE_MessageHandler_t)handleResponse_Bench_Ping,
+        .KernelID = 0,
+    };
+    uint8_t Payload[OE_MESSAGE_DATA_SIZE] = {0};
+
+    SendTime = Bench_now();
+
+    return OE_Core_sendRequest(&Header, Payload);
+}
+
+static void handleRequest_Bench_Ping(OE_MessageHeader_t *Header, uint8_t *Data)
+{
+    /* Send the payload back. */
+    OE_Core_sendResponse(Header, Data);
+}
+
+static void handleResponse_Bench_Ping(OE_MessageHeader_t *Header, uint8_t *Data)
+{
+    uint64_t Now = Bench_now();
+
+    (void)Header;
+    (void)Data;
+
+    if (Count++ >= WARMUP_ROUND_TRIPS)
+    {
+        Bench_Histogram_add(&RoundTrips, Now - SendTime);
+    }
+
+    if (Now >= Deadline || Bench_sendPing() != OE_ERROR_NONE)
+    {
+        atomic_store(&Done, true);
+    }
+}
+
+static void *Bench_loadThread(void *Args)
+{
+    volatile uint64_t Spin = 0;
+
+    (void)Args;
+
+    while (atomic_load_explicit(&LoadRunning, memory_order_relaxed))
+    {
+        Spin++;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Measure one combination of idle strategy, pinning and load.
+ */
+static void Bench_pingPongRun(
+    const Bench_Options_t *Options,
+    Bench_IdleStrategy_t Strategy,
+    Pinning_t Pinning,
+    size_t LoadThreads)
+{
+    OE_RequestID_t RequestID = RID_Bench_Ping;
+    OE_MessageHandler_t Handler = (OE_MessageHandler_t)handleRequest_Bench_Ping;
+    pthread_t Load[OE_NUMBER_OF_KERNELS];
+    struct timespec Wait = {.tv_sec = 0, .tv_nsec = 1000000};
+    uint64_t Start;
+
+    if (Bench_initCore(2) != OE_ERROR_NONE)
+    {
+        return;
+    }
+
+    OE_Kernel_registerHandlers(
+        &Bench_Kernels[1],
+        &RequestID,
+        &Handler,
+        1);
+
+    idle_strategy = Strategy;
+
+    Bench_Histogram_reset(&RoundTrips);
+    Count = 0;
+    atomic_store(&Done, false);
+
+    atomic_store(&LoadRunning, true);
+    for (size_t Thread = 0; Thread < LoadThreads; Thread++)
+    {
+        pthread_create(&Load[Thread], NULL, Bench_loadThread, NULL);
+    }
+
+    if (Bench_startKernels(2) != OE_ERROR_NONE)
+    {
+        fprintf(stderr, "ping_pong: Starting the kernels failed.\n");
+        return;
+    }
+
+    if (Pinning == PINNING_SAME_CPU)
+    {
+        Bench_setAffinity(0, 0);
+        Bench_setAffinity(1, 0);
+    }
+    else if (Pinning == PINNING_SPLIT)
+    {
+        Bench_setAffinity(0, 0);
+        Bench_setAffinity(1, 1);
+    }
+
+    Start = Bench_now();
+    Deadline = Start + Options->MinTimeNs;
+
+    Bench_sendPing();
+
+    while (!atomic_load(&Done))
+    {
+        nanosleep(&Wait, NULL);
+    }
+
+    Bench_stopKernels(2);
+
+    atomic_store(&LoadRunning, false);
+    for (size_t Thread = 0; Thread < LoadThreads; Thread++)
+    {
+        pthread_join(Load[Thread], NULL);
+    }
+
+    idle_strategy = BENCH_IDLE_CONDVAR;
+
+    Bench_beginResult("ping_pong");
+    Bench_addString("idle", IdleStrategyNames[Strategy]);
+    Bench_addString("pinning", PinningNames[Pinning]);
+    Bench_addInteger("load_threads", LoadThreads);
+    Bench_addInteger("round_trips", RoundTrips.Total);
+    Bench_addNumber("seconds", (Bench_now() - Start) / 1e9);
+    Bench_addHistogram("rtt", &RoundTrips);
+    Bench_endResult();
+}
+
+void Bench_pingPong(const Bench_Options_t *Options)
+{
+    long Cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t Loads[] = {0, (size_t)(Cpus < OE_NUMBER_OF_KERNELS ? Cpus : OE_NUMBER_OF_KERNELS)};
+
+    for (Bench_IdleStrategy_t Strategy = 0; Strategy < BENCH_NUMBER_OF_IDLE_STRATEGIES; Strategy++)
+    {
+        for (Pinning_t Pinning = 0; Pinning < NUMBER_OF_PINNINGS; Pinning++)
+        {
+            if (Pinning == PINNING_SPLIT && Cpus < 2)
+            {
+                continue;
+            }
+
+            for (size_t Load = 0; Load < sizeof(Loads) / sizeof(size_t); Load++)
+            {
+                /* Two spinning kernels on one CPU only make progress when preempted. */
+                if (Strategy == BENCH_IDLE_SPIN && (Pinning == PINNING_SAME_CPU || Cpus < 2))
+                {
+                    continue;
+                }
+
+                Bench_pingPongRun(
+                    Options,
+                    Strategy,
+                    Pinning,
+                    Loads[Load]);
+            }
+        }
+    }
+}
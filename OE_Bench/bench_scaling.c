@@ -0,0 +1,210 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+/**
+ * @brief This benchmark measures how the core scales with the number of kernels,
+ * producer threads and subscribing kernels (fan-out). Every kernel runs in its own
+ * thread. The producers send requests as fast as possible and measure the time
+ * each OE_Core_sendRequest() call takes. This shows the cost of the global critical
+ * section and of the loops over all kernels in OE_Core_sendRequest().
+ */
+
+#include "bench.h"
+#include <stdatomic.h>
+#include <string.h>
+#include <sched.h>
+
+#define MAX_PRODUCERS 8
+
+static const size_t KernelCounts[] = {1, 2, 4, 8};
+static const size_t ProducerCounts[] = {1, 2, 4, 8};
+static const size_t FanOuts[] = {1, 2, 4, 8};
+
+/* Each kernel counts its handled messages in its own cache line. */
+static struct {
+    uint64_t Messages;
+    uint8_t Padding[64 - sizeof(uint64_t)];
+} Delivered[OE_NUMBER_OF_KERNELS];
+
+/* Each producer counts in its own histogram. */
+static struct Producer_s {
+    pthread_t Thread;
+    Bench_Histogram_t Enqueue;
+    uint64_t Sent;
+    uint64_t Rejected;
+} Producers[MAX_PRODUCERS];
+
+static atomic_bool ProducersRunning;
+
+static void handleRequest_Bench_Request(OE_MessageHeader_t *Header, uint8_t *Data)
+{
+    (void)Header;
+    (void)Data;
+
+    Delivered[Bench_CurrentKernel].Messages++;
+}
+
+static void *Bench_producerThread(void *Args)
+{
+    struct Producer_s *Producer = Args;
+    OE_MessageHeader_t Header = OE_EMPTY_HEADER;
+    uint8_t Payload[OE_MESSAGE_DATA_SIZE];
+    uint64_t Start, Stop;
+
+    memset(Payload, 0, sizeof(Payload));
+    Header.RequestID = RID_Bench_Request;
+
+    while (atomic_load_explicit(&ProducersRunning, memory_order_relaxed))
+    {
+        Start = Bench_now();
+
+        if (OE_Core_sendRequest(&Header, Payload) == OE_ERROR_NONE)
+        {
+            Stop = Bench_now();
+            Bench_Histogram_add(&Producer->Enqueue, Stop - Start);
+            Producer->Sent++;
+        }
+        else
+        {
+            /* The queue is full. Give the kernels some time. */
+            Producer->Rejected++;
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Measure one combination of kernels, producers and fan-out.
+ */
+static void Bench_scalingRun(
+    const Bench_Options_t *Options,
+    size_t NumberOfKernels,
+    size_t NumberOfProducers,
+    size_t FanOut)
+{
+    static Bench_Histogram_t Enqueue;
+    OE_RequestID_t RequestID = RID_Bench_Request;
+    OE_MessageHandler_t Handler = (OE_MessageHandler_t)handleRequest_Bench_Request;
+    uint64_t Sent = 0, Rejected = 0, Messages = 0;
+    uint64_t Start, Elapsed;
+    struct timespec Duration;
+
+    if (Bench_initCore(NumberOfKernels) != OE_ERROR_NONE)
+    {
+        return;
+    }
+
+    /* The first kernels subscribe the request. */
+    for (size_t KernelID = 0; KernelID < FanOut; KernelID++)
+    {
+        OE_Kernel_registerHandlers(
+            &Bench_Kernels[KernelID],
+            &RequestID,
+            &Handler,
+            1);
+    }
+
+    memset(Delivered, 0, sizeof(Delivered));
+    memset(Producers, 0, sizeof(Producers));
+
+    if (Bench_startKernels(NumberOfKernels) != OE_ERROR_NONE)
+    {
+        fprintf(stderr, "scaling: Starting %zu kernels failed.\n", NumberOfKernels);
+        return;
+    }
+
+    atomic_store(&ProducersRunning, true);
+    Start = Bench_now();
+
+    for (size_t Producer = 0; Producer < NumberOfProducers; Producer++)
+    {
+        pthread_create(&Producers[Producer].Thread, NULL, Bench_producerThread, &Producers[Producer]);
+    }
+
+    Duration.tv_sec = Options->MinTimeNs / 1000000000ull;
+    Duration.tv_nsec = Options->MinTimeNs % 1000000000ull;
+    nanosleep(&Duration, NULL);
+
+    atomic_store(&ProducersRunning, false);
+
+    for (size_t Producer = 0; Producer < NumberOfProducers; Producer++)
+    {
+        pthread_join(Producers[Producer].Thread, NULL);
+    }
+
+    /* The kernels handle all queued messages before they stop. */
+    Bench_stopKernels(NumberOfKernels);
+    Elapsed = Bench_now() - Start;
+
+    Bench_Histogram_reset(&Enqueue);
+
+    for (size_t Producer = 0; Producer < NumberOfProducers; Producer++)
+    {
+        Bench_Histogram_merge(&Enqueue, &Producers[Producer].Enqueue);
+        Sent += Producers[Producer].Sent;
+        Rejected += Producers[Producer].Rejected;
+    }
+
+    for (size_t KernelID = 0; KernelID < NumberOfKernels; KernelID++)
+    {
+        Messages += Delivered[KernelID].Messages;
+    }
+
+    if (Messages != Sent * FanOut)
+    {
+        fprintf(stderr, "scaling: Delivered %llu of %llu messages.\n",
+            (unsigned long long)Messages,
+            (unsigned long long)(Sent * FanOut));
+    }
+
+    Bench_beginResult("scaling");
+    Bench_addInteger("kernels", NumberOfKernels);
+    Bench_addInteger("producers", NumberOfProducers);
+    Bench_addInteger("fan_out", FanOut);
+    Bench_addInteger("requests", Sent);
+    Bench_addInteger("rejected", Rejected);
+    Bench_addInteger("delivered", Messages);
+    Bench_addNumber("seconds", Elapsed / 1e9);
+    Bench_addNumber("requests_per_second", Sent / (Elapsed / 1e9));
+    Bench_addNumber("delivered_per_second", Messages / (Elapsed / 1e9));
+    Bench_addHistogram("enqueue", &Enqueue);
+    Bench_endResult();
+}
+
+void Bench_scaling(const Bench_Options_t *Options)
+{
+    for (size_t Kernels = 0; Kernels < sizeof(KernelCounts) / sizeof(size_t); Kernels++)
+    {
+        if (KernelCounts[Kernels] > OE_NUMBER_OF_KERNELS)
+        {
+            continue;
+        }
+
+        for (size_t Producers = 0; Producers < sizeof(ProducerCounts) / sizeof(size_t); Producers++)
+        {
+            if (ProducerCounts[Producers] > MAX_PRODUCERS)
+            {
+                continue;
+            }
+
+            for (size_t FanOut = 0; FanOut < sizeof(FanOuts) / sizeof(size_t); FanOut++)
+            {
+                if (FanOuts[FanOut] > KernelCounts[Kernels])
+                {
+                    continue;
+                }
+
+                Bench_scalingRun(
+                    Options,
+                    KernelCounts[Kernels],
+                    ProducerCounts[Producers],
+                    FanOuts[FanOut]);
+            }
+        }
+    }
+}
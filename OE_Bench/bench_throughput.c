@@ -0,0 +1,169 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+/**
+ * @brief This benchmark measures the message path of a single kernel:
+ * OE_Core_sendRequest() fills the queue up to a given depth and
+ * OE_Kernel_runOnce() drains it again. The handler count and the queue depth
+ * are swept. Each combination is also run with OE_Core_sendRequests(), which
+ * sends the whole depth as one batch. The payload size is fixed at compile time.
+ */
+
+#include "bench.h"
+#include <string.h>
+
+/* The handled messages and payload bytes. Read to keep the handlers alive. */
+static volatile uint64_t HandledMessages;
+static volatile uint64_t PayloadSum;
+
+/* Each handler has to be a different function, otherwise it is only registered once. */
+#define BENCH_HANDLER(N) \
+    static void handleRequest_Bench_##N(OE_MessageHeader_t *Header, uint8_t *Data) \
+    { \
+        (void)Header; \
+        HandledMessages++; \
+        PayloadSum += Data[0]; \
+    }
+
+BENCH_HANDLER(0)  BENCH_HANDLER(1)  BENCH_HANDLER(2)  BENCH_HANDLER(3)
+BENCH_HANDLER(4)  BENCH_HANDLER(5)  BENCH_HANDLER(6)  BENCH_HANDLER(7)
+BENCH_HANDLER(8)  BENCH_HANDLER(9)  BENCH_HANDLER(10) BENCH_HANDLER(11)
+BENCH_HANDLER(12) BENCH_HANDLER(13) BENCH_HANDLER(14) BENCH_HANDLER(15)
+
+static OE_MessageHandler_t Handlers[] = {
+    (OE_MessageHandler_t)handleRequest_Bench_0,  (OE_MessageHandler_t)handleRequest_Bench_1,
+    (OE_MessageHandler_t)handleRequest_Bench_2,  (OE_MessageHandler_t)handleRequest_Bench_3,
+    (OE_MessageHandler_t)handleRequest_Bench_4,  (OE_MessageHandler_t)handleRequest_Bench_5,
+    (OE_MessageHandler_t)handleRequest_Bench_6,  (OE_MessageHandler_t)handleRequest_Bench_7,
+    (OE_MessageHandler_t)handleRequest_Bench_8,  (OE_MessageHandler_t)handleRequest_Bench_9,
+    (OE_MessageHandler_t)handleRequest_Bench_10, (OE_MessageHandler_t)handleRequest_Bench_11,
+    (OE_MessageHandler_t)handleRequest_Bench_12, (OE_MessageHandler_t)handleRequest_Bench_13,
+    (OE_MessageHandler_t)handleRequest_Bench_14, (OE_MessageHandler_t)handleRequest_Bench_15,
+};
+
+#define NUMBER_OF_HANDLERS (sizeof(Handlers) / sizeof(OE_MessageHandler_t))
+
+static const size_t HandlerCounts[] = {1, 2, 4, 8, 16};
+static const size_t QueueDepths[] = {1, 16, 256, OE_MESSAGE_QUEUE_LENGTH};
+
+/* The headers and parameters of a batch. */
+static OE_MessageHeader_t BatchHeaders[OE_MESSAGE_QUEUE_LENGTH];
+static const void *BatchParameters[OE_MESSAGE_QUEUE_LENGTH];
+
+/**
+ * @brief Measure one combination of handler count, queue depth and send function.
+ */
+static void Bench_throughputRun(
+    const Bench_Options_t *Options,
+    size_t NumberOfHandlers,
+    size_t QueueDepth,
+    bool Batch)
+{
+    OE_Kernel_t *Kernel = &Bench_Kernels[0];
+    OE_RequestID_t RequestIDs[NUMBER_OF_HANDLERS];
+    OE_MessageHeader_t Header = OE_EMPTY_HEADER;
+    uint8_t Payload[OE_MESSAGE_DATA_SIZE];
+    uint64_t Messages = 0;
+    uint64_t Start, Elapsed;
+    OE_Error_t Error;
+
+    memset(Payload, 1, sizeof(Payload));
+    Header.RequestID = RID_Bench_Request;
+
+    for (size_t Count = 0; Count < QueueDepth; Count++)
+    {
+        BatchHeaders[Count] = Header;
+        BatchParameters[Count] = Payload;
+    }
+
+    if (Bench_initCore(1) != OE_ERROR_NONE)
+    {
+        return;
+    }
+
+    for (size_t Count = 0; Count < NumberOfHandlers; Count++)
+    {
+        RequestIDs[Count] = RID_Bench_Request;
+    }
+
+    Error = OE_Kernel_registerHandlers(
+        Kernel,
+        RequestIDs,
+        Handlers,
+        NumberOfHandlers);
+
+    if (Error != OE_ERROR_NONE)
+    {
+        fprintf(stderr, "throughput: Registering %zu handlers failed (%d).\n", NumberOfHandlers, Error);
+        return;
+    }
+
+    HandledMessages = 0;
+    Start = Bench_now();
+
+    do
+    {
+        if (Batch)
+        {
+            OE_Core_sendRequests(BatchHeaders, BatchParameters, QueueDepth);
+        }
+        else
+        {
+            for (size_t Count = 0; Count < QueueDepth; Count++)
+            {
+                OE_Core_sendRequest(&Header, Payload);
+            }
+        }
+
+        while (OE_Kernel_runOnce(Kernel));
+
+        Messages += QueueDepth;
+        Elapsed = Bench_now() - Start;
+    } while (Elapsed < Options->MinTimeNs);
+
+    if (HandledMessages != Messages * NumberOfHandlers)
+    {
+        fprintf(stderr, "throughput: Handled %llu of %llu messages.\n",
+            (unsigned long long)HandledMessages,
+            (unsigned long long)(Messages * NumberOfHandlers));
+    }
+
+    Bench_beginResult("throughput");
+    Bench_addInteger("handlers", NumberOfHandlers);
+    Bench_addInteger("queue_depth", QueueDepth);
+    Bench_addString("send", Batch ? "batch" : "single");
+    Bench_addInteger("messages", Messages);
+    Bench_addNumber("seconds", Elapsed / 1e9);
+    Bench_addNumber("messages_per_second", Messages / (Elapsed / 1e9));
+    Bench_addNumber("ns_per_message", (double)Elapsed / Messages);
+    Bench_endResult();
+}
+
+void Bench_throughput(const Bench_Options_t *Options)
+{
+    for (size_t Handler = 0; Handler < sizeof(HandlerCounts) / sizeof(size_t); Handler++)
+    {
+        if (HandlerCounts[Handler] > OE_REQUEST_HANDLER_LIMIT)
+        {
+            continue;
+        }
+
+        for (size_t Depth = 0; Depth < sizeof(QueueDepths) / sizeof(size_t); Depth++)
+        {
+            Bench_throughputRun(
+                Options,
+                HandlerCounts[Handler],
+                QueueDepths[Depth],
+                false);
+
+            Bench_throughputRun(
+                Options,
+                HandlerCounts[Handler],
+                QueueDepths[Depth],
+                true);
+        }
+    }
+}
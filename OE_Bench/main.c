@@ -0,0 +1,102 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+/**
+ * @brief Benchmarks of the OpenEDOS Core.
+ *
+ * Usage: OE_Bench [-q] [-o <file>] [benchmark ...]
+ *
+ * -q         Quick run with short measurements.
+ * -o <file>  Write the JSON results to a file instead of stdout.
+ *
+ * If no benchmark is named, all benchmarks are run.
+ */
+
+#include "bench.h"
+#include <string.h>
+
+#define BENCH_MIN_TIME_NS       200000000ull // 200 ms
+#define BENCH_QUICK_MIN_TIME_NS  10000000ull //  10 ms
+
+static const struct {
+    const char *Name;
+    Bench_Function_t Function;
+} Benchmarks[] = {
+    {"throughput", Bench_throughput},
+    {"scaling", Bench_scaling},
+    {"ping_pong", Bench_pingPong},
+};
+
+#define NUMBER_OF_BENCHMARKS (sizeof(Benchmarks) / sizeof(Benchmarks[0]))
+
+int main(int argc, char *argv[])
+{
+    Bench_Options_t Options = {
+        .Quick = false,
+        .MinTimeNs = BENCH_MIN_TIME_NS,
+    };
+    bool Selected[NUMBER_OF_BENCHMARKS] = {false};
+    bool AnySelected = false;
+    FILE *File = stdout;
+
+    for (int Arg = 1; Arg < argc; Arg++)
+    {
+        if (strcmp(argv[Arg], "-q") == 0)
+        {
+            Options.Quick = true;
+            Options.MinTimeNs = BENCH_QUICK_MIN_TIME_NS;
+        }
+        else if (strcmp(argv[Arg], "-o") == 0 && Arg + 1 < argc)
+        {
+            File = fopen(argv[++Arg], "w");
+
+            if (File == NULL)
+            {
+                perror(argv[Arg]);
+                return 1;
+            }
+        }
+        else
+        {
+            size_t Bench;
+
+            for (Bench = 0; Bench < NUMBER_OF_BENCHMARKS; Bench++)
+            {
+                if (strcmp(argv[Arg], Benchmarks[Bench].Name) == 0)
+                {
+                    Selected[Bench] = true;
+                    AnySelected = true;
+                    break;
+                }
+            }
+
+            if (Bench == NUMBER_OF_BENCHMARKS)
+            {
+                fprintf(stderr, "Unknown benchmark: %s\n", argv[Arg]);
+                return 1;
+            }
+        }
+    }
+
+    Bench_beginResults(File);
+
+    for (size_t Bench = 0; Bench < NUMBER_OF_BENCHMARKS; Bench++)
+    {
+        if (!AnySelected || Selected[Bench])
+        {
+            Benchmarks[Bench].Function(&Options);
+        }
+    }
+
+    Bench_endResults();
+
+    if (File != stdout)
+    {
+        fclose(File);
+    }
+
+    return 0;
+}
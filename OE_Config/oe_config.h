@@ -43,6 +43,54 @@
  */
 #define OE_REQUEST_LIMIT 0
 
+/**
+ * If this macro is set to 1, requests can be rate limited. Each request with a rate
+ * limit in its attributes (see oe_requests.h) owns a token bucket that is refilled
+ * periodically. The port has to provide the tick counter OE_GET_TICKS().
+ */
+#define OE_USE_RATE_LIMIT 0
+
+/**
+ * If this macro is set to 1, each request can have an overload policy (see oe_requests.h).
+ * Instead of being rejected when a message queue is full, a request may then drop or
+ * overwrite a queued message of the same request, or wait for room. The port has to
+ * provide the tick counter OE_GET_TICKS() and should provide OE_YIELD().
+ */
+#define OE_USE_OVERLOAD_POLICY 0
+
+/**
+ * If this macro is set to 1, requests can be coalesced (see oe_requests.h). A new request
+ * then overwrites the parameters of a queued request of the same type and key instead
+ * of taking another slot in the message queue.
+ */
+#define OE_USE_COALESCING 0
+
+/**
+ * If this macro is set to 1, requests can be sharded by a key (see oe_requests.h). A sharded
+ * request is only sent to one of the subscribing kernels, which is chosen by the hash of its key.
+ */
+#define OE_USE_SHARDING 0
+
+/**
+ * If this macro is set to 1, message handlers can be registered with a request filter
+ * (see OE_Kernel_registerFilteredHandlers()). The core checks the filters before a request
+ * is queued, so a kernel only receives the requests that one of its handlers wants.
+ */
+#define OE_USE_REQUEST_FILTERS 0
+
+/**
+ * If this macro is set to 1, ISRs can send requests with OE_Core_sendRequestFromISR().
+ * Each ISR source owns a lock-free staging ring, so no critical section is entered in
+ * the ISR. The kernels merge the staged requests into their message queues.
+ */
+#define OE_USE_ISR_SEND 0
+
+/* The number of ISR sources. Each source needs its own staging ring. */
+#define OE_NUMBER_OF_ISR_SOURCES 1
+
+/* The number of requests that can be staged by one ISR source. */
+#define OE_STAGING_RING_LENGTH 8
+
 /**
  * If this macro is set to 1, the OpenEDOS Core will send requests
  * related to the system. For example, if a kernel enters its main routine,
@@ -50,4 +98,105 @@
  */
 #define OE_USE_SYSTEM_REQUESTS 1
 
+/**
+ * If this macro is set to 1, the core counts the messages sent between the kernels
+ * for each request. The statistics can be exported at runtime and turned into a
+ * flow graph with the Systembuilder command "export-flow-graph".
+ */
+#define OE_USE_MESSAGE_STATISTICS 0
+
+/**
+ * If this macro is set to 1, the core can be placed in shared memory, so that kernels
+ * of different processes can communicate. See oe_shared_core.h. The port has to
+ * provide a critical section that works across processes.
+ */
+#define OE_USE_SHARED_CORE 0
+
+#if OE_USE_SHARED_CORE
+/* The number of different response handlers a process can use in requests. */
+#define OE_RESPONSE_HANDLER_LIMIT 16
+#endif
+
+/**
+ * If this macro is set to 1, bridges can forward requests to other nodes over TCP or
+ * UDP and route the responses back. See oe_bridge.h.
+ */
+#define OE_USE_BRIDGE 0
+
+#if OE_USE_BRIDGE
+/* The number of bridges that can be open at a time. */
+#define OE_NUMBER_OF_BRIDGES 2
+
+/* The number of messages a bridge batches into one frame. */
+#define OE_BRIDGE_BATCH_LIMIT 8
+
+/* The number of forwarded requests a bridge keeps to route the responses back. */
+#define OE_BRIDGE_PENDING_LIMIT 16
+#endif
+
+/**
+ * If this macro is set to 1, the generated interfaces can encode request and response
+ * parameters in a compact wire format that does not depend on the compiler. Bridges
+ * use it for requests that have codecs. See oe_wire.h.
+ */
+#define OE_USE_WIRE_FORMAT 0
+
+/**
+ * If this macro is set to 1, each kernel owns an epoll instance and an eventfd (Linux
+ * only). The port can let the kernels idle in OE_Epoll_idle() and resume them with
+ * OE_Epoll_resume(). Modules can register file descriptors whose readiness is sent
+ * as a request to their kernel. See oe_epoll.h. The eventfds belong to one process,
+ * so this cannot be combined with OE_USE_SHARED_CORE.
+ */
+#define OE_USE_EPOLL 0
+
+/**
+ * If this macro is set to 1, modules can hand file and socket I/O to an io_uring
+ * instance and respond to the requests when the I/O completes (Linux only).
+ * See oe_async_io.h.
+ */
+#define OE_USE_ASYNC_IO 0
+
+#if OE_USE_ASYNC_IO
+/* The number of operations that an io_uring instance can have in flight. */
+#define OE_ASYNC_IO_QUEUE_LENGTH 32
+#endif
+
+/**
+ * If this macro is set to 1, request handlers can run as coroutines that await
+ * responses. Requests carry the tag of the await that sent them. See oe_coroutine.h.
+ */
+#define OE_USE_COROUTINES 0
+
+/**
+ * If this macro is set to 1, the core owns a pool of fixed size blocks for payloads
+ * that do not fit into the message data. A request can carry a block, which is freed
+ * after the last receiving kernel has handled the request. See oe_message_pool.h.
+ */
+#define OE_USE_MESSAGE_POOL 0
+
+#if OE_USE_MESSAGE_POOL
+/* The size classes of the pool, smallest first: CLASS(block size in bytes, number of blocks). */
+#define OE_MESSAGE_POOL_CLASSES(CLASS) \
+    CLASS(64, 8)                       \
+    CLASS(256, 4)                      \
+    CLASS(1024, 2)
+#endif
+
+/**
+ * If this macro is set to 1, requests that are marked as persistent in their config can
+ * be appended to a journal, a memory-mapped log file (POSIX only). The journal sends the
+ * logged requests again on startup. See oe_journal.h.
+ */
+#define OE_USE_JOURNAL 0
+
+/**
+ * If this macro is set to 1, the core and the kernels have to be in zero-initialized static
+ * storage (.bss), as in the generated main.c. Their init functions then skip clearing the
+ * message queues, the subscriptions and the request maps, so the boot time does not grow
+ * with the queue length, the number of kernels and the number of requests. A core or
+ * kernel that was used before has to be zeroed before it is initialized again.
+ */
+#define OE_USE_FAST_BOOT 0
+
 #endif // OE_CONFIG_H
\ No newline at end of file
@@ -21,7 +21,7 @@
 /**
  * Idle, e.g. some sort of low power mode. This operating mode
  * MUST be interruptable by ISRs. If such an option is not available, define
- * it as NOP().
+ * it as NOP(). On Linux, OE_Epoll_idle() can be used (see oe_epoll.h).
  *
  * @param KernelID The ID of the kernel that calls this macro.
  * Only needed when there are more than one kernels.
@@ -43,4 +43,28 @@
 /* Exit a section of the programm that must not be interrupted. */
 #define OE_EXIT_CRITICAL() 
 
+/**
+ * Return the current value of a free running tick counter, e.g. the system tick.
+ * The counter may wrap around at 2^32. Needed if OE_USE_RATE_LIMIT, OE_USE_OVERLOAD_POLICY,
+ * OE_USE_BRIDGE or OE_USE_JOURNAL is set to 1. Uncomment the definition below and let it
+ * return the counter of your platform. A constant value would freeze all timeouts.
+ */
+// #define OE_GET_TICKS()
+
+/**
+ * Return the ID of the kernel the caller runs in, e.g. from a thread local variable
+ * that each kernel thread sets, or OE_NO_KERNEL outside of the kernels (ISRs, other
+ * threads). Needed if OE_USE_OVERLOAD_POLICY is set to 1, so that a kernel never waits
+ * for room in its own message queue. The message statistics use it as well. Uncomment
+ * the definition below and let it return the ID of the kernel. Do not return OE_NO_KERNEL
+ * for the kernels, or a kernel may wait for itself forever.
+ */
+// #define OE_CURRENT_KERNEL()
+
+/**
+ * Let other threads run, e.g. a task yield of the RTOS. A thread that waits for room
+ * in a message queue calls this macro. Only needed if OE_USE_OVERLOAD_POLICY is set to 1.
+ */
+#define OE_YIELD() 
+
 #endif // OE_PORT_H
\ No newline at end of file
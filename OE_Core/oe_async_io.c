@@ -0,0 +1,345 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#include "oe_async_io.h"
+
+#if OE_USE_ASYNC_IO
+#include "oe_core_mod.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+
+/* The rings are shared with the kernel, so their indexes are accessed atomically. */
+#define OE_ASYNC_IO_LOAD(Index) __atomic_load_n(Index, __ATOMIC_ACQUIRE)
+#define OE_ASYNC_IO_STORE(Index, Value) __atomic_store_n(Index, Value, __ATOMIC_RELEASE)
+
+/* The io_uring opcodes by OE_AsyncIOOpcode_t. */
+static const uint8_t OE_AsyncIO_opcodes[] = {
+    [OE_ASYNC_IO_READ] = IORING_OP_READ,
+    [OE_ASYNC_IO_WRITE] = IORING_OP_WRITE,
+    [OE_ASYNC_IO_FSYNC] = IORING_OP_FSYNC,
+    [OE_ASYNC_IO_ACCEPT] = IORING_OP_ACCEPT,
+    [OE_ASYNC_IO_RECV] = IORING_OP_RECV,
+    [OE_ASYNC_IO_SEND] = IORING_OP_SEND,
+};
+
+/**
+ * @brief Map the rings of an io_uring instance.
+ *
+ * @param AsyncIO Pointer to the instance.
+ * @param Params Pointer to the params that io_uring_setup() returned.
+ * @return OE_Error_t An error is returned if
+ * - a ring cannot be mapped.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static OE_Error_t OE_AsyncIO_map(
+    OE_AsyncIO_t *AsyncIO,
+    const struct io_uring_params *Params);
+
+OE_Error_t OE_AsyncIO_open(
+    OE_AsyncIO_t *AsyncIO)
+{
+    struct io_uring_params Params;
+
+    memset(AsyncIO, 0, sizeof(OE_AsyncIO_t));
+    memset(&Params, 0, sizeof(Params));
+
+    AsyncIO->RingFile = (int)syscall(__NR_io_uring_setup, OE_ASYNC_IO_QUEUE_LENGTH, &Params);
+
+    if (AsyncIO->RingFile < 0)
+    {
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    AsyncIO->EventFile = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (AsyncIO->EventFile < 0)
+    {
+        close(AsyncIO->RingFile);
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    /* The open flag lets OE_AsyncIO_close() clean up from here on. */
+    AsyncIO->Open = true;
+
+    if (OE_AsyncIO_map(AsyncIO, &Params) != OE_ERROR_NONE ||
+        syscall(__NR_io_uring_register, AsyncIO->RingFile, IORING_REGISTER_EVENTFD,
+                &(AsyncIO->EventFile), 1) != 0)
+    {
+        OE_AsyncIO_close(AsyncIO);
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    for (uint16_t Slot = 0; Slot < OE_ASYNC_IO_QUEUE_LENGTH; Slot++)
+    {
+        AsyncIO->FreeSlots[Slot] = OE_ASYNC_IO_QUEUE_LENGTH - 1 - Slot;
+    }
+
+    AsyncIO->NumberOfFreeSlots = OE_ASYNC_IO_QUEUE_LENGTH;
+
+    return OE_ERROR_NONE;
+}
+
+void OE_AsyncIO_close(
+    OE_AsyncIO_t *AsyncIO)
+{
+    if (!AsyncIO->Open)
+    {
+        return;
+    }
+
+    if (AsyncIO->Entries != NULL)
+    {
+        munmap(AsyncIO->Entries, AsyncIO->EntriesSize);
+    }
+
+    if (AsyncIO->CompletionRing != NULL && AsyncIO->CompletionRing != AsyncIO->SubmissionRing)
+    {
+        munmap(AsyncIO->CompletionRing, AsyncIO->CompletionRingSize);
+    }
+
+    if (AsyncIO->SubmissionRing != NULL)
+    {
+        munmap(AsyncIO->SubmissionRing, AsyncIO->SubmissionRingSize);
+    }
+
+    /* Closing the instance cancels the operations in flight. */
+    close(AsyncIO->RingFile);
+    close(AsyncIO->EventFile);
+
+    AsyncIO->Entries = NULL;
+    AsyncIO->CompletionRing = NULL;
+    AsyncIO->SubmissionRing = NULL;
+    AsyncIO->RingFile = -1;
+    AsyncIO->EventFile = -1;
+    AsyncIO->Open = false;
+}
+
+int OE_AsyncIO_getFile(
+    const OE_AsyncIO_t *AsyncIO)
+{
+    return AsyncIO->Open ? AsyncIO->EventFile : -1;
+}
+
+OE_Error_t OE_AsyncIO_submit(
+    OE_AsyncIO_t *AsyncIO,
+    const OE_MessageHeader_t *Header,
+    const OE_AsyncIOOperation_t *Operation)
+{
+    struct io_uring_sqe *Entry;
+    uint32_t Tail;
+    uint16_t Slot;
+
+    if (!AsyncIO->Open ||
+        (size_t)Operation->Opcode >= sizeof(OE_AsyncIO_opcodes) / sizeof(OE_AsyncIO_opcodes[0]))
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    /* Each operation in flight holds a slot, so the rings never overflow. */
+    if (AsyncIO->NumberOfFreeSlots == 0)
+    {
+        return OE_ERROR_REQUEST_LIMIT_REACHED;
+    }
+
+    Slot = AsyncIO->FreeSlots[--AsyncIO->NumberOfFreeSlots];
+    AsyncIO->Headers[Slot] = *Header;
+
+    /* Only this thread writes the tail, the kernel moves the head. */
+    Tail = *(AsyncIO->SubmissionTail);
+    Entry = &(AsyncIO->Entries[Tail & AsyncIO->SubmissionMask]);
+
+    memset(Entry, 0, sizeof(struct io_uring_sqe));
+    Entry->opcode = OE_AsyncIO_opcodes[Operation->Opcode];
+    Entry->fd = Operation->File;
+    Entry->user_data = Slot;
+
+    switch (Operation->Opcode)
+    {
+    case OE_ASYNC_IO_READ:
+    case OE_ASYNC_IO_WRITE:
+        Entry->off = (uint64_t)Operation->Offset;
+        /* fall through */
+    case OE_ASYNC_IO_RECV:
+    case OE_ASYNC_IO_SEND:
+        Entry->addr = (uint64_t)(uintptr_t)Operation->Buffer;
+        Entry->len = Operation->Length;
+        break;
+    case OE_ASYNC_IO_ACCEPT:
+        Entry->accept_flags = SOCK_CLOEXEC;
+        break;
+    default:
+        break;
+    }
+
+    AsyncIO->SubmissionArray[Tail & AsyncIO->SubmissionMask] = Tail & AsyncIO->SubmissionMask;
+    OE_ASYNC_IO_STORE(AsyncIO->SubmissionTail, Tail + 1);
+
+    AsyncIO->Pending++;
+
+    return OE_ERROR_NONE;
+}
+
+OE_Error_t OE_AsyncIO_flush(
+    OE_AsyncIO_t *AsyncIO)
+{
+    long Submitted;
+
+    if (!AsyncIO->Open)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    while (AsyncIO->Pending > 0)
+    {
+        Submitted = syscall(__NR_io_uring_enter, AsyncIO->RingFile, AsyncIO->Pending, 0, 0, NULL, 0);
+
+        if (Submitted < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return OE_ERROR_UNSPECIFIED;
+        }
+
+        AsyncIO->Pending -= (uint32_t)Submitted;
+    }
+
+    return OE_ERROR_NONE;
+}
+
+size_t OE_AsyncIO_complete(
+    OE_AsyncIO_t *AsyncIO)
+{
+    struct io_uring_cqe *Completion;
+    uint32_t Head;
+    uint64_t Count;
+    uint16_t Slot;
+    OE_Error_t Error;
+    bool Retry = false;
+    size_t NumberOfCompletions = 0;
+
+    if (!AsyncIO->Open)
+    {
+        return 0;
+    }
+
+    OE_AsyncIO_flush(AsyncIO);
+
+    /* Reading resets the eventfd. Completions after this read signal it again. */
+    while (read(AsyncIO->EventFile, &Count, sizeof(Count)) < 0 && errno == EINTR);
+
+    Head = *(AsyncIO->CompletionHead);
+
+    while (Head != OE_ASYNC_IO_LOAD(AsyncIO->CompletionTail))
+    {
+        Completion = &(AsyncIO->Completions[Head & AsyncIO->CompletionMask]);
+        Slot = (uint16_t)Completion->user_data;
+
+        Error = OE_Core_sendResponse(
+            &(AsyncIO->Headers[Slot]),
+            &(OE_AsyncIOResult_t){Completion->res});
+
+        /* The completion and its slot are kept until the receiver has made room. */
+        if (Error == OE_ERROR_MESSAGE_QUEUE_FULL)
+        {
+            Retry = true;
+            break;
+        }
+
+        AsyncIO->FreeSlots[AsyncIO->NumberOfFreeSlots++] = Slot;
+        NumberOfCompletions++;
+        Head++;
+    }
+
+    OE_ASYNC_IO_STORE(AsyncIO->CompletionHead, Head);
+
+    /* Signal the eventfd again, so that the kept completions are not forgotten. */
+    if (Retry)
+    {
+        Count = 1;
+        while (write(AsyncIO->EventFile, &Count, sizeof(Count)) < 0 && errno == EINTR);
+    }
+
+    return NumberOfCompletions;
+}
+
+OE_Error_t OE_AsyncIO_map(
+    OE_AsyncIO_t *AsyncIO,
+    const struct io_uring_params *Params)
+{
+    AsyncIO->SubmissionRingSize = Params->sq_off.array + Params->sq_entries * sizeof(uint32_t);
+    AsyncIO->CompletionRingSize = Params->cq_off.cqes + Params->cq_entries * sizeof(struct io_uring_cqe);
+
+    /* Newer kernels map both rings at once. */
+    if (Params->features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (AsyncIO->CompletionRingSize > AsyncIO->SubmissionRingSize)
+        {
+            AsyncIO->SubmissionRingSize = AsyncIO->CompletionRingSize;
+        }
+
+        AsyncIO->CompletionRingSize = AsyncIO->SubmissionRingSize;
+    }
+
+    AsyncIO->SubmissionRing = mmap(
+        NULL, AsyncIO->SubmissionRingSize, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, AsyncIO->RingFile, IORING_OFF_SQ_RING);
+
+    if (AsyncIO->SubmissionRing == MAP_FAILED)
+    {
+        AsyncIO->SubmissionRing = NULL;
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    if (Params->features & IORING_FEAT_SINGLE_MMAP)
+    {
+        AsyncIO->CompletionRing = AsyncIO->SubmissionRing;
+    }
+    else
+    {
+        AsyncIO->CompletionRing = mmap(
+            NULL, AsyncIO->CompletionRingSize, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, AsyncIO->RingFile, IORING_OFF_CQ_RING);
+
+        if (AsyncIO->CompletionRing == MAP_FAILED)
+        {
+            AsyncIO->CompletionRing = NULL;
+            return OE_ERROR_UNSPECIFIED;
+        }
+    }
+
+    AsyncIO->EntriesSize = Params->sq_entries * sizeof(struct io_uring_sqe);
+    AsyncIO->Entries = mmap(
+        NULL, AsyncIO->EntriesSize, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, AsyncIO->RingFile, IORING_OFF_SQES);
+
+    if (AsyncIO->Entries == MAP_FAILED)
+    {
+        AsyncIO->Entries = NULL;
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    AsyncIO->SubmissionHead = (uint32_t *)((uint8_t *)AsyncIO->SubmissionRing + Params->sq_off.head);
+    AsyncIO->SubmissionTail = (uint32_t *)((uint8_t *)AsyncIO->SubmissionRing + Params->sq_off.tail);
+    AsyncIO->SubmissionArray = (uint32_t *)((uint8_t *)AsyncIO->SubmissionRing + Params->sq_off.array);
+    AsyncIO->SubmissionMask = *(uint32_t *)((uint8_t *)AsyncIO->SubmissionRing + Params->sq_off.ring_mask);
+
+    AsyncIO->CompletionHead = (uint32_t *)((uint8_t *)AsyncIO->CompletionRing + Params->cq_off.head);
+    AsyncIO->CompletionTail = (uint32_t *)((uint8_t *)AsyncIO->CompletionRing + Params->cq_off.tail);
+    AsyncIO->Completions = (struct io_uring_cqe *)((uint8_t *)AsyncIO->CompletionRing + Params->cq_off.cqes);
+    AsyncIO->CompletionMask = *(uint32_t *)((uint8_t *)AsyncIO->CompletionRing + Params->cq_off.ring_mask);
+
+    return OE_ERROR_NONE;
+}
+#endif // OE_USE_ASYNC_IO
@@ -0,0 +1,198 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_ASYNC_IO_H
+#define OE_ASYNC_IO_H
+
+/**
+ * @brief This is the header file of the asynchronous I/O (Linux only). It lets a module
+ * hand file and socket I/O to an io_uring instance, so that request handlers never
+ * block on I/O.
+ *
+ * The I/O is offered by a module that subscribes one request per operation, e.g. a
+ * read and a write request. Such an I/O module is created from a YAML config like any
+ * other module. It keeps an OE_AsyncIO_t in its module data and opens it in its init
+ * function. Its request handlers pass the operations on with OE_AsyncIO_submit().
+ *
+ * The submitted operations are queued until OE_AsyncIO_flush() hands all of them to
+ * the kernel with one system call. An I/O module can send a flush request to itself
+ * after the first submit, so that the I/O requests that are queued already are
+ * batched with it.
+ *
+ * When an operation completes, the eventfd of the instance becomes readable, see
+ * OE_AsyncIO_getFile(). With OE_USE_EPOLL, the module can wait for it with
+ * OE_Epoll_addFile(). OE_AsyncIO_complete() then sends a response to the kernel and
+ * the response handler of each completed request. The response parameters must be a
+ * single int32_t Result, e.g.:
+ *
+ *     response parameters:
+ *     - name: Result
+ *       type: int32_t
+ *
+ * The result is the result of the system call, e.g. the number of bytes or the file
+ * descriptor of an accepted connection, or a negative errno. Requests without a
+ * response handler are executed as well.
+ *
+ * The buffers of an operation have to stay valid until it completes. An instance is
+ * not locked, so all of its functions have to be called from the thread of the kernel
+ * the I/O module is connected to.
+ */
+
+#include "oe_defines.h"
+
+#if OE_USE_ASYNC_IO
+#include "oe_kernel.h"
+
+#include <linux/io_uring.h>
+
+/* The operations of the asynchronous I/O. */
+typedef enum OE_AsyncIOOpcode_e
+{
+    OE_ASYNC_IO_READ,
+    OE_ASYNC_IO_WRITE,
+    OE_ASYNC_IO_FSYNC,
+    OE_ASYNC_IO_ACCEPT,
+    OE_ASYNC_IO_RECV,
+    OE_ASYNC_IO_SEND,
+} OE_AsyncIOOpcode_t;
+
+/* An operation that is submitted to an io_uring instance. */
+typedef struct OE_AsyncIOOperation_s
+{
+    OE_AsyncIOOpcode_t Opcode;
+
+    /* The file or socket. */
+    int File;
+
+    /* The buffer of read, write, recv and send. */
+    void *Buffer;
+    uint32_t Length;
+
+    /* The file offset of read and write. -1 uses and advances the file position. */
+    int64_t Offset;
+
+} OE_AsyncIOOperation_t;
+
+/* The parameters of a response to a completed operation. */
+typedef struct OE_AsyncIOResult_s
+{
+    int32_t Result;
+
+} OE_AsyncIOResult_t;
+
+typedef struct OE_AsyncIO_s
+{
+    /* The io_uring instance and the eventfd that is signaled on completions. */
+    int RingFile;
+    int EventFile;
+
+    /* The mapped rings. The completion ring may share the mapping of the submission ring. */
+    void *SubmissionRing;
+    size_t SubmissionRingSize;
+    void *CompletionRing;
+    size_t CompletionRingSize;
+    struct io_uring_sqe *Entries;
+    size_t EntriesSize;
+
+    /* The fields of the submission ring. */
+    uint32_t *SubmissionHead;
+    uint32_t *SubmissionTail;
+    uint32_t *SubmissionArray;
+    uint32_t SubmissionMask;
+
+    /* The fields of the completion ring. */
+    uint32_t *CompletionHead;
+    uint32_t *CompletionTail;
+    struct io_uring_cqe *Completions;
+    uint32_t CompletionMask;
+
+    /* The number of operations that are submitted but not flushed yet. */
+    uint32_t Pending;
+
+    /* The headers of the requests that are in flight, by slot. */
+    OE_MessageHeader_t Headers[OE_ASYNC_IO_QUEUE_LENGTH];
+
+    /* The free slots. */
+    uint16_t FreeSlots[OE_ASYNC_IO_QUEUE_LENGTH];
+    size_t NumberOfFreeSlots;
+
+    bool Open;
+
+} OE_AsyncIO_t;
+
+/**
+ * @brief Open an io_uring instance.
+ *
+ * @param AsyncIO Pointer to the instance. It must not be open.
+ * @return OE_Error_t An error is returned if
+ * - the io_uring instance or the eventfd cannot be created.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_AsyncIO_open(
+    OE_AsyncIO_t *AsyncIO);
+
+/**
+ * @brief Close an io_uring instance. Operations in flight are not responded to.
+ *
+ * @param AsyncIO Pointer to the instance.
+ */
+void OE_AsyncIO_close(
+    OE_AsyncIO_t *AsyncIO);
+
+/**
+ * @brief Get the eventfd that becomes readable when operations complete.
+ *
+ * @param AsyncIO Pointer to the instance.
+ * @return int The file descriptor is returned, or -1 if the instance is not open.
+ */
+int OE_AsyncIO_getFile(
+    const OE_AsyncIO_t *AsyncIO);
+
+/**
+ * @brief Queue an operation. It is started by the next OE_AsyncIO_flush().
+ *
+ * @param AsyncIO Pointer to the instance.
+ * @param Header Pointer to the header of the request message. It is copied, so that
+ * the response can be sent once the operation completes.
+ * @param Operation Pointer to the operation.
+ * @return OE_Error_t An error is returned if
+ * - the instance is not open or the operation is invalid.
+ * - OE_ASYNC_IO_QUEUE_LENGTH operations are in flight.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_AsyncIO_submit(
+    OE_AsyncIO_t *AsyncIO,
+    const OE_MessageHeader_t *Header,
+    const OE_AsyncIOOperation_t *Operation);
+
+/**
+ * @brief Start all queued operations with one system call.
+ *
+ * @param AsyncIO Pointer to the instance.
+ * @return OE_Error_t An error is returned if
+ * - the instance is not open.
+ * - the system call fails. The operations stay queued.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_AsyncIO_flush(
+    OE_AsyncIO_t *AsyncIO);
+
+/**
+ * @brief Respond to the completed operations.
+ *
+ * Queued operations are flushed first. If the message queue of a receiver is full,
+ * the function stops there. The remaining completions keep their slots and the eventfd
+ * is signaled again, so that they are responded to by the next call. Other responses
+ * that cannot be sent are dropped.
+ *
+ * @param AsyncIO Pointer to the instance.
+ * @return size_t The number of completed operations that were responded to is returned.
+ */
+size_t OE_AsyncIO_complete(
+    OE_AsyncIO_t *AsyncIO);
+#endif // OE_USE_ASYNC_IO
+
+#endif // OE_ASYNC_IO_H
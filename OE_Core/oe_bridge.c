@@ -0,0 +1,834 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#include "oe_bridge.h"
+
+#if OE_USE_BRIDGE
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+/* The frame format changes with this version. */
+#define OE_BRIDGE_VERSION 2
+
+/* The type of a message in a frame. */
+#define OE_BRIDGE_MESSAGE_REQUEST 0x01
+#define OE_BRIDGE_MESSAGE_DATA_EMPTY 0x02
+#define OE_BRIDGE_MESSAGE_RESPONSE_EXPECTED 0x04
+#define OE_BRIDGE_MESSAGE_ENCODED 0x08
+
+/* The open bridges. Responses find their bridge by the number in the bridge tag. */
+static OE_Bridge_t *OE_Bridges[OE_NUMBER_OF_BRIDGES];
+
+/**
+ * @brief Handle a response to a request from the other node.
+ *
+ * The response is sent back over the bridge that is named in the bridge tag.
+ *
+ * @param Header Pointer to the header of the response message.
+ * @param Parameters Pointer to the response parameters.
+ */
+static void OE_Bridge_handleResponse(
+    OE_MessageHeader_t *Header,
+    const void *Parameters);
+
+/**
+ * @brief Add a message to the frame that is being batched.
+ *
+ * @param Bridge Pointer to the bridge.
+ * @param Type The type of the message.
+ * @param RequestID The ID of the request.
+ * @param Token The token that identifies the request on the node that sent it.
+ * @param Parameters Pointer to the message data, or NULL.
+ * @return OE_Error_t An error is returned if
+ * - the frame is full and cannot be sent.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static OE_Error_t OE_Bridge_addMessage(
+    OE_Bridge_t *Bridge,
+    uint8_t Type,
+    OE_RequestID_t RequestID,
+    uint16_t Token,
+    const void *Parameters);
+
+/**
+ * @brief Handle a frame from the other node.
+ *
+ * @param Bridge Pointer to the bridge.
+ * @param Frame Pointer to the frame.
+ * @param Length The length of the frame.
+ * @return size_t The number of messages in the frame is returned.
+ */
+static size_t OE_Bridge_handleFrame(
+    OE_Bridge_t *Bridge,
+    const uint8_t *Frame,
+    size_t Length);
+
+/**
+ * @brief Connect a TCP bridge to the other node, or accept it.
+ *
+ * @param Bridge Pointer to the bridge.
+ */
+static void OE_Bridge_connect(
+    OE_Bridge_t *Bridge);
+
+/**
+ * @brief Close the connection of a TCP bridge. The bridge connects again later.
+ *
+ * @param Bridge Pointer to the bridge.
+ */
+static void OE_Bridge_disconnect(
+    OE_Bridge_t *Bridge);
+
+/**
+ * @brief Receive the frames that are available.
+ *
+ * @param Bridge Pointer to the bridge.
+ * @return size_t The number of received messages is returned.
+ */
+static size_t OE_Bridge_receive(
+    OE_Bridge_t *Bridge);
+
+static inline void OE_Bridge_write16(
+    uint8_t *Buffer,
+    uint16_t Value)
+{
+    /* Frames are little endian on all nodes. */
+    Buffer[0] = (uint8_t)(Value & 0xFF);
+    Buffer[1] = (uint8_t)(Value >> 8);
+}
+
+static inline uint16_t OE_Bridge_read16(
+    const uint8_t *Buffer)
+{
+    return (uint16_t)(Buffer[0] | (Buffer[1] << 8));
+}
+
+static inline bool OE_Bridge_address(
+    const char *Address,
+    uint16_t Port,
+    struct sockaddr_in *SocketAddress)
+{
+    memset(SocketAddress, 0, sizeof(*SocketAddress));
+    SocketAddress->sin_family = AF_INET;
+    SocketAddress->sin_port = htons(Port);
+
+    if (Address == NULL)
+    {
+        SocketAddress->sin_addr.s_addr = htonl(INADDR_ANY);
+        return true;
+    }
+
+    return inet_pton(AF_INET, Address, &(SocketAddress->sin_addr)) == 1;
+}
+
+static inline bool OE_Bridge_expectsResponse(
+    const OE_MessageHeader_t *Header)
+{
+#if OE_USE_SHARED_CORE
+    return Header->ResponseIndex != OE_NO_RESPONSE_INDEX;
+#else
+    return Header->ResponseHandler != OE_NO_HANDLER;
+#endif // OE_USE_SHARED_CORE
+}
+
+OE_Error_t OE_Bridge_open(
+    OE_Bridge_t *Bridge,
+    OE_Kernel_t *Kernel,
+    const OE_BridgeConfig_t *Config)
+{
+    struct sockaddr_in LocalAddress;
+    struct sockaddr_in RemoteAddress;
+    size_t Index;
+    int Enable = 1;
+
+    if (Bridge == NULL || Kernel == NULL || Config == NULL)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    if (Config->BatchSize < 1 || Config->BatchSize > OE_BRIDGE_BATCH_LIMIT)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    if (!OE_Bridge_address(Config->LocalAddress, Config->LocalPort, &LocalAddress))
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    if ((Config->Transport == OE_BRIDGE_UDP || !Config->Listen) &&
+        (Config->RemoteAddress == NULL ||
+         !OE_Bridge_address(Config->RemoteAddress, Config->RemotePort, &RemoteAddress)))
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    memset(Bridge, 0, sizeof(OE_Bridge_t));
+    Bridge->Kernel = Kernel;
+    Bridge->Config = *Config;
+    Bridge->Socket = -1;
+    Bridge->Listener = -1;
+    Bridge->TxLength = OE_BRIDGE_FRAME_HEADER_SIZE;
+
+    OE_ENTER_CRITICAL();
+
+    for (Index = 0; Index < OE_NUMBER_OF_BRIDGES; Index++)
+    {
+        if (OE_Bridges[Index] == NULL)
+        {
+            break;
+        }
+    }
+
+    if (Index == OE_NUMBER_OF_BRIDGES)
+    {
+        OE_EXIT_CRITICAL();
+        return OE_ERROR_HANDLER_LIMIT_REACHED;
+    }
+
+    Bridge->Index = Index;
+    OE_Bridges[Index] = Bridge;
+
+    OE_EXIT_CRITICAL();
+
+    if (Config->Transport == OE_BRIDGE_UDP)
+    {
+        Bridge->Socket = socket(AF_INET, SOCK_DGRAM, 0);
+
+        if (Bridge->Socket < 0 ||
+            setsockopt(Bridge->Socket, SOL_SOCKET, SO_REUSEADDR, &Enable, sizeof(Enable)) != 0 ||
+            bind(Bridge->Socket, (struct sockaddr *)&LocalAddress, sizeof(LocalAddress)) != 0)
+        {
+            OE_Bridge_close(Bridge);
+            return OE_ERROR_UNSPECIFIED;
+        }
+
+        Bridge->Connected = true;
+    }
+    else if (Config->Listen)
+    {
+        Bridge->Listener = socket(AF_INET, SOCK_STREAM, 0);
+
+        if (Bridge->Listener < 0 ||
+            setsockopt(Bridge->Listener, SOL_SOCKET, SO_REUSEADDR, &Enable, sizeof(Enable)) != 0 ||
+            bind(Bridge->Listener, (struct sockaddr *)&LocalAddress, sizeof(LocalAddress)) != 0 ||
+            listen(Bridge->Listener, 1) != 0 ||
+            fcntl(Bridge->Listener, F_SETFL, O_NONBLOCK) != 0)
+        {
+            OE_Bridge_close(Bridge);
+            return OE_ERROR_UNSPECIFIED;
+        }
+    }
+
+    return OE_ERROR_NONE;
+}
+
+void OE_Bridge_close(
+    OE_Bridge_t *Bridge)
+{
+    OE_ENTER_CRITICAL();
+
+    if (Bridge->Index < OE_NUMBER_OF_BRIDGES && OE_Bridges[Bridge->Index] == Bridge)
+    {
+        OE_Bridges[Bridge->Index] = NULL;
+    }
+
+    OE_EXIT_CRITICAL();
+
+    if (Bridge->Socket >= 0)
+    {
+        close(Bridge->Socket);
+        Bridge->Socket = -1;
+    }
+
+    if (Bridge->Listener >= 0)
+    {
+        close(Bridge->Listener);
+        Bridge->Listener = -1;
+    }
+
+    Bridge->Connected = false;
+    Bridge->TxLength = OE_BRIDGE_FRAME_HEADER_SIZE;
+    Bridge->TxCount = 0;
+}
+
+OE_Error_t OE_Bridge_forwardRequest(
+    OE_Bridge_t *Bridge,
+    const OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    OE_BridgePending_t *Pending;
+    uint8_t Type = OE_BRIDGE_MESSAGE_REQUEST;
+    uint16_t Token = 0;
+
+    if (Header->RequestID >= OE_NUMBER_OF_REQUESTS)
+    {
+        return OE_ERROR_REQUEST_ID_INVALID;
+    }
+
+    /* Do not send a request back to the node it came from. */
+    if ((Header->BridgeTag >> 16) == Bridge->Index + 1)
+    {
+        return OE_ERROR_NONE;
+    }
+
+    if (Header->Information & OE_MESSAGE_DATA_EMPTY)
+    {
+        Parameters = NULL;
+    }
+
+    if (OE_Bridge_expectsResponse(Header))
+    {
+        /* The oldest forwarded request gives up its slot. */
+        Pending = &(Bridge->Pending[Bridge->NextPending]);
+        Pending->Header = *Header;
+        Pending->Generation++;
+        Pending->Used = true;
+
+        Token = (uint16_t)((Pending->Generation << 8) | Bridge->NextPending);
+        Type |= OE_BRIDGE_MESSAGE_RESPONSE_EXPECTED;
+
+        Bridge->NextPending = (Bridge->NextPending + 1) % OE_BRIDGE_PENDING_LIMIT;
+    }
+
+    return OE_Bridge_addMessage(
+        Bridge,
+        Type,
+        Header->RequestID,
+        Token,
+        Parameters);
+}
+
+OE_Error_t OE_Bridge_flush(
+    OE_Bridge_t *Bridge)
+{
+    struct sockaddr_in RemoteAddress;
+    size_t Length = Bridge->TxLength;
+    size_t Sent = 0;
+    ssize_t Result;
+
+    if (Bridge->TxCount == 0)
+    {
+        return OE_ERROR_NONE;
+    }
+
+    if (!Bridge->Connected)
+    {
+        /* The frame is sent once the bridge is connected. */
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    OE_Bridge_write16(&(Bridge->TxFrame[0]), (uint16_t)Length);
+    Bridge->TxFrame[2] = OE_BRIDGE_VERSION;
+    Bridge->TxFrame[3] = (uint8_t)Bridge->TxCount;
+    OE_Bridge_write16(&(Bridge->TxFrame[4]), OE_NUMBER_OF_REQUESTS);
+    OE_Bridge_write16(&(Bridge->TxFrame[6]), OE_MESSAGE_DATA_SIZE);
+
+    if (Bridge->Config.Transport == OE_BRIDGE_UDP)
+    {
+        OE_Bridge_address(
+            Bridge->Config.RemoteAddress,
+            Bridge->Config.RemotePort,
+            &RemoteAddress);
+
+        Result = sendto(
+            Bridge->Socket,
+            Bridge->TxFrame,
+            Length,
+            0,
+            (struct sockaddr *)&RemoteAddress,
+            sizeof(RemoteAddress));
+
+        Sent = (Result == (ssize_t)Length) ? Length : 0;
+    }
+    else
+    {
+        while (Sent < Length)
+        {
+            Result = send(
+                Bridge->Socket,
+                &(Bridge->TxFrame[Sent]),
+                Length - Sent,
+                MSG_NOSIGNAL);
+
+            if (Result < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            if (Result <= 0)
+            {
+                OE_Bridge_disconnect(Bridge);
+                break;
+            }
+
+            Sent += (size_t)Result;
+        }
+    }
+
+    if (Sent == Length)
+    {
+        Bridge->FramesSent++;
+        Bridge->MessagesSent += Bridge->TxCount;
+    }
+    else
+    {
+        Bridge->FramesDropped++;
+        Bridge->MessagesDropped += Bridge->TxCount;
+    }
+
+    Bridge->TxLength = OE_BRIDGE_FRAME_HEADER_SIZE;
+    Bridge->TxCount = 0;
+
+    return (Sent == Length) ? OE_ERROR_NONE : OE_ERROR_UNSPECIFIED;
+}
+
+size_t OE_Bridge_poll(
+    OE_Bridge_t *Bridge)
+{
+    if (!Bridge->Connected)
+    {
+        OE_Bridge_connect(Bridge);
+    }
+
+    if (Bridge->TxCount > 0 &&
+        (uint32_t)(OE_GET_TICKS() - Bridge->TxStart) >= Bridge->Config.FlushTicks)
+    {
+        OE_Bridge_flush(Bridge);
+    }
+
+    return OE_Bridge_receive(Bridge);
+}
+
+void OE_Bridge_handleResponse(
+    OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    OE_Bridge_t *Bridge;
+    size_t Number = Header->BridgeTag >> 16;
+
+    if (Number == 0 || Number > OE_NUMBER_OF_BRIDGES)
+    {
+        return;
+    }
+
+    Bridge = OE_Bridges[Number - 1];
+
+    if (Bridge == NULL)
+    {
+        return;
+    }
+
+    OE_Bridge_addMessage(
+        Bridge,
+        0,
+        Header->RequestID,
+        (uint16_t)(Header->BridgeTag & 0xFFFF),
+        (Header->Information & OE_MESSAGE_DATA_EMPTY) ? NULL : Parameters);
+}
+
+OE_Error_t OE_Bridge_addMessage(
+    OE_Bridge_t *Bridge,
+    uint8_t Type,
+    OE_RequestID_t RequestID,
+    uint16_t Token,
+    const void *Parameters)
+{
+    uint8_t *Message;
+    size_t DataLength = 0;
+#if OE_USE_WIRE_FORMAT
+    OE_WireEncoder_t Encode = NULL;
+#endif
+
+    if (Bridge->TxCount >= Bridge->Config.BatchSize)
+    {
+        OE_Bridge_flush(Bridge);
+
+        if (Bridge->TxCount >= Bridge->Config.BatchSize)
+        {
+            Bridge->MessagesDropped++;
+            return OE_ERROR_MESSAGE_QUEUE_FULL;
+        }
+    }
+
+    if (Bridge->TxCount == 0)
+    {
+        Bridge->TxStart = OE_GET_TICKS();
+    }
+
+    Message = &(Bridge->TxFrame[Bridge->TxLength]);
+
+    if (Parameters == NULL)
+    {
+        Type |= OE_BRIDGE_MESSAGE_DATA_EMPTY;
+    }
+#if OE_USE_WIRE_FORMAT
+    else if (Bridge->Config.Codecs != NULL)
+    {
+        Encode = (Type & OE_BRIDGE_MESSAGE_REQUEST) ?
+            Bridge->Config.Codecs[RequestID].EncodeRequest :
+            Bridge->Config.Codecs[RequestID].EncodeResponse;
+    }
+
+    if (Encode != NULL)
+    {
+        Type |= OE_BRIDGE_MESSAGE_ENCODED;
+        DataLength = Encode(Parameters, &(Message[OE_BRIDGE_MESSAGE_HEADER_SIZE]));
+    }
+    else
+#endif // OE_USE_WIRE_FORMAT
+    if (Parameters != NULL)
+    {
+        memcpy(
+            &(Message[OE_BRIDGE_MESSAGE_HEADER_SIZE]),
+            Parameters,
+            OE_MESSAGE_DATA_SIZE);
+
+        DataLength = OE_MESSAGE_DATA_SIZE;
+    }
+
+    Message[0] = Type;
+    OE_Bridge_write16(&(Message[1]), (uint16_t)RequestID);
+    OE_Bridge_write16(&(Message[3]), Token);
+    OE_Bridge_write16(&(Message[5]), (uint16_t)DataLength);
+    Bridge->TxLength += OE_BRIDGE_MESSAGE_HEADER_SIZE + DataLength;
+
+    Bridge->TxCount++;
+
+    if (Bridge->TxCount >= Bridge->Config.BatchSize)
+    {
+        OE_Bridge_flush(Bridge);
+    }
+
+    return OE_ERROR_NONE;
+}
+
+size_t OE_Bridge_handleFrame(
+    OE_Bridge_t *Bridge,
+    const uint8_t *Frame,
+    size_t Length)
+{
+    OE_MessageHeader_t Header;
+    OE_BridgePending_t *Pending;
+    const uint8_t *Message;
+    const void *Parameters;
+    size_t Offset = OE_BRIDGE_FRAME_HEADER_SIZE;
+    size_t DataLength;
+    size_t Count;
+    size_t Index;
+    uint8_t Type;
+    uint16_t Token;
+    OE_RequestID_t RequestID;
+    OE_Error_t Error;
+#if OE_USE_WIRE_FORMAT
+    OE_WireDecoder_t Decode;
+
+    /* The parameters are decoded into a buffer that is aligned for any struct. */
+    union
+    {
+        uint8_t Bytes[OE_MESSAGE_DATA_SIZE];
+        max_align_t Alignment;
+    } Data;
+#endif // OE_USE_WIRE_FORMAT
+
+    /* Only parameters that are copied as they are depend on the data size. */
+    if (Length < OE_BRIDGE_FRAME_HEADER_SIZE ||
+        OE_Bridge_read16(&(Frame[0])) != Length ||
+        Frame[2] != OE_BRIDGE_VERSION ||
+        OE_Bridge_read16(&(Frame[4])) != OE_NUMBER_OF_REQUESTS)
+    {
+        Bridge->FramesDropped++;
+        return 0;
+    }
+
+    Count = Frame[3];
+    Bridge->FramesReceived++;
+
+    for (Index = 0; Index < Count; Index++)
+    {
+        if (Offset + OE_BRIDGE_MESSAGE_HEADER_SIZE > Length)
+        {
+            break;
+        }
+
+        Message = &(Frame[Offset]);
+        Type = Message[0];
+        RequestID = (OE_RequestID_t)OE_Bridge_read16(&(Message[1]));
+        Token = OE_Bridge_read16(&(Message[3]));
+        DataLength = OE_Bridge_read16(&(Message[5]));
+        Offset += OE_BRIDGE_MESSAGE_HEADER_SIZE;
+        Parameters = NULL;
+
+        if (Offset + DataLength > Length)
+        {
+            break;
+        }
+
+        if (!(Type & OE_BRIDGE_MESSAGE_DATA_EMPTY))
+        {
+            Parameters = &(Frame[Offset]);
+        }
+
+        Offset += DataLength;
+        Bridge->MessagesReceived++;
+        Error = OE_ERROR_PARAMETER_INVALID;
+
+#if OE_USE_WIRE_FORMAT
+        if (Parameters != NULL && (Type & OE_BRIDGE_MESSAGE_ENCODED))
+        {
+            Decode = NULL;
+
+            if (RequestID < OE_NUMBER_OF_REQUESTS && Bridge->Config.Codecs != NULL)
+            {
+                Decode = (Type & OE_BRIDGE_MESSAGE_REQUEST) ?
+                    Bridge->Config.Codecs[RequestID].DecodeRequest :
+                    Bridge->Config.Codecs[RequestID].DecodeResponse;
+            }
+
+            /* The encoded parameters must be read completely. */
+            if (Decode == NULL ||
+                Decode(Data.Bytes, Parameters, DataLength) != DataLength)
+            {
+                Bridge->MessagesDropped++;
+                continue;
+            }
+
+            Parameters = Data.Bytes;
+        }
+        else
+#endif // OE_USE_WIRE_FORMAT
+        if (Parameters != NULL && DataLength != OE_MESSAGE_DATA_SIZE)
+        {
+            Bridge->MessagesDropped++;
+            continue;
+        }
+
+        if (RequestID >= OE_NUMBER_OF_REQUESTS)
+        {
+            Error = OE_ERROR_REQUEST_ID_INVALID;
+        }
+        else if (Type & OE_BRIDGE_MESSAGE_REQUEST)
+        {
+            /* The responses come back to the kernel of the bridge. */
+            Header = (OE_MessageHeader_t){
+                .RequestID = RequestID,
+                .ResponseHandler = (Type & OE_BRIDGE_MESSAGE_RESPONSE_EXPECTED) ?
+                    (OE_MessageHandler_t)OE_Bridge_handleResponse : OE_NO_HANDLER,
+                .KernelID = Bridge->Kernel->KernelID,
+                .BridgeTag = ((OE_BridgeTag_t)(Bridge->Index + 1) << 16) | Token,
+            };
+
+            Error = OE_Core_sendRequest(
+                &Header,
+                Parameters);
+        }
+        else
+        {
+            Pending = &(Bridge->Pending[(Token & 0xFF) % OE_BRIDGE_PENDING_LIMIT]);
+
+            /* A newer request may have taken the slot meanwhile. */
+            if (Pending->Used &&
+                (Token & 0xFF) < OE_BRIDGE_PENDING_LIMIT &&
+                Pending->Generation == (Token >> 8) &&
+                Pending->Header.RequestID == RequestID)
+            {
+                Error = OE_Core_sendResponse(
+                    &(Pending->Header),
+                    Parameters);
+            }
+        }
+
+        if (Error != OE_ERROR_NONE)
+        {
+            Bridge->MessagesDropped++;
+        }
+    }
+
+    return Index;
+}
+
+void OE_Bridge_connect(
+    OE_Bridge_t *Bridge)
+{
+    struct sockaddr_in RemoteAddress;
+    struct pollfd PollFile;
+    socklen_t ErrorLength = sizeof(int);
+    int SocketError = 0;
+    int Enable = 1;
+    int Flags;
+
+    if (Bridge->Config.Transport != OE_BRIDGE_TCP)
+    {
+        return;
+    }
+
+    if (Bridge->Config.Listen)
+    {
+        if (Bridge->Listener < 0)
+        {
+            return;
+        }
+
+        Bridge->Socket = accept(Bridge->Listener, NULL, NULL);
+
+        if (Bridge->Socket < 0)
+        {
+            return;
+        }
+    }
+    else if (Bridge->Socket < 0)
+    {
+        /* Connecting does not block the kernel. */
+        Bridge->Socket = socket(AF_INET, SOCK_STREAM, 0);
+
+        if (Bridge->Socket < 0)
+        {
+            return;
+        }
+
+        fcntl(Bridge->Socket, F_SETFL, O_NONBLOCK);
+
+        OE_Bridge_address(
+            Bridge->Config.RemoteAddress,
+            Bridge->Config.RemotePort,
+            &RemoteAddress);
+
+        if (connect(Bridge->Socket, (struct sockaddr *)&RemoteAddress, sizeof(RemoteAddress)) != 0 &&
+            errno != EINPROGRESS)
+        {
+            OE_Bridge_disconnect(Bridge);
+            return;
+        }
+    }
+
+    /* Check if a connection that is in progress is established. */
+    PollFile.fd = Bridge->Socket;
+    PollFile.events = POLLOUT;
+
+    if (poll(&PollFile, 1, 0) != 1)
+    {
+        return;
+    }
+
+    if (getsockopt(Bridge->Socket, SOL_SOCKET, SO_ERROR, &SocketError, &ErrorLength) != 0 ||
+        SocketError != 0)
+    {
+        OE_Bridge_disconnect(Bridge);
+        return;
+    }
+
+    /* Frames are sent as a whole and right away. */
+    Flags = fcntl(Bridge->Socket, F_GETFL);
+    fcntl(Bridge->Socket, F_SETFL, Flags & ~O_NONBLOCK);
+    setsockopt(Bridge->Socket, IPPROTO_TCP, TCP_NODELAY, &Enable, sizeof(Enable));
+
+    Bridge->RxLength = 0;
+    Bridge->Connected = true;
+}
+
+void OE_Bridge_disconnect(
+    OE_Bridge_t *Bridge)
+{
+    if (Bridge->Socket >= 0)
+    {
+        close(Bridge->Socket);
+        Bridge->Socket = -1;
+    }
+
+    Bridge->Connected = false;
+    Bridge->RxLength = 0;
+}
+
+size_t OE_Bridge_receive(
+    OE_Bridge_t *Bridge)
+{
+    size_t Count = 0;
+    size_t Length;
+    ssize_t Result;
+
+    if (!Bridge->Connected)
+    {
+        return 0;
+    }
+
+    if (Bridge->Config.Transport == OE_BRIDGE_UDP)
+    {
+        /* Each datagram is one frame. */
+        while ((Result = recv(
+                    Bridge->Socket,
+                    Bridge->RxFrame,
+                    OE_BRIDGE_FRAME_SIZE,
+                    MSG_DONTWAIT)) > 0)
+        {
+            Count += OE_Bridge_handleFrame(Bridge, Bridge->RxFrame, (size_t)Result);
+        }
+
+        return Count;
+    }
+
+    while (Bridge->Connected)
+    {
+        Result = recv(
+            Bridge->Socket,
+            &(Bridge->RxFrame[Bridge->RxLength]),
+            OE_BRIDGE_FRAME_SIZE - Bridge->RxLength,
+            MSG_DONTWAIT);
+
+        if (Result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+        {
+            break;
+        }
+
+        if (Result <= 0)
+        {
+            /* The other node closed the connection. */
+            OE_Bridge_disconnect(Bridge);
+            break;
+        }
+
+        Bridge->RxLength += (size_t)Result;
+
+        /* The stream is split into frames by their length. */
+        while (Bridge->RxLength >= 2)
+        {
+            Length = OE_Bridge_read16(&(Bridge->RxFrame[0]));
+
+            if (Length < OE_BRIDGE_FRAME_HEADER_SIZE || Length > OE_BRIDGE_FRAME_SIZE)
+            {
+                /* The stream cannot be split anymore. */
+                Bridge->FramesDropped++;
+                OE_Bridge_disconnect(Bridge);
+                break;
+            }
+
+            if (Bridge->RxLength < Length)
+            {
+                break;
+            }
+
+            Count += OE_Bridge_handleFrame(Bridge, Bridge->RxFrame, Length);
+
+            Bridge->RxLength -= Length;
+            memmove(
+                Bridge->RxFrame,
+                &(Bridge->RxFrame[Length]),
+                Bridge->RxLength);
+        }
+    }
+
+    return Count;
+}
+#endif // OE_USE_BRIDGE
@@ -0,0 +1,242 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_BRIDGE_H
+#define OE_BRIDGE_H
+
+/**
+ * @brief This is the header file of the bridge. A bridge connects the core of this
+ * node to the core of another node, e.g. another board or host, over TCP or UDP.
+ *
+ * Requests are forwarded by a module that subscribes them. Such a bridge module is
+ * created from a YAML config like any other module. Its subscribed requests are the
+ * requests that are forwarded, and each of its request handlers passes the request
+ * on with OE_Bridge_forwardRequest(). The module keeps an OE_Bridge_t in its module
+ * data and opens it in its init function.
+ *
+ * The bridge batches the forwarded requests into frames. A frame is sent once it
+ * holds BatchSize messages or once FlushTicks have passed since its first message.
+ * The other node sends the requests to its own core. Responses are routed back over
+ * the same bridge to the kernel and response handler of the original request.
+ *
+ * OE_Bridge_poll() sends and receives the frames and has to be called regularly,
+ * e.g. from the loop of the kernel the bridge belongs to. A bridge is not locked, so
+ * all of its functions have to be called from the thread of that kernel, and the
+ * bridge module has to be connected to the same kernel. Receiving never blocks, but
+ * sending a frame over TCP may wait until the other node reads.
+ *
+ * Both nodes must be built with the same oe_requests.h. Frames of another
+ * configuration are dropped. With OE_USE_WIRE_FORMAT, the parameters of requests that
+ * have codecs in the config are sent in the wire format (see oe_wire.h). All other
+ * parameters are copied as they are, so both nodes must agree on OE_MESSAGE_DATA_SIZE
+ * and on the layout of these parameters.
+ * Lost frames are not sent again. A response to a request that is older than the
+ * last OE_BRIDGE_PENDING_LIMIT forwarded requests is dropped.
+ */
+
+#include "oe_defines.h"
+#include "oe_wire.h"
+
+#if OE_USE_BRIDGE
+
+/* The frame header holds the length, the version, the count and the configuration. */
+#define OE_BRIDGE_FRAME_HEADER_SIZE 8
+
+/* Each message holds its type, the request ID, the token and the data length. */
+#define OE_BRIDGE_MESSAGE_HEADER_SIZE 7
+
+/* Encoded parameters may take more space than the message data. */
+#if OE_USE_WIRE_FORMAT
+#define OE_BRIDGE_DATA_SIZE OE_WIRE_DATA_LIMIT
+#else
+#define OE_BRIDGE_DATA_SIZE OE_MESSAGE_DATA_SIZE
+#endif
+
+/* The size of a frame with OE_BRIDGE_BATCH_LIMIT messages. */
+#define OE_BRIDGE_FRAME_SIZE (OE_BRIDGE_FRAME_HEADER_SIZE + \
+    OE_BRIDGE_BATCH_LIMIT * (OE_BRIDGE_MESSAGE_HEADER_SIZE + OE_BRIDGE_DATA_SIZE))
+
+#if OE_BRIDGE_FRAME_SIZE > 65507
+#error Invalid definition: OE_BRIDGE_BATCH_LIMIT. A frame must fit into one UDP datagram.
+#endif
+
+/* The transports a bridge can use. */
+typedef enum OE_BridgeTransport_e
+{
+    OE_BRIDGE_UDP,
+    OE_BRIDGE_TCP,
+} OE_BridgeTransport_t;
+
+/**
+ * The config of a bridge. The addresses are IPv4 addresses, e.g. "127.0.0.1".
+ */
+typedef struct OE_BridgeConfig_s
+{
+    /* The transport of the bridge. */
+    OE_BridgeTransport_t Transport;
+
+    /**
+     * The local endpoint. UDP frames are received here. A listening TCP bridge
+     * accepts the other node here. A NULL address binds to all interfaces.
+     */
+    const char *LocalAddress;
+    uint16_t LocalPort;
+
+    /**
+     * The endpoint of the other node. UDP frames are sent there. A TCP bridge that
+     * does not listen connects to it.
+     */
+    const char *RemoteAddress;
+    uint16_t RemotePort;
+
+    /* TCP only: Wait for the other node to connect instead of connecting to it. */
+    bool Listen;
+
+    /* The number of messages that are sent in one frame, at most OE_BRIDGE_BATCH_LIMIT. */
+    size_t BatchSize;
+
+    /* A frame is sent after this many ticks, even if it is not full. 0 sends at each poll. */
+    uint32_t FlushTicks;
+
+#if OE_USE_WIRE_FORMAT
+    /**
+     * The codecs of the requests by request ID, e.g. an array that is initialized with
+     * OE_REQUEST_CODECS. Parameters without codec are copied as they are. NULL sends
+     * all parameters as they are. The array has to stay valid while the bridge is open.
+     */
+    const OE_WireCodec_t *Codecs;
+#endif // OE_USE_WIRE_FORMAT
+
+} OE_BridgeConfig_t;
+
+/**
+ * A forwarded request is kept until a newer one takes its place, so that its
+ * responses can be sent to the original kernel and response handler.
+ */
+typedef struct OE_BridgePending_s
+{
+    OE_MessageHeader_t Header;
+
+    /* The generation tells an old token of the same slot from the current one. */
+    uint8_t Generation;
+
+    bool Used;
+
+} OE_BridgePending_t;
+
+typedef struct OE_Bridge_s
+{
+    /* The kernel that receives the responses to requests from the other node. */
+    OE_Kernel_t *Kernel;
+
+    OE_BridgeConfig_t Config;
+
+    /* The index of the bridge. It is part of the bridge tags. */
+    size_t Index;
+
+    /* The socket to the other node and the listening socket of a TCP bridge. */
+    int Socket;
+    int Listener;
+
+    /* A TCP bridge can only send frames once it is connected. */
+    bool Connected;
+
+    /* The frame that is being batched. */
+    uint8_t TxFrame[OE_BRIDGE_FRAME_SIZE];
+    size_t TxLength;
+    size_t TxCount;
+    uint32_t TxStart;
+
+    /* A TCP stream may deliver a frame in parts. */
+    uint8_t RxFrame[OE_BRIDGE_FRAME_SIZE];
+    size_t RxLength;
+
+    OE_BridgePending_t Pending[OE_BRIDGE_PENDING_LIMIT];
+    size_t NextPending;
+
+    /* Counters for diagnostics. */
+    uint32_t FramesSent;
+    uint32_t MessagesSent;
+    uint32_t FramesReceived;
+    uint32_t MessagesReceived;
+    uint32_t FramesDropped;
+    uint32_t MessagesDropped;
+
+} OE_Bridge_t;
+
+/**
+ * @brief Open a bridge to another node.
+ *
+ * A TCP bridge that does not listen connects during OE_Bridge_poll(), so the
+ * other node does not have to be up yet.
+ *
+ * @param Bridge Pointer to the bridge.
+ * @param Kernel Pointer to the kernel the bridge belongs to.
+ * @param Config Pointer to the config of the bridge. It is copied.
+ * @return OE_Error_t An error is returned if
+ * - a parameter is invalid.
+ * - OE_NUMBER_OF_BRIDGES bridges are open already.
+ * - the socket cannot be created or bound.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Bridge_open(
+    OE_Bridge_t *Bridge,
+    OE_Kernel_t *Kernel,
+    const OE_BridgeConfig_t *Config);
+
+/**
+ * @brief Close a bridge. Messages that were not sent yet are dropped.
+ *
+ * @param Bridge Pointer to the bridge.
+ */
+void OE_Bridge_close(
+    OE_Bridge_t *Bridge);
+
+/**
+ * @brief Forward a request to the other node.
+ *
+ * This function is called from the request handlers of a bridge module.
+ * A request that this bridge received from the other node is not sent back.
+ *
+ * @param Bridge Pointer to the bridge.
+ * @param Header Pointer to the header of the request message.
+ * @param Parameters Pointer to the request parameters, or NULL.
+ * @return OE_Error_t An error is returned if
+ * - the request ID is invalid.
+ * - the frame is full and cannot be sent.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Bridge_forwardRequest(
+    OE_Bridge_t *Bridge,
+    const OE_MessageHeader_t *Header,
+    const void *Parameters);
+
+/**
+ * @brief Send the frame that is being batched.
+ *
+ * @param Bridge Pointer to the bridge.
+ * @return OE_Error_t An error is returned if
+ * - a TCP bridge is not connected. The frame is kept.
+ * - sending fails. The frame is dropped.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Bridge_flush(
+    OE_Bridge_t *Bridge);
+
+/**
+ * @brief Connect, send the due frame and handle the received frames.
+ *
+ * Received requests are sent to the core of this node, received responses are
+ * sent to the kernels that sent the original requests.
+ *
+ * @param Bridge Pointer to the bridge.
+ * @return size_t The number of received messages is returned.
+ */
+size_t OE_Bridge_poll(
+    OE_Bridge_t *Bridge);
+#endif // OE_USE_BRIDGE
+
+#endif // OE_BRIDGE_H
@@ -26,7 +26,224 @@
 /* Includes, prototypes, globals, etc. */
 /* USER CODE MODULE GLOBALS BEGIN */
 #include <string.h>
+#if OE_USE_REQUEST_ATTRIBUTES
+/* The attributes of each request, see OE_REQUEST_ATTRIBUTES in oe_requests.h. */
+static const OE_RequestAttributes_t OE_RequestAttributes[OE_NUMBER_OF_REQUESTS] = OE_REQUEST_ATTRIBUTES;
+#endif // OE_USE_REQUEST_ATTRIBUTES
+
+/**
+ * @brief Try to send a request message once.
+ *
+ * This function implements OE_Core_sendRequest() and OE_Core_sendRequestTo()
+ * without waiting.
+ *
+ * @param ReceiverID The ID of the receiving kernel. OE_NO_KERNEL sends the
+ * request to all subscribing kernels.
+ * @param Header Pointer to the message header.
+ * @param Parameters Pointer to the paramters transported in the message.
+ * @param Staged True if the request was staged by an ISR.
+ * @param Replayed True if the journal replays the request, see OE_Core_replayRequest().
+ * @return OE_Error_t See OE_Core_sendRequest().
+ */
+static inline OE_Error_t OE_Core_trySendRequest(
+    OE_KernelID_t ReceiverID,
+    OE_MessageHeader_t *Header,
+    const void *Parameters,
+    bool Staged,
+    bool Replayed);
+
+/**
+ * @brief Send a request message and wait if the overload policy says so.
+ *
+ * @param ReceiverID The ID of the receiving kernel. OE_NO_KERNEL sends the
+ * request to all subscribing kernels.
+ * @param Header Pointer to the message header.
+ * @param Parameters Pointer to the paramters transported in the message.
+ * @return OE_Error_t See OE_Core_sendRequest().
+ */
+static inline OE_Error_t OE_Core_sendRequestToKernels(
+    OE_KernelID_t ReceiverID,
+    OE_MessageHeader_t *Header,
+    const void *Parameters);
+
+/**
+ * @brief Check if a kernel can take another request.
+ *
+ * This function has to be called inside a critical section.
+ *
+ * @param KernelID The ID of the receiving kernel.
+ * @param RequestID The request ID.
+ * @param Parameters Pointer to the parameters of the new request.
+ * @param Policy If true, a message that can be coalesced, dropped or overwritten
+ * according to the attributes of the request counts as room.
+ * @return OE_Error_t An error is returned if
+ * - the request register is full.
+ * - the message queue is full.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static inline OE_Error_t OE_Core_checkQueue(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const void *Parameters,
+    bool Policy);
+
+/**
+ * @brief Allocate the message for a request in the queue of a kernel.
+ *
+ * The request is registered in the request register. If the request is coalesced,
+ * the queued message is reused. If the kernel is overloaded, the overload policy of
+ * the request decides which message is used.
+ * This function has to be called inside a critical section.
+ *
+ * @param KernelID The ID of the receiving kernel.
+ * @param RequestID The request ID.
+ * @param Parameters Pointer to the parameters of the new request.
+ * @return OE_Message_t* The pointer to the message that has to be written.
+ * Returns NULL if there is no room for the request.
+ */
+static inline OE_Message_t* OE_Core_allocateRequest(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const void *Parameters);
+
+/**
+ * @brief Write a request into an allocated message.
+ *
+ * @param Message Pointer to the allocated message.
+ * @param Header Pointer to the message header.
+ * @param Parameters Pointer to the paramters transported in the message.
+ * @param Replayed True if the message is marked with OE_MESSAGE_REPLAYED.
+ */
+static inline void OE_Core_writeRequest(
+    OE_Message_t *Message,
+    const OE_MessageHeader_t *Header,
+    const void *Parameters,
+    bool Replayed);
+
+#if OE_USE_MESSAGE_POOL
+/**
+ * @brief Pass the sender's reference to the block of a sent request on.
+ *
+ * The queued messages hold their own references, so the sender's reference is
+ * released and the header no longer carries the block. A request that was not sent
+ * keeps its block, so that the sender can send it again or release it.
+ *
+ * @param Header Pointer to the message header.
+ * @param Error The error of sending the request.
+ */
+static inline void OE_Core_passBlock(
+    OE_MessageHeader_t *Header,
+    OE_Error_t Error);
+#endif // OE_USE_MESSAGE_POOL
+
+/**
+ * @brief Send a batch of request messages.
+ *
+ * This function implements OE_Core_sendRequests() without passing on the blocks
+ * of the headers.
+ *
+ * @param Headers Array of message headers.
+ * @param Parameters Array of pointers to the parameters of each request.
+ * @param Count The number of requests in the batch.
+ * @return OE_Error_t See OE_Core_sendRequests().
+ */
+static inline OE_Error_t OE_Core_trySendRequests(
+    OE_MessageHeader_t *Headers,
+    const void *const *Parameters,
+    size_t Count);
+
+#if OE_USE_COALESCING
+/**
+ * @brief Find the queued message a coalesced request replaces.
+ *
+ * This function has to be called inside a critical section.
+ *
+ * @param KernelID The ID of the receiving kernel.
+ * @param RequestID The request ID.
+ * @param Parameters Pointer to the parameters of the new request.
+ * @return OE_Message_t* The pointer to the newest queued message of the request
+ * with the same key. Returns NULL if the request is not coalesced or there is
+ * no such message.
+ */
+static inline OE_Message_t* OE_Core_findCoalesced(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const void *Parameters);
+#endif // OE_USE_COALESCING
+
+/**
+ * @brief Find the kernel that receives a sharded request.
+ *
+ * The hash of the shard key selects one of the kernels that subscribe the request
+ * and whose filters accept it. The same key is sent to the same kernel as long as
+ * this kernel receives it. This function has to be called inside a critical section.
+ *
+ * @param RequestID The request ID.
+ * @param Parameters Pointer to the parameters of the request.
+ * @return OE_KernelID_t The ID of the receiving kernel. Returns OE_NO_KERNEL if
+ * OE_USE_SHARDING is not set, the request is not sharded or no kernel receives it.
+ */
+static inline OE_KernelID_t OE_Core_findShard(
+    OE_RequestID_t RequestID,
+    const void *Parameters);
+
+#if OE_USE_REQUEST_FILTERS
+/**
+ * @brief Check if one of the request filters of a kernel matches.
+ *
+ * This function has to be called inside a critical section.
+ *
+ * @param KernelID The ID of the kernel.
+ * @param RequestID The request ID.
+ * @param Parameters Pointer to the parameters of the request.
+ * @return true If the kernel has no filters or one of them matches.
+ * @return false If all filters of the kernel reject the request.
+ */
+static inline bool OE_Core_filtersMatch(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const void *Parameters);
+#endif // OE_USE_REQUEST_FILTERS
+
+/**
+ * @brief Check if a kernel receives a request.
+ *
+ * @param KernelID The ID of the kernel.
+ * @param RequestID The request ID.
+ * @param ShardID The kernel that receives a sharded request, see OE_Core_findShard().
+ * @param Parameters Pointer to the parameters of the request.
+ * @return true The kernel subscribes the request, is its shard if there is one,
+ * and one of its filters matches if it uses filters.
+ * @return false The kernel does not receive the request.
+ */
+static inline bool OE_Core_isReceiver(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    OE_KernelID_t ShardID,
+    const void *Parameters);
+
+#if OE_USE_ISR_SEND
+/**
+ * @brief Merge the requests staged by ISRs into the message queues.
+ *
+ * A ring is merged by one kernel at a time. The merge of a ring stops at the
+ * first request that does not fit into the message queues, so the order of
+ * each source is kept.
+ */
+static inline void OE_Core_mergeStagingRings(void);
+#endif // OE_USE_ISR_SEND
+
 #if OE_USE_REQUEST_LIMIT
+/**
+ * @brief Get the request limit of a request.
+ *
+ * @param RequestID The request ID.
+ * @return size_t The request limit from the request attributes or
+ * OE_REQUEST_LIMIT if the request has no individual limit.
+ */
+static inline size_t OE_Core_requestLimit(
+    OE_RequestID_t RequestID);
+
 /**
  * @brief Check if the request register is full.
  *
@@ -75,6 +292,99 @@ static inline void OE_Core_clearRequestEntry(
     OE_KernelID_t KernelID,
     OE_RequestID_t RequestID);
 #endif // OE_USE_REQUEST_LIMIT
+
+#if OE_USE_RATE_LIMIT
+/**
+ * @brief Take a token from the token bucket of a request.
+ *
+ * The bucket is refilled first with the tokens of all rate periods that have
+ * passed since the last refill. This function has to be called inside a critical
+ * section.
+ *
+ * @param RequestID The request ID.
+ * @return true Returns true if a token was taken or the request is not rate limited.
+ * @return false Returns false if the bucket is empty.
+ */
+static inline bool OE_Core_takeToken(
+    OE_RequestID_t RequestID);
+
+/**
+ * @brief Get the burst of a request.
+ *
+ * @param RequestID The request ID.
+ * @return uint32_t The maximum number of tokens in the bucket of the request.
+ */
+static inline uint32_t OE_Core_rateBurst(
+    OE_RequestID_t RequestID);
+#endif // OE_USE_RATE_LIMIT
+
+#if OE_USE_MESSAGE_STATISTICS
+/**
+ * @brief Count a message in the message statistics.
+ *
+ * This function has to be called inside a critical section.
+ *
+ * @param SenderID The ID of the sending kernel. If the ID is invalid,
+ * the message is counted as sent by an unknown sender.
+ * @param RequestID The ID of the request.
+ * @param ReceiverID The ID of the receiving kernel.
+ * @param Information The information of the queued message.
+ */
+static inline void OE_Core_countMessage(
+    OE_KernelID_t SenderID,
+    OE_RequestID_t RequestID,
+    OE_KernelID_t ReceiverID,
+    OE_MessageInformation_t Information);
+
+/**
+ * @brief Find the kernel that answers a request.
+ *
+ * A response is usually sent with the header of the request message, which
+ * still lies in the message queue of the kernel that handles the request.
+ * If the header was copied somewhere else, the port is asked instead.
+ *
+ * @param Header Pointer to the header that is used to send a response.
+ * @return OE_KernelID_t The ID of the responding kernel or OE_NO_KERNEL.
+ */
+static inline OE_KernelID_t OE_Core_responderOf(
+    const OE_MessageHeader_t *Header);
+#endif // OE_USE_MESSAGE_STATISTICS
+
+#if OE_USE_SHARED_CORE
+/**
+ * @brief Add a response handler to the table of this process.
+ *
+ * @param ResponseHandler The response handler. OE_NO_HANDLER is ignored.
+ * @return true If the handler is in the table.
+ * @return false If the table is full.
+ */
+static inline bool OE_Core_addResponseHandler(
+    OE_MessageHandler_t ResponseHandler);
+
+/**
+ * @brief Find the index of a response handler in the table of this process.
+ *
+ * @param ResponseHandler The response handler.
+ * @return OE_ResponseIndex_t The index is returned.
+ * If the handler is not in the table, OE_NO_RESPONSE_INDEX is returned.
+ */
+static inline OE_ResponseIndex_t OE_Core_responseIndex(
+    OE_MessageHandler_t ResponseHandler);
+
+/* Kernel pointers are only valid in the process that connected the kernel. */
+static OE_Kernel_t *OE_Kernels[OE_NUMBER_OF_KERNELS];
+
+/* The response handlers this process has sent requests with. */
+static OE_MessageHandler_t OE_ResponseHandlers[OE_RESPONSE_HANDLER_LIMIT];
+static volatile size_t OE_NumberOfResponseHandlers;
+#else
+#define OE_Kernels (OE_Core->Kernels)
+#endif // OE_USE_SHARED_CORE
+
+#if OE_USE_COROUTINES
+/* The tags of the awaits the kernels are sending requests for. */
+static OE_AwaitTag_t OE_AwaitTags[OE_NUMBER_OF_KERNELS];
+#endif // OE_USE_COROUTINES
 /* USER CODE MODULE GLOBALS END */
 
 /* Global pointer to the module. */
@@ -165,24 +475,61 @@ OE_Error_t init_OE_Core(void *Args)
 
 	OE_Core->NumberOfKernels = 0;
 
+    /**
+     * With OE_USE_FAST_BOOT the core is zero already, see oe_config.h. Only the state
+     * that does not grow with the queue length and the number of requests is reset.
+     */
     for (OE_KernelID_t KernelID = 0; KernelID < OE_NUMBER_OF_KERNELS; KernelID++)
     {
+#if !OE_USE_FAST_BOOT
         for (size_t Count = 0; Count < OE_NUMBER_OF_REQUESTS; Count++)
         {
             OE_Core->RequestSubscribed[KernelID][Count] = false;
+#if OE_USE_REQUEST_FILTERS
+            OE_Core->RequestFilters[KernelID][Count].NumberOfFilters = 0;
+#endif // OE_USE_REQUEST_FILTERS
 #if OE_USE_REQUEST_LIMIT
 			/* Init the request registers. */
             OE_Core->RequestRegisters[KernelID][Count].NumberOfRequests = 0;
-            OE_Core->RequestRegisters[KernelID][Count].RequestLimit = OE_REQUEST_LIMIT;
 #endif // OE_USE_REQUEST_LIMIT            
         }
 
         /* Init message queue. */
         OE_MessageQueue_staticInit(
             &OE_Core->MessageQueues[KernelID]);
+#endif // OE_USE_FAST_BOOT
+
+        OE_Kernels[KernelID] = NULL;
+    }
+
+#if OE_USE_SHARED_CORE
+    OE_NumberOfResponseHandlers = 0;
+#endif // OE_USE_SHARED_CORE
+
+#if OE_USE_ISR_SEND && !OE_USE_FAST_BOOT
+    for (size_t SourceID = 0; SourceID < OE_NUMBER_OF_ISR_SOURCES; SourceID++)
+    {
+        OE_StagingRing_staticInit(
+            &OE_Core->StagingRings[SourceID]);
+    }
+#endif // OE_USE_ISR_SEND && !OE_USE_FAST_BOOT
 
-        OE_Core->Kernels[KernelID] = NULL;
+#if OE_USE_RATE_LIMIT
+    /* Start with full token buckets. */
+    for (size_t Count = 0; Count < OE_NUMBER_OF_REQUESTS; Count++)
+    {
+        OE_Core->RateBuckets[Count].Tokens = OE_Core_rateBurst(Count);
+        OE_Core->RateBuckets[Count].LastRefill = (uint32_t)OE_GET_TICKS();
     }
+#endif // OE_USE_RATE_LIMIT
+
+#if OE_USE_MESSAGE_STATISTICS && !OE_USE_FAST_BOOT
+    memset(OE_Core->MessageStatistics, 0, sizeof(OE_Core->MessageStatistics));
+#endif // OE_USE_MESSAGE_STATISTICS && !OE_USE_FAST_BOOT
+
+#if OE_USE_MESSAGE_POOL
+    OE_MessagePool_staticInit(&OE_Core->MessagePool);
+#endif // OE_USE_MESSAGE_POOL
 
 	/* Return no error if everything is fine. */
 	return OE_ERROR_NONE;
@@ -210,7 +557,7 @@ OE_Error_t OE_Core_connectKernel(
     /* First, check if the kernel is already connected. */
     for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
     {
-        if (OE_Core->Kernels[KernelID] == Kernel)
+        if (OE_Kernels[KernelID] == Kernel)
         {
             OE_EXIT_CRITICAL();
 
@@ -227,7 +574,7 @@ OE_Error_t OE_Core_connectKernel(
 
     Kernel->KernelID = OE_Core->NumberOfKernels;
 
-    OE_Core->Kernels[OE_Core->NumberOfKernels] = Kernel;
+    OE_Kernels[OE_Core->NumberOfKernels] = Kernel;
 
     OE_Core->NumberOfKernels++;
 
@@ -241,35 +588,177 @@ OE_Error_t OE_Core_connectKernel(
 OE_Error_t OE_Core_sendRequest(
     OE_MessageHeader_t *Header,
     const void *Parameters)
+{
+    OE_Error_t Error;
+
+    Error = OE_Core_sendRequestToKernels(
+        OE_NO_KERNEL,
+        Header,
+        Parameters);
+
+#if OE_USE_MESSAGE_POOL
+    OE_Core_passBlock(Header, Error);
+#endif // OE_USE_MESSAGE_POOL
+
+    return Error;
+}
+
+OE_Error_t OE_Core_sendRequestTo(
+    OE_KernelID_t ReceiverID,
+    OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    OE_Error_t Error = OE_ERROR_KERNEL_ID_INVALID;
+
+    if (ReceiverID < OE_Core->NumberOfKernels)
+    {
+        Error = OE_Core_sendRequestToKernels(
+            ReceiverID,
+            Header,
+            Parameters);
+    }
+
+#if OE_USE_MESSAGE_POOL
+    OE_Core_passBlock(Header, Error);
+#endif // OE_USE_MESSAGE_POOL
+
+    return Error;
+}
+
+OE_Error_t OE_Core_sendRequestToKernels(
+    OE_KernelID_t ReceiverID,
+    OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    OE_Error_t Error;
+#if OE_USE_OVERLOAD_POLICY
+    uint32_t Start;
+#endif // OE_USE_OVERLOAD_POLICY
+
+    Error = OE_Core_trySendRequest(
+        ReceiverID,
+        Header,
+        Parameters,
+        false,
+        false);
+
+#if OE_USE_OVERLOAD_POLICY
+    /**
+     * A blocking sender waits for room until the timeout has passed. A kernel
+     * must never wait, since it might be the one that has to make room.
+     */
+    if ((Error != OE_ERROR_MESSAGE_QUEUE_FULL && Error != OE_ERROR_REQUEST_LIMIT_REACHED) ||
+        OE_RequestAttributes[Header->RequestID].OverloadPolicy != OE_OVERLOAD_BLOCK ||
+        OE_CURRENT_KERNEL() != OE_NO_KERNEL)
+    {
+        return Error;
+    }
+
+    Start = (uint32_t)OE_GET_TICKS();
+
+    while ((Error == OE_ERROR_MESSAGE_QUEUE_FULL || Error == OE_ERROR_REQUEST_LIMIT_REACHED) &&
+           (uint32_t)((uint32_t)OE_GET_TICKS() - Start) < OE_RequestAttributes[Header->RequestID].BlockTimeout)
+    {
+        OE_YIELD();
+
+        Error = OE_Core_trySendRequest(
+            ReceiverID,
+            Header,
+            Parameters,
+            false,
+            false);
+    }
+#endif // OE_USE_OVERLOAD_POLICY
+
+    return Error;
+}
+
+OE_Error_t OE_Core_trySendRequest(
+    OE_KernelID_t ReceiverID,
+    OE_MessageHeader_t *Header,
+    const void *Parameters,
+    bool Staged,
+    bool Replayed)
 {
     OE_Message_t *Message = NULL;
     OE_KernelID_t KernelID;
+    OE_KernelID_t FirstKernel;
+    OE_KernelID_t LastKernel;
+    OE_Error_t Error;
     bool handlerRegistered = false;
+    bool Unicast = (ReceiverID != OE_NO_KERNEL);
+#if OE_USE_MESSAGE_STATISTICS
+    OE_KernelID_t SenderID;
+#endif // OE_USE_MESSAGE_STATISTICS
 
     if (Header->RequestID >= OE_NUMBER_OF_REQUESTS)
     {
         return OE_ERROR_REQUEST_ID_INVALID;
     }
 
+#if OE_USE_SHARED_CORE
+    if (!OE_Core_addResponseHandler(Header->ResponseHandler))
+    {
+        return OE_ERROR_HANDLER_LIMIT_REACHED;
+    }
+#endif // OE_USE_SHARED_CORE
+
+#if OE_USE_MESSAGE_STATISTICS
+    /**
+     * The kernel ID in the header is only reliable if a response is expected.
+     * Otherwise ask the port in which kernel we are running. Staged requests
+     * come from an ISR, which is an unknown sender.
+     */
+    if (Staged)
+    {
+        SenderID = OE_NO_KERNEL;
+    }
+    else
+    {
+        SenderID = (Header->ResponseHandler != NULL) ? Header->KernelID : OE_CURRENT_KERNEL();
+    }
+#else
+    (void)Staged;
+#endif // OE_USE_MESSAGE_STATISTICS
+
     OE_ENTER_CRITICAL();
 
+    if (ReceiverID == OE_NO_KERNEL)
+    {
+        ReceiverID = OE_Core_findShard(
+            Header->RequestID,
+            Parameters);
+    }
+
+    /* A unicast or sharded request skips the scan over the other kernels. */
+    if (ReceiverID == OE_NO_KERNEL)
+    {
+        FirstKernel = 0;
+        LastKernel = OE_Core->NumberOfKernels;
+    }
+    else
+    {
+        FirstKernel = ReceiverID;
+        LastKernel = ReceiverID + 1;
+    }
+
     /* Control loop. */
-    for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+    for (KernelID = FirstKernel; KernelID < LastKernel; KernelID++)
     {
-        if (OE_Core->RequestSubscribed[KernelID][Header->RequestID])
+        if (OE_Core_isReceiver(KernelID, Header->RequestID, ReceiverID, Parameters))
         {
             handlerRegistered = true;
-#if OE_USE_REQUEST_LIMIT
-            if (OE_Core_registerFull(KernelID, Header->RequestID))
-            {
-                OE_EXIT_CRITICAL();
-                return OE_ERROR_REQUEST_LIMIT_REACHED;
-            }
-#endif // OE_USE_REQUEST_LIMIT
-            if (OE_MessageQueue_isFull(&OE_Core->MessageQueues[KernelID]))
+
+            Error = OE_Core_checkQueue(
+                KernelID,
+                Header->RequestID,
+                Parameters,
+                true);
+
+            if (Error != OE_ERROR_NONE)
             {
                 OE_EXIT_CRITICAL();
-                return OE_ERROR_MESSAGE_QUEUE_FULL;
+                return Error;
             }
         }
     }
@@ -277,46 +766,50 @@ OE_Error_t OE_Core_sendRequest(
     if (!handlerRegistered)
     {
         OE_EXIT_CRITICAL();
-        return OE_ERROR_NONE;
+
+        /* A broadcast may have no subscribers, but a unicast has to reach its kernel. */
+        return Unicast ? OE_ERROR_NO_RECEIVER : OE_ERROR_NONE;
+    }
+
+#if OE_USE_RATE_LIMIT
+    /* Only requests that are actually sent take a token. */
+    if (!OE_Core_takeToken(Header->RequestID))
+    {
+        OE_EXIT_CRITICAL();
+        return OE_ERROR_RATE_LIMIT_REACHED;
     }
+#endif // OE_USE_RATE_LIMIT
 
     /* Send loop. */
-    for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+    for (KernelID = FirstKernel; KernelID < LastKernel; KernelID++)
     {
-        if (OE_Core->RequestSubscribed[KernelID][Header->RequestID])
+        if (OE_Core_isReceiver(KernelID, Header->RequestID, ReceiverID, Parameters))
         {
-#if OE_USE_REQUEST_LIMIT
-            if (OE_Core_setRequestEntry(KernelID, Header->RequestID) == OE_ERROR_NONE)
-#endif // OE_USE_REQUEST_LIMIT
-            {
-                Message = OE_MessageQueue_allocateMessage(
-                    &OE_Core->MessageQueues[KernelID]);
-
-                if (Message == NULL)
-                {
-#if OE_USE_REQUEST_LIMIT
-                    OE_Core_clearRequestEntry(
-                        KernelID,
-                        Header->RequestID);
-#endif // OE_USE_REQUEST_LIMIT
-                    continue;
-                }
-
-                Message->Header = *Header;
-                Message->Header.Information = OE_MESSAGE_TYPE_REQUEST | OE_MESSAGE_DATA_EMPTY;
-
-                if (Parameters != NULL)
-                {
-                    memcpy(
-                        &(Message->Data),
-                        Parameters,
-                        OE_MESSAGE_DATA_SIZE);
-
-                    Message->Header.Information &= ~(OE_MESSAGE_DATA_EMPTY);
-                }
+            Message = OE_Core_allocateRequest(
+                KernelID,
+                Header->RequestID,
+                Parameters);
 
-                OE_RESUME(KernelID);
+            if (Message == NULL)
+            {
+                continue;
             }
+
+            OE_Core_writeRequest(
+                Message,
+                Header,
+                Parameters,
+                Replayed);
+
+#if OE_USE_MESSAGE_STATISTICS
+            OE_Core_countMessage(
+                SenderID,
+                Header->RequestID,
+                KernelID,
+                Message->Header.Information);
+#endif // OE_USE_MESSAGE_STATISTICS
+
+            OE_RESUME(KernelID);
         }
     }
 
@@ -324,63 +817,795 @@ OE_Error_t OE_Core_sendRequest(
     return OE_ERROR_NONE;
 }
 
-OE_Error_t OE_Core_sendResponse(
-    OE_MessageHeader_t *Header,
-    const void *Parameters)
+OE_Error_t OE_Core_sendRequests(
+    OE_MessageHeader_t *Headers,
+    const void *const *Parameters,
+    size_t Count)
 {
-    OE_Message_t *Message = NULL;
+    OE_Error_t Error;
 
-    if (Header->KernelID >= OE_NUMBER_OF_KERNELS)
-    {
-        return OE_ERROR_KERNEL_ID_INVALID;
-    }
+    Error = OE_Core_trySendRequests(
+        Headers,
+        Parameters,
+        Count);
 
-    if (Header->RequestID >= OE_NUMBER_OF_REQUESTS)
+#if OE_USE_MESSAGE_POOL
+    /* Either all requests of the batch are sent or none. */
+    for (size_t Index = 0; Index < Count; Index++)
     {
-        return OE_ERROR_REQUEST_ID_INVALID;
+        OE_Core_passBlock(&Headers[Index], Error);
     }
+#endif // OE_USE_MESSAGE_POOL
 
-    if (Header->ResponseHandler == NULL)
-    {
-        return OE_ERROR_PARAMETER_INVALID;
-    }
+    return Error;
+}
 
-    OE_ENTER_CRITICAL();
+#if OE_USE_JOURNAL
+OE_Error_t OE_Core_replayRequest(
+    OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    OE_Error_t Error;
 
-    Message = OE_MessageQueue_allocateMessage(
-        &OE_Core->MessageQueues[Header->KernelID]);
+    Error = OE_Core_trySendRequest(
+        OE_NO_KERNEL,
+        Header,
+        Parameters,
+        false,
+        true);
 
-    if (Message == NULL)
-    {
-        OE_EXIT_CRITICAL();
-        return OE_ERROR_MESSAGE_QUEUE_FULL;
-    }
+#if OE_USE_MESSAGE_POOL
+    OE_Core_passBlock(Header, Error);
+#endif // OE_USE_MESSAGE_POOL
 
-    Message->Header = *Header;
-    Message->Header.Information = OE_MESSAGE_DATA_EMPTY;
+    return Error;
+}
+#endif // OE_USE_JOURNAL
 
-    if (Parameters != NULL)
+OE_Error_t OE_Core_trySendRequests(
+    OE_MessageHeader_t *Headers,
+    const void *const *Parameters,
+    size_t Count)
+{
+    OE_Message_t *Message;
+    OE_KernelID_t KernelID;
+    OE_RequestID_t RequestID;
+    const void *RequestParameters;
+    OE_KernelID_t ShardID;
+    OE_Error_t Error = OE_ERROR_NONE;
+    size_t Needed[OE_NUMBER_OF_KERNELS] = {0};
+    bool Resume[OE_NUMBER_OF_KERNELS] = {false};
+    bool Subscribed;
+    size_t Reserved;
+#if OE_USE_MESSAGE_STATISTICS
+    OE_KernelID_t SenderID;
+#endif // OE_USE_MESSAGE_STATISTICS
+
+    for (size_t Index = 0; Index < Count; Index++)
     {
-        memcpy(
-            &(Message->Data),
-            Parameters,
-            OE_MESSAGE_DATA_SIZE);
+        if (Headers[Index].RequestID >= OE_NUMBER_OF_REQUESTS)
+        {
+            return OE_ERROR_REQUEST_ID_INVALID;
+        }
 
-        Message->Header.Information &= ~(OE_MESSAGE_DATA_EMPTY);
+#if OE_USE_SHARED_CORE
+        if (!OE_Core_addResponseHandler(Headers[Index].ResponseHandler))
+        {
+            return OE_ERROR_HANDLER_LIMIT_REACHED;
+        }
+#endif // OE_USE_SHARED_CORE
     }
 
-    OE_RESUME(Header->KernelID);
+    OE_ENTER_CRITICAL();
 
-    OE_EXIT_CRITICAL();
-    return OE_ERROR_NONE;
-}
+    /**
+     * Control loop. The whole batch has to fit, so the request entries and tokens
+     * are reserved request by request. Coalescing and overload policies are not
+     * taken into account.
+     */
+    for (Reserved = 0; Reserved < Count; Reserved++)
+    {
+        RequestID = Headers[Reserved].RequestID;
+        RequestParameters = (Parameters != NULL) ? Parameters[Reserved] : NULL;
+        ShardID = OE_Core_findShard(RequestID, RequestParameters);
+        Subscribed = false;
 
-OE_Message_t *OE_Core_getMessage(
-    OE_KernelID_t KernelID)
-{
-    OE_Message_t *Message;
-    
+        for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+        {
+            if (OE_Core_isReceiver(KernelID, RequestID, ShardID, RequestParameters))
+            {
+                Subscribed = true;
+#if OE_USE_REQUEST_LIMIT
+                if (OE_Core_registerFull(KernelID, RequestID))
+                {
+                    Error = OE_ERROR_REQUEST_LIMIT_REACHED;
+                }
+#endif // OE_USE_REQUEST_LIMIT
+            }
+        }
+
+#if OE_USE_RATE_LIMIT
+        /* Only requests that are actually sent take a token. */
+        if (Error == OE_ERROR_NONE && Subscribed && !OE_Core_takeToken(RequestID))
+        {
+            Error = OE_ERROR_RATE_LIMIT_REACHED;
+        }
+#endif // OE_USE_RATE_LIMIT
+
+        if (Error != OE_ERROR_NONE)
+        {
+            break;
+        }
+
+        for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+        {
+            if (OE_Core_isReceiver(KernelID, RequestID, ShardID, RequestParameters))
+            {
+                Needed[KernelID]++;
+#if OE_USE_REQUEST_LIMIT
+                OE_Core_setRequestEntry(KernelID, RequestID);
+#endif // OE_USE_REQUEST_LIMIT
+            }
+        }
+    }
+
+    for (KernelID = 0; KernelID < OE_Core->NumberOfKernels && Error == OE_ERROR_NONE; KernelID++)
+    {
+        if (Needed[KernelID] > OE_MESSAGE_QUEUE_LENGTH - OE_Core->MessageQueues[KernelID].NumberOfMessages)
+        {
+            Error = OE_ERROR_MESSAGE_QUEUE_FULL;
+        }
+    }
+
+    /**
+     * Release the reservations. The request entries are set again when the messages
+     * are allocated. The tokens are only given back if the batch is not sent.
+     */
+    for (size_t Index = 0; Index < Reserved; Index++)
+    {
+        RequestID = Headers[Index].RequestID;
+        RequestParameters = (Parameters != NULL) ? Parameters[Index] : NULL;
+        ShardID = OE_Core_findShard(RequestID, RequestParameters);
+        Subscribed = false;
+
+        for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+        {
+            if (OE_Core_isReceiver(KernelID, RequestID, ShardID, RequestParameters))
+            {
+                Subscribed = true;
+#if OE_USE_REQUEST_LIMIT
+                OE_Core_clearRequestEntry(KernelID, RequestID);
+#endif // OE_USE_REQUEST_LIMIT
+            }
+        }
+
+#if OE_USE_RATE_LIMIT
+        if (Error != OE_ERROR_NONE && Subscribed && OE_RequestAttributes[RequestID].RateLimit > 0)
+        {
+            OE_Core->RateBuckets[RequestID].Tokens++;
+        }
+#else
+        (void)Subscribed;
+#endif // OE_USE_RATE_LIMIT
+    }
+
+    if (Error != OE_ERROR_NONE)
+    {
+        OE_EXIT_CRITICAL();
+        return Error;
+    }
+
+    /* Send loop. */
+    for (size_t Index = 0; Index < Count; Index++)
+    {
+        RequestID = Headers[Index].RequestID;
+        RequestParameters = (Parameters != NULL) ? Parameters[Index] : NULL;
+        ShardID = OE_Core_findShard(RequestID, RequestParameters);
+
+#if OE_USE_MESSAGE_STATISTICS
+        SenderID = (Headers[Index].ResponseHandler != NULL) ? Headers[Index].KernelID : OE_CURRENT_KERNEL();
+#endif // OE_USE_MESSAGE_STATISTICS
+
+        for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+        {
+            if (!OE_Core_isReceiver(KernelID, RequestID, ShardID, RequestParameters))
+            {
+                continue;
+            }
+
+            Message = OE_Core_allocateRequest(
+                KernelID,
+                RequestID,
+                RequestParameters);
+
+            if (Message == NULL)
+            {
+                continue;
+            }
+
+            OE_Core_writeRequest(
+                Message,
+                &Headers[Index],
+                RequestParameters,
+                false);
+
+#if OE_USE_MESSAGE_STATISTICS
+            OE_Core_countMessage(
+                SenderID,
+                RequestID,
+                KernelID,
+                Message->Header.Information);
+#endif // OE_USE_MESSAGE_STATISTICS
+
+            Resume[KernelID] = true;
+        }
+    }
+
+    /* Each kernel is resumed once for the whole batch. */
+    for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+    {
+        if (Resume[KernelID])
+        {
+            OE_RESUME(KernelID);
+        }
+    }
+
+    OE_EXIT_CRITICAL();
+    return OE_ERROR_NONE;
+}
+
+OE_Error_t OE_Core_checkQueue(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const void *Parameters,
+    bool Policy)
+{
+    OE_Error_t Error = OE_ERROR_NONE;
+
+#if OE_USE_REQUEST_LIMIT
+    if (OE_Core_registerFull(KernelID, RequestID))
+    {
+        Error = OE_ERROR_REQUEST_LIMIT_REACHED;
+    }
+    else
+#endif // OE_USE_REQUEST_LIMIT
+    if (OE_MessageQueue_isFull(&OE_Core->MessageQueues[KernelID]))
+    {
+        Error = OE_ERROR_MESSAGE_QUEUE_FULL;
+    }
+
+#if OE_USE_COALESCING
+    /* A coalesced request does not take another slot. */
+    if (Error != OE_ERROR_NONE && Policy &&
+        OE_Core_findCoalesced(KernelID, RequestID, Parameters) != NULL)
+    {
+        Error = OE_ERROR_NONE;
+    }
+#else
+    (void)Parameters;
+#endif // OE_USE_COALESCING
+
+#if OE_USE_OVERLOAD_POLICY
+    /* A queued message of the same request can make room. */
+    if (Error != OE_ERROR_NONE && Policy &&
+        (OE_RequestAttributes[RequestID].OverloadPolicy == OE_OVERLOAD_DROP_OLDEST ||
+         OE_RequestAttributes[RequestID].OverloadPolicy == OE_OVERLOAD_COALESCE_LATEST) &&
+        OE_MessageQueue_findRequest(&OE_Core->MessageQueues[KernelID], RequestID, false) != NULL)
+    {
+        Error = OE_ERROR_NONE;
+    }
+#else
+    (void)Policy;
+#endif // OE_USE_OVERLOAD_POLICY
+
+    return Error;
+}
+
+OE_Message_t* OE_Core_allocateRequest(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const void *Parameters)
+{
+    OE_MessageQueue_t *MessageQueue = &OE_Core->MessageQueues[KernelID];
+    OE_Message_t *Message;
+
+#if OE_USE_COALESCING
+    /* The queued request has not been handled yet, so it is simply overwritten. */
+    Message = OE_Core_findCoalesced(
+        KernelID,
+        RequestID,
+        Parameters);
+
+    if (Message != NULL)
+    {
+#if OE_USE_MESSAGE_POOL
+        OE_Core_releaseBlock(Message->Header.Block);
+#endif // OE_USE_MESSAGE_POOL
+        return Message;
+    }
+#endif // OE_USE_COALESCING
+
+#if OE_USE_OVERLOAD_POLICY
+    if (OE_Core_checkQueue(KernelID, RequestID, Parameters, false) != OE_ERROR_NONE)
+    {
+        switch (OE_RequestAttributes[RequestID].OverloadPolicy)
+        {
+        case OE_OVERLOAD_DROP_OLDEST:
+            Message = OE_MessageQueue_findRequest(MessageQueue, RequestID, false);
+
+            if (Message == NULL)
+            {
+                return NULL;
+            }
+
+#if OE_USE_MESSAGE_POOL
+            OE_Core_releaseBlock(Message->Header.Block);
+#endif // OE_USE_MESSAGE_POOL
+
+            /* The dropped request and the new one use the same register entry. */
+            OE_MessageQueue_removeMessage(MessageQueue, Message);
+
+            return OE_MessageQueue_allocateMessage(MessageQueue);
+
+        case OE_OVERLOAD_COALESCE_LATEST:
+            /* The newest queued request is overwritten in place. */
+            Message = OE_MessageQueue_findRequest(MessageQueue, RequestID, true);
+
+#if OE_USE_MESSAGE_POOL
+            if (Message != NULL)
+            {
+                OE_Core_releaseBlock(Message->Header.Block);
+            }
+#endif // OE_USE_MESSAGE_POOL
+
+            return Message;
+
+        default:
+            return NULL;
+        }
+    }
+#endif // OE_USE_OVERLOAD_POLICY
+
+#if OE_USE_REQUEST_LIMIT
+    if (OE_Core_setRequestEntry(KernelID, RequestID) != OE_ERROR_NONE)
+    {
+        return NULL;
+    }
+#endif // OE_USE_REQUEST_LIMIT
+
+    Message = OE_MessageQueue_allocateMessage(MessageQueue);
+
+#if OE_USE_REQUEST_LIMIT
+    if (Message == NULL)
+    {
+        OE_Core_clearRequestEntry(
+            KernelID,
+            RequestID);
+    }
+#endif // OE_USE_REQUEST_LIMIT
+
+    return Message;
+}
+
+void OE_Core_writeRequest(
+    OE_Message_t *Message,
+    const OE_MessageHeader_t *Header,
+    const void *Parameters,
+    bool Replayed)
+{
+    Message->Header = *Header;
+    Message->Header.Information = OE_MESSAGE_TYPE_REQUEST | OE_MESSAGE_DATA_EMPTY;
+
+#if OE_USE_JOURNAL
+    /* Only the journal marks a request as replayed, so that it is not logged again. */
+    if (Replayed)
+    {
+        Message->Header.Information |= OE_MESSAGE_REPLAYED;
+    }
+#else
+    (void)Replayed;
+#endif // OE_USE_JOURNAL
+
+#if OE_USE_COROUTINES
+    /* The responses keep the tag of the await that sends the request. */
+    if (Header->KernelID < OE_NUMBER_OF_KERNELS)
+    {
+        Message->Header.AwaitTag = OE_AwaitTags[Header->KernelID];
+    }
+#endif // OE_USE_COROUTINES
+
+#if OE_USE_SHARED_CORE
+    /* The receiving process must not call a pointer of the sending process. */
+    Message->Header.ResponseIndex = OE_Core_responseIndex(Header->ResponseHandler);
+    Message->Header.ResponseHandler = OE_NO_HANDLER;
+#endif // OE_USE_SHARED_CORE
+
+#if OE_USE_MESSAGE_POOL
+    /* Each queued message holds a reference. An invalid block is not sent. */
+    if (!OE_Core_retainBlock(Header->Block))
+    {
+        Message->Header.Block = OE_NO_BLOCK;
+    }
+#endif // OE_USE_MESSAGE_POOL
+
+    if (Parameters != NULL)
+    {
+        memcpy(
+            &(Message->Data),
+            Parameters,
+            OE_MESSAGE_DATA_SIZE);
+
+        Message->Header.Information &= ~(OE_MESSAGE_DATA_EMPTY);
+    }
+}
+
+#if OE_USE_MESSAGE_POOL
+void OE_Core_passBlock(
+    OE_MessageHeader_t *Header,
+    OE_Error_t Error)
+{
+    if (Error == OE_ERROR_NONE)
+    {
+        OE_Core_releaseBlock(Header->Block);
+        Header->Block = OE_NO_BLOCK;
+    }
+}
+#endif // OE_USE_MESSAGE_POOL
+
+#if OE_USE_COALESCING
+OE_Message_t* OE_Core_findCoalesced(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const void *Parameters)
+{
+    size_t KeySize = OE_RequestAttributes[RequestID].CoalesceKeySize;
+
+    if (!OE_RequestAttributes[RequestID].Coalesce)
+    {
+        return NULL;
+    }
+
+    /* Without parameters, there is no key to compare. */
+    if (Parameters == NULL)
+    {
+        KeySize = 0;
+    }
+
+    return OE_MessageQueue_findKey(
+        &OE_Core->MessageQueues[KernelID],
+        RequestID,
+        Parameters,
+        KeySize);
+}
+#endif // OE_USE_COALESCING
+
+OE_KernelID_t OE_Core_findShard(
+    OE_RequestID_t RequestID,
+    const void *Parameters)
+{
+#if OE_USE_SHARDING
+    size_t KeySize = OE_RequestAttributes[RequestID].ShardKeySize;
+    const uint8_t *Key = Parameters;
+    OE_KernelID_t ShardID = OE_NO_KERNEL;
+    uint32_t Hash = 2166136261u;
+    uint32_t Weight;
+    uint32_t MaxWeight = 0;
+
+    if (KeySize == 0 || Parameters == NULL)
+    {
+        return OE_NO_KERNEL;
+    }
+
+    /* FNV-1a */
+    for (size_t Index = 0; Index < KeySize; Index++)
+    {
+        Hash ^= Key[Index];
+        Hash *= 16777619u;
+    }
+
+    /**
+     * Rendezvous hashing: Each kernel that would receive the request gets a weight
+     * from the key and its ID, the heaviest one is the shard. If a kernel subscribes
+     * or unsubscribes, only the keys of this kernel move.
+     */
+    for (OE_KernelID_t KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+    {
+        if (!OE_Core_isReceiver(KernelID, RequestID, OE_NO_KERNEL, Parameters))
+        {
+            continue;
+        }
+
+        /* The finalizer of MurmurHash3 mixes the kernel ID into the key hash. */
+        Weight = Hash ^ ((uint32_t)KernelID * 0x9E3779B9u);
+        Weight ^= Weight >> 16;
+        Weight *= 0x85EBCA6Bu;
+        Weight ^= Weight >> 13;
+        Weight *= 0xC2B2AE35u;
+        Weight ^= Weight >> 16;
+
+        if (ShardID == OE_NO_KERNEL || Weight > MaxWeight)
+        {
+            ShardID = KernelID;
+            MaxWeight = Weight;
+        }
+    }
+
+    return ShardID;
+#else
+    (void)RequestID;
+    (void)Parameters;
+
+    return OE_NO_KERNEL;
+#endif // OE_USE_SHARDING
+}
+
+#if OE_USE_REQUEST_FILTERS
+bool OE_Core_filtersMatch(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const void *Parameters)
+{
+    OE_RequestFilters_t *RequestFilters = &OE_Core->RequestFilters[KernelID][RequestID];
+
+    if (RequestFilters->NumberOfFilters == 0)
+    {
+        return true;
+    }
+
+    for (size_t Count = 0; Count < RequestFilters->NumberOfFilters; Count++)
+    {
+        if (OE_RequestFilter_matches(&RequestFilters->Filters[Count], Parameters))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif // OE_USE_REQUEST_FILTERS
+
+bool OE_Core_isReceiver(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    OE_KernelID_t ShardID,
+    const void *Parameters)
+{
+    if (!OE_Core->RequestSubscribed[KernelID][RequestID])
+    {
+        return false;
+    }
+
+    if (ShardID != OE_NO_KERNEL && ShardID != KernelID)
+    {
+        return false;
+    }
+
+#if OE_USE_REQUEST_FILTERS
+    return OE_Core_filtersMatch(
+        KernelID,
+        RequestID,
+        Parameters);
+#else
+    (void)Parameters;
+
+    return true;
+#endif // OE_USE_REQUEST_FILTERS
+}
+
+#if OE_USE_ISR_SEND
+OE_Error_t OE_Core_sendRequestFromISR(
+    size_t SourceID,
+    OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    OE_StagingRing_t *StagingRing;
+    OE_Message_t *Message;
+    OE_KernelID_t KernelID;
+
+    if (SourceID >= OE_NUMBER_OF_ISR_SOURCES)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    if (Header->RequestID >= OE_NUMBER_OF_REQUESTS)
+    {
+        return OE_ERROR_REQUEST_ID_INVALID;
+    }
+
+    StagingRing = &OE_Core->StagingRings[SourceID];
+
+    Message = OE_StagingRing_allocateMessage(StagingRing);
+
+    if (Message == NULL)
+    {
+        return OE_ERROR_MESSAGE_QUEUE_FULL;
+    }
+
+    /* There is no kernel to handle a response. */
+    Message->Header = *Header;
+    Message->Header.Information = OE_MESSAGE_TYPE_REQUEST | OE_MESSAGE_DATA_EMPTY;
+    Message->Header.ResponseHandler = OE_NO_HANDLER;
+#if OE_USE_SHARED_CORE
+    Message->Header.ResponseIndex = OE_NO_RESPONSE_INDEX;
+#endif // OE_USE_SHARED_CORE
+    Message->Header.KernelID = OE_NO_KERNEL;
+#if OE_USE_MESSAGE_POOL
+    /* The staged message took the reference of the sender. */
+    Header->Block = OE_NO_BLOCK;
+#endif // OE_USE_MESSAGE_POOL
+
+    if (Parameters != NULL)
+    {
+        memcpy(
+            &(Message->Data),
+            Parameters,
+            OE_MESSAGE_DATA_SIZE);
+
+        Message->Header.Information &= ~(OE_MESSAGE_DATA_EMPTY);
+    }
+
+    OE_StagingRing_publish(StagingRing);
+
+    /* The subscriptions are only read, a kernel that just subscribed might miss the wakeup. */
+    for (KernelID = 0; KernelID < OE_Core->NumberOfKernels; KernelID++)
+    {
+        if (OE_Core->RequestSubscribed[KernelID][Header->RequestID])
+        {
+            OE_RESUME(KernelID);
+        }
+    }
+
+    return OE_ERROR_NONE;
+}
+
+void OE_Core_mergeStagingRings(void)
+{
+    OE_StagingRing_t *StagingRing;
+    OE_Message_t *Message;
+    OE_Error_t Error;
+    bool Merging;
+#if OE_USE_MESSAGE_POOL
+    OE_Block_t Block;
+#endif // OE_USE_MESSAGE_POOL
+
+    for (size_t SourceID = 0; SourceID < OE_NUMBER_OF_ISR_SOURCES; SourceID++)
+    {
+        StagingRing = &OE_Core->StagingRings[SourceID];
+
+        /* Most of the time there is nothing to merge. */
+        if (OE_StagingRing_peekMessage(StagingRing) == NULL)
+        {
+            continue;
+        }
+
+        OE_ENTER_CRITICAL();
+        Merging = StagingRing->Merging;
+        StagingRing->Merging = true;
+        OE_EXIT_CRITICAL();
+
+        /* Another kernel is already merging this ring. */
+        if (Merging)
+        {
+            continue;
+        }
+
+        while ((Message = OE_StagingRing_peekMessage(StagingRing)) != NULL)
+        {
+            Error = OE_Core_trySendRequest(
+                OE_NO_KERNEL,
+                &Message->Header,
+                (Message->Header.Information & OE_MESSAGE_DATA_EMPTY) ? NULL : Message->Data,
+                true,
+                false);
+
+            /* Keep the request staged until there is room. */
+            if (Error == OE_ERROR_MESSAGE_QUEUE_FULL || Error == OE_ERROR_REQUEST_LIMIT_REACHED)
+            {
+                break;
+            }
+
+#if OE_USE_MESSAGE_POOL
+            /* The ISR may reuse the slot once it is removed. */
+            Block = Message->Header.Block;
+            OE_StagingRing_removeMessage(StagingRing);
+            OE_Core_releaseBlock(Block);
+#else
+            OE_StagingRing_removeMessage(StagingRing);
+#endif // OE_USE_MESSAGE_POOL
+        }
+
+        OE_ENTER_CRITICAL();
+        StagingRing->Merging = false;
+        OE_EXIT_CRITICAL();
+    }
+}
+#endif // OE_USE_ISR_SEND
+
+OE_Error_t OE_Core_sendResponse(
+    OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    OE_Message_t *Message = NULL;
+
+    if (Header->KernelID >= OE_NUMBER_OF_KERNELS)
+    {
+        return OE_ERROR_KERNEL_ID_INVALID;
+    }
+
+    if (Header->RequestID >= OE_NUMBER_OF_REQUESTS)
+    {
+        return OE_ERROR_REQUEST_ID_INVALID;
+    }
+
+#if OE_USE_SHARED_CORE
+    /* The header of a queued request only holds the index of the response handler. */
+    if (Header->ResponseIndex == OE_NO_RESPONSE_INDEX)
+#else
+    if (Header->ResponseHandler == NULL)
+#endif // OE_USE_SHARED_CORE
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    OE_ENTER_CRITICAL();
+
+    Message = OE_MessageQueue_allocateMessage(
+        &OE_Core->MessageQueues[Header->KernelID]);
+
+    if (Message == NULL)
+    {
+        OE_EXIT_CRITICAL();
+        return OE_ERROR_MESSAGE_QUEUE_FULL;
+    }
+
+    Message->Header = *Header;
+    Message->Header.Information = OE_MESSAGE_DATA_EMPTY;
+#if OE_USE_MESSAGE_POOL
+    /* The block belongs to the request. */
+    Message->Header.Block = OE_NO_BLOCK;
+#endif // OE_USE_MESSAGE_POOL
+
+    if (Parameters != NULL)
+    {
+        memcpy(
+            &(Message->Data),
+            Parameters,
+            OE_MESSAGE_DATA_SIZE);
+
+        Message->Header.Information &= ~(OE_MESSAGE_DATA_EMPTY);
+    }
+
+#if OE_USE_MESSAGE_STATISTICS
+    OE_Core_countMessage(
+        OE_Core_responderOf(Header),
+        Header->RequestID,
+        Header->KernelID,
+        Message->Header.Information);
+#endif // OE_USE_MESSAGE_STATISTICS
+
+    OE_RESUME(Header->KernelID);
+
+    OE_EXIT_CRITICAL();
+    return OE_ERROR_NONE;
+}
+
+OE_Message_t *OE_Core_getMessage(
+    OE_KernelID_t KernelID)
+{
+    OE_Message_t *Message;
+    OE_Kernel_t *Kernel = OE_Kernels[KernelID];
+
+#if OE_USE_ISR_SEND
+    OE_Core_mergeStagingRings();
+#endif // OE_USE_ISR_SEND
+    
     OE_ENTER_CRITICAL();
+
+    /* The kernel is done with the previous message. */
+    if (Kernel->Epoch & 1)
+    {
+        Kernel->Epoch++;
+    }
     
     Message = OE_MessageQueue_getMessage(
         &OE_Core->MessageQueues[KernelID]);
@@ -390,6 +1615,9 @@ OE_Message_t *OE_Core_getMessage(
         OE_EXIT_CRITICAL();
         return NULL;
     }
+
+    /* The kernel handles a message until it asks for the next one. */
+    Kernel->Epoch++;
     
 #if OE_USE_REQUEST_LIMIT
     /* If the message contains a request, we need to clear the request entry. */
@@ -405,6 +1633,18 @@ OE_Message_t *OE_Core_getMessage(
     return Message;
 }
 
+#if OE_USE_COROUTINES
+void OE_Core_setAwaitTag(
+    OE_KernelID_t KernelID,
+    OE_AwaitTag_t AwaitTag)
+{
+    if (KernelID < OE_NUMBER_OF_KERNELS)
+    {
+        OE_AwaitTags[KernelID] = AwaitTag;
+    }
+}
+#endif // OE_USE_COROUTINES
+
 OE_Error_t OE_Core_subscribeRequest(
     OE_KernelID_t KernelID,
     OE_RequestID_t RequestID)
@@ -419,13 +1659,52 @@ OE_Error_t OE_Core_subscribeRequest(
         return OE_ERROR_REQUEST_ID_INVALID;
     }
 
-    OE_ENTER_CRITICAL();
+    /* The request map holds the critical section. */
     OE_Core->RequestSubscribed[KernelID][RequestID] = true;
-    OE_EXIT_CRITICAL();
 
     return OE_ERROR_NONE;
 }
 
+#if OE_USE_REQUEST_FILTERS
+OE_Error_t OE_Core_filterRequest(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const OE_RequestFilter_t *Filters,
+    size_t NumberOfFilters)
+{
+    OE_RequestFilters_t *RequestFilters;
+
+    if (KernelID >= OE_NUMBER_OF_KERNELS)
+    {
+        return OE_ERROR_KERNEL_ID_INVALID;
+    }
+
+    if (RequestID >= OE_NUMBER_OF_REQUESTS)
+    {
+        return OE_ERROR_REQUEST_ID_INVALID;
+    }
+
+    if (NumberOfFilters > OE_REQUEST_HANDLER_LIMIT)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    RequestFilters = &OE_Core->RequestFilters[KernelID][RequestID];
+
+    /* The request map holds the critical section. */
+    if (NumberOfFilters > 0)
+    {
+        memcpy(
+            RequestFilters->Filters,
+            Filters,
+            sizeof(OE_RequestFilter_t) * NumberOfFilters);
+    }
+    RequestFilters->NumberOfFilters = NumberOfFilters;
+
+    return OE_ERROR_NONE;
+}
+#endif // OE_USE_REQUEST_FILTERS
+
 OE_Error_t OE_Core_unsubscribeRequest(
     OE_KernelID_t KernelID,
     OE_RequestID_t RequestID)
@@ -440,14 +1719,105 @@ OE_Error_t OE_Core_unsubscribeRequest(
         return OE_ERROR_REQUEST_ID_INVALID;
     }
 
-    OE_ENTER_CRITICAL();
+    /* The request map holds the critical section. */
     OE_Core->RequestSubscribed[KernelID][RequestID] = false;
-    OE_EXIT_CRITICAL();
 
     return OE_ERROR_NONE;
 }
 
+#if OE_USE_SHARED_CORE
+void OE_Core_attach(
+    module_OE_Core_t *pOE_Core)
+{
+    OE_Core = pOE_Core;
+
+    /* The kernels and response handlers of another process are unknown here. */
+    for (OE_KernelID_t KernelID = 0; KernelID < OE_NUMBER_OF_KERNELS; KernelID++)
+    {
+        OE_Kernels[KernelID] = NULL;
+    }
+
+    OE_NumberOfResponseHandlers = 0;
+}
+
+OE_MessageHandler_t OE_Core_getResponseHandler(
+    OE_ResponseIndex_t ResponseIndex)
+{
+    if (ResponseIndex == OE_NO_RESPONSE_INDEX || ResponseIndex > OE_NumberOfResponseHandlers)
+    {
+        return OE_NO_HANDLER;
+    }
+
+    return OE_ResponseHandlers[ResponseIndex - 1];
+}
+
+bool OE_Core_addResponseHandler(
+    OE_MessageHandler_t ResponseHandler)
+{
+    bool Added = true;
+
+    if (ResponseHandler == OE_NO_HANDLER ||
+        OE_Core_responseIndex(ResponseHandler) != OE_NO_RESPONSE_INDEX)
+    {
+        return true;
+    }
+
+    /* Another thread of this process may add the handler meanwhile. */
+    OE_ENTER_CRITICAL();
+
+    if (OE_Core_responseIndex(ResponseHandler) == OE_NO_RESPONSE_INDEX)
+    {
+        if (OE_NumberOfResponseHandlers < OE_RESPONSE_HANDLER_LIMIT)
+        {
+            OE_ResponseHandlers[OE_NumberOfResponseHandlers] = ResponseHandler;
+            /* The kernels read the table without locking it. */
+            OE_MEMORY_BARRIER();
+            OE_NumberOfResponseHandlers++;
+        }
+        else
+        {
+            Added = false;
+        }
+    }
+
+    OE_EXIT_CRITICAL();
+    return Added;
+}
+
+OE_ResponseIndex_t OE_Core_responseIndex(
+    OE_MessageHandler_t ResponseHandler)
+{
+    size_t NumberOfResponseHandlers = OE_NumberOfResponseHandlers;
+
+    if (ResponseHandler == OE_NO_HANDLER)
+    {
+        return OE_NO_RESPONSE_INDEX;
+    }
+
+    for (size_t Index = 0; Index < NumberOfResponseHandlers; Index++)
+    {
+        if (OE_ResponseHandlers[Index] == ResponseHandler)
+        {
+            return (OE_ResponseIndex_t)(Index + 1);
+        }
+    }
+
+    return OE_NO_RESPONSE_INDEX;
+}
+#endif // OE_USE_SHARED_CORE
+
 #if OE_USE_REQUEST_LIMIT
+size_t OE_Core_requestLimit(
+    OE_RequestID_t RequestID)
+{
+    if (OE_RequestAttributes[RequestID].RequestLimit > 0)
+    {
+        return OE_RequestAttributes[RequestID].RequestLimit;
+    }
+
+    return OE_REQUEST_LIMIT;
+}
+
 bool OE_Core_registerFull(
     OE_KernelID_t KernelID,
     OE_RequestID_t RequestID)
@@ -456,7 +1826,7 @@ bool OE_Core_registerFull(
 
     RequestEntry = &OE_Core->RequestRegisters[KernelID][RequestID];
 
-    if (RequestEntry->NumberOfRequests >= RequestEntry->RequestLimit)
+    if (RequestEntry->NumberOfRequests >= OE_Core_requestLimit(RequestID))
     {
         return true;
     }
@@ -474,7 +1844,7 @@ OE_Error_t OE_Core_setRequestEntry(
     RequestEntry = &OE_Core->RequestRegisters[KernelID][RequestID];
 
     /* Check if the register is full. */
-    if (RequestEntry->NumberOfRequests >= RequestEntry->RequestLimit)
+    if (RequestEntry->NumberOfRequests >= OE_Core_requestLimit(RequestID))
     {
         return OE_ERROR_REQUEST_LIMIT_REACHED;
     }
@@ -497,5 +1867,237 @@ void OE_Core_clearRequestEntry(
     }
 }
 #endif // OE_USE_REQUEST_LIMIT
+
+#if OE_USE_RATE_LIMIT
+uint32_t OE_Core_rateBurst(
+    OE_RequestID_t RequestID)
+{
+    if (OE_RequestAttributes[RequestID].RateBurst > 0)
+    {
+        return OE_RequestAttributes[RequestID].RateBurst;
+    }
+
+    return OE_RequestAttributes[RequestID].RateLimit;
+}
+
+bool OE_Core_takeToken(
+    OE_RequestID_t RequestID)
+{
+    const OE_RequestAttributes_t *Attributes = &OE_RequestAttributes[RequestID];
+    OE_RateBucket_t *Bucket = &OE_Core->RateBuckets[RequestID];
+    uint32_t Now, Period, Periods, Missing;
+
+    if (Attributes->RateLimit == 0)
+    {
+        return true;
+    }
+
+    /* Add the tokens of all passed rate periods. The tick counter may wrap around. */
+    Now = (uint32_t)OE_GET_TICKS();
+    Period = (Attributes->RatePeriod > 0) ? Attributes->RatePeriod : 1;
+    Periods = (Now - Bucket->LastRefill) / Period;
+
+    if (Periods > 0)
+    {
+        Missing = OE_Core_rateBurst(RequestID) - Bucket->Tokens;
+
+        if (Periods > Missing / Attributes->RateLimit)
+        {
+            /* The bucket is full, the remaining time is not needed. */
+            Bucket->Tokens += Missing;
+            Bucket->LastRefill = Now;
+        }
+        else
+        {
+            Bucket->Tokens += Periods * Attributes->RateLimit;
+            Bucket->LastRefill += Periods * Period;
+        }
+    }
+
+    if (Bucket->Tokens == 0)
+    {
+        return false;
+    }
+
+    Bucket->Tokens--;
+
+    return true;
+}
+#endif // OE_USE_RATE_LIMIT
+
+#if OE_USE_MESSAGE_STATISTICS
+OE_Error_t OE_Core_getMessageStatistics(
+    OE_KernelID_t SenderID,
+    OE_RequestID_t RequestID,
+    OE_KernelID_t ReceiverID,
+    OE_MessageStatistics_t *Statistics)
+{
+    if (SenderID == OE_NO_KERNEL)
+    {
+        /* Unknown senders are counted in the last row. */
+        SenderID = OE_NUMBER_OF_KERNELS;
+    }
+    else if (SenderID >= OE_NUMBER_OF_KERNELS)
+    {
+        return OE_ERROR_KERNEL_ID_INVALID;
+    }
+
+    if (ReceiverID >= OE_NUMBER_OF_KERNELS)
+    {
+        return OE_ERROR_KERNEL_ID_INVALID;
+    }
+
+    if (RequestID >= OE_NUMBER_OF_REQUESTS)
+    {
+        return OE_ERROR_REQUEST_ID_INVALID;
+    }
+
+    if (Statistics == NULL)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    OE_ENTER_CRITICAL();
+    *Statistics = OE_Core->MessageStatistics[SenderID][RequestID][ReceiverID];
+    OE_EXIT_CRITICAL();
+
+    return OE_ERROR_NONE;
+}
+
+void OE_Core_exportMessageStatistics(
+    OE_StatisticsCallback_t Callback,
+    void *Context)
+{
+    OE_MessageStatistics_t Statistics;
+
+    if (Callback == NULL)
+    {
+        return;
+    }
+
+    for (size_t SenderID = 0; SenderID <= OE_NUMBER_OF_KERNELS; SenderID++)
+    {
+        for (OE_RequestID_t RequestID = 0; RequestID < OE_NUMBER_OF_REQUESTS; RequestID++)
+        {
+            for (OE_KernelID_t ReceiverID = 0; ReceiverID < OE_NUMBER_OF_KERNELS; ReceiverID++)
+            {
+                /* Copy the entry so that the callback can take its time. */
+                OE_ENTER_CRITICAL();
+                Statistics = OE_Core->MessageStatistics[SenderID][RequestID][ReceiverID];
+                OE_EXIT_CRITICAL();
+
+                if (Statistics.Requests == 0 && Statistics.Responses == 0)
+                {
+                    continue;
+                }
+
+                Callback(
+                    (SenderID == OE_NUMBER_OF_KERNELS) ? OE_NO_KERNEL : (OE_KernelID_t)SenderID,
+                    RequestID,
+                    ReceiverID,
+                    &Statistics,
+                    Context);
+            }
+        }
+    }
+}
+
+void OE_Core_resetMessageStatistics(void)
+{
+    OE_ENTER_CRITICAL();
+    memset(OE_Core->MessageStatistics, 0, sizeof(OE_Core->MessageStatistics));
+    OE_EXIT_CRITICAL();
+}
+
+void OE_Core_countMessage(
+    OE_KernelID_t SenderID,
+    OE_RequestID_t RequestID,
+    OE_KernelID_t ReceiverID,
+    OE_MessageInformation_t Information)
+{
+    OE_MessageStatistics_t *Statistics;
+
+    if (SenderID >= OE_NUMBER_OF_KERNELS)
+    {
+        /* Unknown senders are counted in the last row. */
+        SenderID = OE_NUMBER_OF_KERNELS;
+    }
+
+    Statistics = &OE_Core->MessageStatistics[SenderID][RequestID][ReceiverID];
+
+    if (Information & OE_MESSAGE_TYPE_REQUEST)
+    {
+        Statistics->Requests++;
+    }
+    else
+    {
+        Statistics->Responses++;
+    }
+
+    if (!(Information & OE_MESSAGE_DATA_EMPTY))
+    {
+        Statistics->Bytes += OE_MESSAGE_DATA_SIZE;
+    }
+}
+
+OE_KernelID_t OE_Core_responderOf(
+    const OE_MessageHeader_t *Header)
+{
+    uintptr_t Address = (uintptr_t)Header;
+    uintptr_t Begin;
+
+    for (OE_KernelID_t KernelID = 0; KernelID < OE_NUMBER_OF_KERNELS; KernelID++)
+    {
+        Begin = (uintptr_t)OE_Core->MessageQueues[KernelID].Messages;
+
+        if (Address >= Begin && Address < Begin + sizeof(OE_Core->MessageQueues[KernelID].Messages))
+        {
+            return KernelID;
+        }
+    }
+
+    return OE_CURRENT_KERNEL();
+}
+#endif // OE_USE_MESSAGE_STATISTICS
+
+#if OE_USE_MESSAGE_POOL
+OE_Block_t OE_Core_allocateBlock(
+    size_t Size)
+{
+    return OE_MessagePool_allocate(
+        &OE_Core->MessagePool,
+        Size);
+}
+
+void *OE_Core_getBlock(
+    OE_Block_t Block,
+    size_t *Size)
+{
+    if (Size != NULL)
+    {
+        *Size = OE_MessagePool_getSize(&OE_Core->MessagePool, Block);
+    }
+
+    return OE_MessagePool_getData(
+        &OE_Core->MessagePool,
+        Block);
+}
+
+bool OE_Core_retainBlock(
+    OE_Block_t Block)
+{
+    return OE_MessagePool_retain(
+        &OE_Core->MessagePool,
+        Block);
+}
+
+void OE_Core_releaseBlock(
+    OE_Block_t Block)
+{
+    OE_MessagePool_release(
+        &OE_Core->MessagePool,
+        Block);
+}
+#endif // OE_USE_MESSAGE_POOL
 /* USER CODE MODULE FUNCTIONS END */
 
@@ -21,7 +21,7 @@
 /**
  * @brief This file describes the core. The core is responsible for
  * receiving messages and forwarding them to the correct kernels. It also checks
- * the request limit for each request. The core holds one message queue
+ * the request limit and the rate limit for each request. The core holds one message queue
  * for each kernel and sends messages addressed to a kernel to its queue.
  */
 /* USER CODE FILE INTRODUCTION END */
@@ -35,6 +35,7 @@
 /* Includes, typedefs, globals, etc. */
 /* USER CODE MODULE GLOBALS BEGIN */
 #include "oe_message_queue.h"
+#include "oe_message_pool.h"
 /* USER CODE MODULE GLOBALS END */
 
 //~~~~~~~~~~~~~~~~~~~~~~~~ Module definition ~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -46,12 +47,19 @@ typedef struct module_OE_Core_s {
     /* Module data. */
     /* USER CODE MODULE DATA BEGIN */
     /* Kernel connections */
+#if !OE_USE_SHARED_CORE
     OE_Kernel_t *Kernels[OE_NUMBER_OF_KERNELS];
+#endif // OE_USE_SHARED_CORE
     size_t NumberOfKernels;
     
     /* Request subscriptions */
     bool RequestSubscribed[OE_NUMBER_OF_KERNELS][OE_NUMBER_OF_REQUESTS];
 
+#if OE_USE_REQUEST_FILTERS
+    /* The filters of the handlers of each kernel, see OE_Kernel_registerFilteredHandlers(). */
+    OE_RequestFilters_t RequestFilters[OE_NUMBER_OF_KERNELS][OE_NUMBER_OF_REQUESTS];
+#endif // OE_USE_REQUEST_FILTERS
+
 #if OE_USE_REQUEST_LIMIT
     /**
      * The request register serves to keep track of how many requests are queued at a time.
@@ -60,8 +68,31 @@ typedef struct module_OE_Core_s {
     OE_RequestRegisterEntry_t RequestRegisters[OE_NUMBER_OF_KERNELS][OE_NUMBER_OF_REQUESTS];
 #endif // OE_USE_REQUEST_LIMIT
 
+#if OE_USE_RATE_LIMIT
+    /* There is one token bucket for each request ID, shared by all senders. */
+    OE_RateBucket_t RateBuckets[OE_NUMBER_OF_REQUESTS];
+#endif // OE_USE_RATE_LIMIT
+
+#if OE_USE_MESSAGE_STATISTICS
+    /**
+     * The message statistics count the traffic between the kernels. The first index is the
+     * sending kernel. The additional last row counts messages from unknown senders.
+     */
+    OE_MessageStatistics_t MessageStatistics[OE_NUMBER_OF_KERNELS + 1][OE_NUMBER_OF_REQUESTS][OE_NUMBER_OF_KERNELS];
+#endif // OE_USE_MESSAGE_STATISTICS
+
     /* Message queues */
     OE_MessageQueue_t MessageQueues[OE_NUMBER_OF_KERNELS];
+
+#if OE_USE_MESSAGE_POOL
+    /* The blocks for payloads that do not fit into the message data. */
+    OE_MessagePool_t MessagePool;
+#endif // OE_USE_MESSAGE_POOL
+
+#if OE_USE_ISR_SEND
+    /* Each ISR source stages its requests in its own ring. */
+    OE_StagingRing_t StagingRings[OE_NUMBER_OF_ISR_SOURCES];
+#endif // OE_USE_ISR_SEND
     /* USER CODE MODULE DATA END */
 
 } module_OE_Core_t;
@@ -75,6 +106,10 @@ typedef struct module_OE_Core_s {
  * and connects the module to the kernel. It then calls 
  * the specific init function of the module.
  * 
+ * With OE_USE_FAST_BOOT the core has to be in zero-initialized
+ * static storage, e.g. a static variable or a new shared core.
+ * The message queues and subscriptions are not cleared.
+ * 
  * @param OE_Core A pointer to the module to be initialized.
  * @param Args A pointer to the init params for the module.
  * @param Kernel A pointer to the kernel to be connected.
@@ -101,6 +136,33 @@ OE_Error_t initModule_OE_Core(
 OE_Error_t OE_Core_connectKernel(
     OE_Kernel_t *Kernel);
 
+#if OE_USE_SHARED_CORE
+/**
+ * @brief Use a core that was initialized by another process.
+ *
+ * The core is not initialized again. The kernels and response handlers this
+ * process knows are reset, so the function has to be called before the kernels
+ * of this process are connected. OE_SharedCore_attach() calls this function.
+ *
+ * @param pOE_Core Pointer to the core in shared memory.
+ */
+void OE_Core_attach(
+    module_OE_Core_t *pOE_Core);
+
+/**
+ * @brief Get the response handler of a queued message.
+ *
+ * The index is only valid in the process that sent the request. This is the
+ * process of the kernel that receives the response.
+ *
+ * @param ResponseIndex The response index of the message header.
+ * @return OE_MessageHandler_t The response handler is returned.
+ * If the index is unknown in this process, OE_NO_HANDLER is returned.
+ */
+OE_MessageHandler_t OE_Core_getResponseHandler(
+    OE_ResponseIndex_t ResponseIndex);
+#endif // OE_USE_SHARED_CORE
+
 /**
  * @brief Send a request message to the core.
  *
@@ -109,12 +171,35 @@ OE_Error_t OE_Core_connectKernel(
  * It then allocates a message in each message queue and copies
  * the given data. A valid message header has to be provided.
  *
+ * If OE_USE_OVERLOAD_POLICY is set, the overload policy of the request decides
+ * what happens if a message queue is full or the request limit is reached:
+ * the request is rejected, replaces a queued message of the same request or
+ * waits for room until the block timeout has passed.
+ *
+ * If OE_USE_COALESCING is set and the request is coalesced, a queued request of
+ * the same type and key that has not been handled yet is overwritten instead of
+ * queueing another message.
+ *
+ * If OE_USE_REQUEST_FILTERS is set, a kernel only receives the request if one
+ * of the filters of its handlers matches.
+ *
+ * If OE_USE_SHARDING is set and the request is sharded, only one of the kernels
+ * that would receive the request gets it. It is chosen by the hash of the shard key.
+ *
+ * If OE_USE_MESSAGE_POOL is set, the header can carry a block of the message pool.
+ * If the request is sent, the sender's reference to the block is passed on and the
+ * block is cleared from the header. Otherwise the sender keeps its reference and the
+ * header its block, so that the request can be sent again or the block released.
+ * Each queued message takes a reference, which is released after the receiving
+ * kernel has handled the message or when the message is dropped or overwritten.
+ *
  * @param Header Pointer to the message header.
  * @param Parameters Pointer to the paramters transported in the message.
  * @return OE_Error_t An error is returned if
  * - the kernel ID is invalid.
  * - the request ID is invalid.
  * - the request register is full.
+ * - the rate limit of the request is reached.
  * - the message queue is full.
  * Otherwise OE_ERROR_NONE is returned.
  */
@@ -122,13 +207,112 @@ OE_Error_t OE_Core_sendRequest(
     OE_MessageHeader_t *Header,
     const void *Parameters);
 
+/**
+ * @brief Send a request message to one kernel.
+ *
+ * This function works like OE_Core_sendRequest(), but only the given kernel
+ * receives the request. The subscriptions of the other kernels are not checked
+ * and the shard key of a sharded request is ignored.
+ *
+ * @param ReceiverID The ID of the receiving kernel.
+ * @param Header Pointer to the message header.
+ * @param Parameters Pointer to the paramters transported in the message.
+ * @return OE_Error_t An error is returned if
+ * - the kernel ID is invalid.
+ * - the request ID is invalid.
+ * - the kernel does not subscribe the request or its filters reject it.
+ * - the request register is full.
+ * - the rate limit of the request is reached.
+ * - the message queue is full.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Core_sendRequestTo(
+    OE_KernelID_t ReceiverID,
+    OE_MessageHeader_t *Header,
+    const void *Parameters);
+
+/**
+ * @brief Send a batch of request messages to the core.
+ *
+ * The batch is sent with one critical section. Either all requests are queued
+ * or none is. Each receiving kernel is resumed once. The requests of the batch
+ * are queued in the order of the array. Coalescing and overload policies are
+ * not taken into account when checking for room, and the batch never blocks.
+ * The blocks the headers carry are passed on like in OE_Core_sendRequest().
+ *
+ * @param Headers Array of message headers.
+ * @param Parameters Array of pointers to the parameters of each request.
+ * The array or single entries may be NULL for requests without parameters.
+ * @param Count The number of requests in the batch.
+ * @return OE_Error_t An error is returned if
+ * - a request ID is invalid.
+ * - a request register is full.
+ * - the rate limit of a request is reached.
+ * - a message queue is full.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Core_sendRequests(
+    OE_MessageHeader_t *Headers,
+    const void *const *Parameters,
+    size_t Count);
+
+#if OE_USE_JOURNAL
+/**
+ * @brief Send a request that the journal replays.
+ *
+ * This function works like OE_Core_sendRequest(), but the queued messages are
+ * marked with OE_MESSAGE_REPLAYED and the sender never waits. It is meant for
+ * OE_Journal_replay(). The core does not take the mark from the headers of
+ * other senders.
+ *
+ * @param Header Pointer to the message header.
+ * @param Parameters Pointer to the paramters transported in the message.
+ * @return OE_Error_t See OE_Core_sendRequest().
+ */
+OE_Error_t OE_Core_replayRequest(
+    OE_MessageHeader_t *Header,
+    const void *Parameters);
+#endif // OE_USE_JOURNAL
+
+#if OE_USE_ISR_SEND
+/**
+ * @brief Send a request message from an ISR.
+ *
+ * The message is copied into the staging ring of the ISR source without entering
+ * a critical section. The kernels that subscribe the request are resumed and merge
+ * the staged requests into the message queues the next time OE_Core_getMessage()
+ * is called. The requests of one source are delivered in the order they were sent.
+ *
+ * Each source must only be used by one ISR or by ISRs that do not preempt each other.
+ * Requests sent from an ISR do not get a response. A staged request that cannot be
+ * merged stays in the ring until there is room, unless it is rejected for another
+ * reason (e.g. the rate limit), in which case it is dropped.
+ *
+ * A block of the message pool is passed on like in OE_Core_sendRequest().
+ *
+ * @param SourceID The ID of the ISR source.
+ * @param Header Pointer to the message header.
+ * @param Parameters Pointer to the paramters transported in the message.
+ * @return OE_Error_t An error is returned if
+ * - the source ID is invalid.
+ * - the request ID is invalid.
+ * - the staging ring is full.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Core_sendRequestFromISR(
+    size_t SourceID,
+    OE_MessageHeader_t *Header,
+    const void *Parameters);
+#endif // OE_USE_ISR_SEND
+
 /**
  * @brief Send a response message to the core.
  *
  * This function sends a response message to the core.
  * The core allocates a message in the message queue of the
  * destination kernel and writes the the given data. A valid message
- * header has to be provided.
+ * header has to be provided. The block of a request header is not copied
+ * into the response.
  *
  * @param Header Pointer to the message header.
  * @param Parameters Pointer to the paramters transported in the message.
@@ -148,6 +332,7 @@ OE_Error_t OE_Core_sendResponse(
  *
  * This method is called inside the kernel main routine.
  * It is used to get the next message from the message queue.
+ * The call also marks the end of the previous message for OE_Kernel_synchronize().
  *
  * @param KernelID The ID of the kernel that calls the function.
  * @return OE_Message_t* A pointer to the next message is returned.
@@ -156,8 +341,54 @@ OE_Error_t OE_Core_sendResponse(
 OE_Message_t* OE_Core_getMessage(
     OE_KernelID_t KernelID);
 
+#if OE_USE_COROUTINES
+/**
+ * @brief Tag the requests whose responses go to a kernel.
+ *
+ * Until the tag is reset, each request sent with the kernel ID of the given kernel
+ * carries the tag, and so do its responses. The awaits of coroutines use this to
+ * tell their responses apart (see oe_coroutine.h). The tags are kept in each
+ * process, since only the kernel itself tags its requests.
+ *
+ * @param KernelID The ID of the kernel that sends the requests.
+ * @param AwaitTag The tag. OE_NO_AWAIT_TAG stops tagging the requests.
+ */
+void OE_Core_setAwaitTag(
+    OE_KernelID_t KernelID,
+    OE_AwaitTag_t AwaitTag);
+#endif // OE_USE_COROUTINES
+
+#if OE_USE_REQUEST_FILTERS
+/**
+ * @brief Set the request filters of a kernel.
+ *
+ * A subscribed request is only queued for the kernel if one of the filters
+ * matches. This function is called by the request map whenever the handlers
+ * of a request change. The caller has to hold the critical section.
+ *
+ * @param KernelID The ID of the kernel that subscribes the request.
+ * @param RequestID The ID of the subscribed request.
+ * @param Filters Pointer to the array of filters. If there are no filters, the
+ * kernel receives every request.
+ * @param NumberOfFilters The number of filters, at most OE_REQUEST_HANDLER_LIMIT.
+ * @return OE_Error_t An error is returned if
+ * - the kernel ID is invalid.
+ * - the request ID is invalid.
+ * - there are too many filters.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Core_filterRequest(
+    OE_KernelID_t KernelID,
+    OE_RequestID_t RequestID,
+    const OE_RequestFilter_t *Filters,
+    size_t NumberOfFilters);
+#endif // OE_USE_REQUEST_FILTERS
+
 /**
  * @brief Enables the subscription of a request by a kernel.
+ *
+ * The caller has to hold the critical section. The request map does so while it
+ * registers handlers, so a sender never sees a subscription without handlers.
  * 
  * @param KernelID The ID of the kernel that subscribes the request. 
  * @param RequestID The ID of the request to be subscribed.
@@ -172,6 +403,8 @@ OE_Error_t OE_Core_subscribeRequest(
 
 /**
  * @brief Disables the subscription of a request by a kernel.
+ *
+ * The caller has to hold the critical section.
  * 
  * @param KernelID The ID of the kernel that unsubscribes the request. 
  * @param RequestID The ID of the request to be unsubscribed.
@@ -183,6 +416,95 @@ OE_Error_t OE_Core_subscribeRequest(
 OE_Error_t OE_Core_unsubscribeRequest(
     OE_KernelID_t KernelID,
     OE_RequestID_t RequestID);
+
+#if OE_USE_MESSAGE_STATISTICS
+/**
+ * @brief Read one entry of the message statistics.
+ *
+ * @param SenderID The ID of the sending kernel. Use OE_NO_KERNEL
+ * to read the messages of unknown senders.
+ * @param RequestID The ID of the request.
+ * @param ReceiverID The ID of the receiving kernel.
+ * @param Statistics Pointer to the memory the entry is copied to.
+ * @return OE_Error_t An error is returned if
+ * - one of the kernel IDs is invalid.
+ * - the request ID is invalid.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Core_getMessageStatistics(
+    OE_KernelID_t SenderID,
+    OE_RequestID_t RequestID,
+    OE_KernelID_t ReceiverID,
+    OE_MessageStatistics_t *Statistics);
+
+/**
+ * @brief Export the message statistics.
+ *
+ * The callback is called for each entry that counted at least one message.
+ * Each entry is copied inside a critical section, the callback itself is
+ * called outside of it. The Systembuilder command export-flow-graph reads the
+ * statistics as CSV lines "sender,request,receiver,requests,responses,bytes".
+ *
+ * @param Callback The function that is called for each entry.
+ * @param Context A pointer that is passed to the callback.
+ */
+void OE_Core_exportMessageStatistics(
+    OE_StatisticsCallback_t Callback,
+    void *Context);
+
+/**
+ * @brief Reset all message statistics to zero.
+ */
+void OE_Core_resetMessageStatistics(void);
+#endif // OE_USE_MESSAGE_STATISTICS
+
+#if OE_USE_MESSAGE_POOL
+/**
+ * @brief Allocate a block of the message pool, see OE_MessagePool_allocate().
+ *
+ * The caller holds the first reference to the block. It passes the reference on by
+ * sending the block with a request, or gives it back with OE_Core_releaseBlock().
+ * A request that could not be sent leaves the reference with the caller.
+ *
+ * @param Size The number of bytes that are needed.
+ * @return OE_Block_t The handle of the block is returned. Returns OE_NO_BLOCK if
+ * no class that fits has a free block.
+ */
+OE_Block_t OE_Core_allocateBlock(
+    size_t Size);
+
+/**
+ * @brief Get the memory of a block of the message pool.
+ *
+ * @param Block The handle of the block.
+ * @param Size Pointer to the memory the size of the block is written to. May be NULL.
+ * @return void* The pointer to the memory of the block is returned. Returns NULL if
+ * the handle is invalid.
+ */
+void *OE_Core_getBlock(
+    OE_Block_t Block,
+    size_t *Size);
+
+/**
+ * @brief Take another reference to a block of the message pool.
+ *
+ * A request handler can keep the block of its request after it has returned this way.
+ *
+ * @param Block The handle of the block.
+ * @return true The reference was taken.
+ * @return false The handle is invalid.
+ */
+bool OE_Core_retainBlock(
+    OE_Block_t Block);
+
+/**
+ * @brief Release a reference to a block of the message pool.
+ *
+ * @param Block The handle of the block. OE_NO_BLOCK is ignored.
+ */
+void OE_Core_releaseBlock(
+    OE_Block_t Block);
+#endif // OE_USE_MESSAGE_POOL
 /* USER CODE MODULE PROTOTYPES END */
 
 #endif // OE_CORE_MOD_H
\ No newline at end of file
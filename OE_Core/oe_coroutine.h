@@ -0,0 +1,162 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_COROUTINE_H
+#define OE_COROUTINE_H
+
+/**
+ * @brief This is the header file of the coroutines. A coroutine lets a request handler
+ * send a request and continue where it left off once the response arrives, instead of
+ * splitting its logic into a request and a response handler.
+ *
+ * The coroutines are stackless (protothreads). A coroutine returns from its function
+ * when it awaits a response, and the next call jumps back behind the await. Each step
+ * still runs to completion like any other handler. Local variables are not kept
+ * across an await, so the state of a coroutine has to live in a struct.
+ *
+ * The Systembuilder generates the coroutine of a subscribed request that is marked as
+ * 'async' in the module config, e.g.:
+ *
+ *     subscribed requests:
+ *     - name: Sequence
+ *       async: true
+ *
+ * The request handler then runs as coroutine with a copy of the request header and
+ * parameters. The generated state struct async_<Name> holds the coroutine and the
+ * locals that are kept across awaits. A request that arrives while the handler still
+ * awaits a response is not handled, see the user code section ASYNC <NAME> BUSY.
+ * Responses are awaited with the generated macro AWAIT_<Name>(), e.g.:
+ *
+ *     AWAIT_Sequence(
+ *         RID_Measure,
+ *         req_Measure((OE_MessageHandler_t)resumeAsync_Sequence, Module->Kernel->KernelID));
+ *
+ * Behind the await, Coroutine.Error holds the error of sending the request. If it is
+ * OE_ERROR_NONE, Coroutine.Response points to the response parameters until the next
+ * await. Only the first response to the awaited request resumes the coroutine.
+ *
+ * Each await tags the requests it sends, and the responses keep the tag. A request
+ * with several subscribers gets several responses. The ones that arrive after the
+ * coroutine went on carry the tag of an earlier await and are dropped, even if the
+ * coroutine awaits the same request again. This needs OE_USE_COROUTINES.
+ *
+ * switch statements cannot surround an await, since the coroutine is a switch itself.
+ */
+
+#include "oe_defines.h"
+#include "oe_core_mod.h"
+
+#if !OE_USE_COROUTINES
+#error Missing definition: OE_USE_COROUTINES. Please set OE_USE_COROUTINES to 1 in oe_config.h in order to use coroutines.
+#endif
+
+typedef struct OE_Coroutine_s
+{
+    /* The line behind the last await. 0 while the coroutine is not running. */
+    uint32_t Line;
+
+    /* The request whose response is awaited. */
+    OE_RequestID_t Awaiting;
+
+    /* The tag of the last await. It is counted up with each await. */
+    OE_AwaitTag_t AwaitTag;
+
+    /* The error of sending the awaited request. */
+    OE_Error_t Error;
+
+    /* The response that resumed the coroutine. It is valid until the next await. */
+    OE_MessageHeader_t *ResponseHeader;
+    void *Response;
+
+} OE_Coroutine_t;
+
+/* Start the body of a coroutine. */
+#define OE_COROUTINE_BEGIN(Coroutine) \
+    switch ((Coroutine)->Line)        \
+    {                                 \
+    case 0:
+
+/* End the body of a coroutine. The next call starts it again. */
+#define OE_COROUTINE_END(Coroutine) \
+    }                               \
+    (Coroutine)->Line = 0
+
+/* Leave a coroutine before its end. The next call starts it again. */
+#define OE_COROUTINE_EXIT(Coroutine) \
+    do                               \
+    {                                \
+        (Coroutine)->Line = 0;       \
+        return;                      \
+    } while (0)
+
+/* Check if a coroutine awaits a response. */
+#define OE_COROUTINE_IS_RUNNING(Coroutine) ((Coroutine)->Line != 0)
+
+/* Count up the tag of an await. OE_NO_AWAIT_TAG is skipped. */
+static inline OE_AwaitTag_t OE_Coroutine_nextAwaitTag(
+    OE_AwaitTag_t AwaitTag)
+{
+    AwaitTag++;
+
+    return (AwaitTag == OE_NO_AWAIT_TAG) ? AwaitTag + 1 : AwaitTag;
+}
+
+/**
+ * Send a request and return until its response arrives. The coroutine does not wait
+ * if sending fails.
+ *
+ * @param Coroutine Pointer to the coroutine.
+ * @param KernelID The ID of the kernel the coroutine runs in. The request has to be
+ * sent with this kernel ID.
+ * @param RequestID The ID of the request that is sent.
+ * @param Send An expression that sends the request and evaluates to an OE_Error_t.
+ */
+#define OE_COROUTINE_AWAIT(Coroutine, KernelID, RequestID, Send)                  \
+    do                                                                            \
+    {                                                                             \
+        (Coroutine)->Awaiting = (RequestID);                                      \
+        (Coroutine)->AwaitTag = OE_Coroutine_nextAwaitTag((Coroutine)->AwaitTag); \
+        OE_Core_setAwaitTag((KernelID), (Coroutine)->AwaitTag);                   \
+        (Coroutine)->Error = (Send);                                              \
+        OE_Core_setAwaitTag((KernelID), OE_NO_AWAIT_TAG);                         \
+        if ((Coroutine)->Error == OE_ERROR_NONE)                                  \
+        {                                                                         \
+            (Coroutine)->Line = __LINE__;                                         \
+            return;                                                               \
+        case __LINE__:;                                                           \
+        }                                                                         \
+    } while (0)
+
+/**
+ * @brief Pass a response to a coroutine.
+ *
+ * @param Coroutine Pointer to the coroutine.
+ * @param Header Pointer to the header of the response message.
+ * @param Args Pointer to the response parameters.
+ * @return bool true is returned if the coroutine awaits this response and has to be
+ * called to continue. Responses to earlier awaits are not passed.
+ */
+static inline bool OE_Coroutine_resume(
+    OE_Coroutine_t *Coroutine,
+    OE_MessageHeader_t *Header,
+    void *Args)
+{
+    if (Coroutine->Line == 0 ||
+        Header->RequestID != Coroutine->Awaiting ||
+        Header->AwaitTag != Coroutine->AwaitTag)
+    {
+        return false;
+    }
+
+    /* Further responses to the same await are dropped. */
+    Coroutine->Awaiting = OE_NUMBER_OF_REQUESTS;
+    Coroutine->ResponseHeader = Header;
+    Coroutine->Response = Args;
+
+    return true;
+}
+
+#endif // OE_COROUTINE_H
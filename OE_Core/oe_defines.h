@@ -49,6 +49,76 @@
 #endif
 #endif
 
+#if OE_USE_RATE_LIMIT || OE_USE_OVERLOAD_POLICY || OE_USE_BRIDGE || OE_USE_JOURNAL
+#ifndef OE_GET_TICKS
+#error Missing definition: OE_GET_TICKS. Please define a tick counter in oe_port.h in order to use the rate limit, overload policies, bridges or the journal.
+#endif
+#endif
+
+/* The core keeps a table of request attributes if one of these features is used. */
+#define OE_USE_REQUEST_ATTRIBUTES (OE_USE_REQUEST_LIMIT || OE_USE_RATE_LIMIT || OE_USE_OVERLOAD_POLICY || OE_USE_COALESCING || OE_USE_SHARDING)
+
+#if OE_USE_ISR_SEND
+#if !defined(OE_NUMBER_OF_ISR_SOURCES) || OE_NUMBER_OF_ISR_SOURCES < 1
+#error Invalid definition: OE_NUMBER_OF_ISR_SOURCES. Please define at least one ISR source in oe_config.h.
+#endif
+#if !defined(OE_STAGING_RING_LENGTH) || OE_STAGING_RING_LENGTH < 1
+#error Invalid definition: OE_STAGING_RING_LENGTH. Please make sure that OE_STAGING_RING_LENGTH is at least 1.
+#endif
+#endif
+
+#if OE_USE_EPOLL && OE_MESSAGE_DATA_SIZE < 8
+#error Invalid definition: OE_MESSAGE_DATA_SIZE. The readiness of a file (see oe_epoll.h) needs at least 8 bytes of message data.
+#endif
+
+#if OE_USE_EPOLL && OE_USE_SHARED_CORE
+#error Invalid definition: OE_USE_EPOLL. The eventfds of the kernels (see oe_epoll.h) belong to one process and cannot resume the kernels of other processes. Please do not use OE_USE_EPOLL together with OE_USE_SHARED_CORE.
+#endif
+
+#if OE_USE_ASYNC_IO
+#if !defined(OE_ASYNC_IO_QUEUE_LENGTH) || OE_ASYNC_IO_QUEUE_LENGTH < 1 || OE_ASYNC_IO_QUEUE_LENGTH > 4096
+#error Invalid definition: OE_ASYNC_IO_QUEUE_LENGTH. Please define between 1 and 4096 operations in oe_config.h.
+#endif
+#endif
+
+#if OE_USE_MESSAGE_POOL
+#ifndef OE_MESSAGE_POOL_CLASSES
+#error Missing definition: OE_MESSAGE_POOL_CLASSES. Please define the size classes of the message pool in oe_config.h.
+#endif
+
+/* The numbers of the message pool are counted from the size classes. */
+#define OE_MESSAGE_POOL_COUNT_CLASS(Size, Count) + 1
+#define OE_MESSAGE_POOL_COUNT_BLOCKS(Size, Count) + (Count)
+#define OE_MESSAGE_POOL_COUNT_BYTES(Size, Count) + (Size) * (Count)
+#define OE_MESSAGE_POOL_CHECK_CLASS(Size, Count) || (Size) < 8 || (Size) % 8 != 0 || (Count) < 1
+
+#define OE_MESSAGE_POOL_NUMBER_OF_CLASSES (0 OE_MESSAGE_POOL_CLASSES(OE_MESSAGE_POOL_COUNT_CLASS))
+#define OE_MESSAGE_POOL_NUMBER_OF_BLOCKS (0 OE_MESSAGE_POOL_CLASSES(OE_MESSAGE_POOL_COUNT_BLOCKS))
+#define OE_MESSAGE_POOL_MEMORY_SIZE (0 OE_MESSAGE_POOL_CLASSES(OE_MESSAGE_POOL_COUNT_BYTES))
+
+#if 0 OE_MESSAGE_POOL_CLASSES(OE_MESSAGE_POOL_CHECK_CLASS)
+#error Invalid definition: OE_MESSAGE_POOL_CLASSES. Please make sure that each block size is a multiple of 8 and each class has at least one block.
+#endif
+#if OE_MESSAGE_POOL_NUMBER_OF_CLASSES < 1 || OE_MESSAGE_POOL_NUMBER_OF_CLASSES > 255
+#error Invalid definition: OE_MESSAGE_POOL_CLASSES. Please define between 1 and 255 size classes in oe_config.h.
+#endif
+#if OE_MESSAGE_POOL_NUMBER_OF_BLOCKS > 0xFFFF || OE_MESSAGE_POOL_MEMORY_SIZE > 0xFFFFFFFF
+#error Invalid definition: OE_MESSAGE_POOL_CLASSES. Please define at most 65535 blocks and 4 GiB of blocks in oe_config.h.
+#endif
+#endif
+
+#if OE_USE_BRIDGE
+#if !defined(OE_NUMBER_OF_BRIDGES) || OE_NUMBER_OF_BRIDGES < 1 || OE_NUMBER_OF_BRIDGES > 255
+#error Invalid definition: OE_NUMBER_OF_BRIDGES. Please define between 1 and 255 bridges in oe_config.h.
+#endif
+#if !defined(OE_BRIDGE_BATCH_LIMIT) || OE_BRIDGE_BATCH_LIMIT < 1 || OE_BRIDGE_BATCH_LIMIT > 255
+#error Invalid definition: OE_BRIDGE_BATCH_LIMIT. Please make sure that OE_BRIDGE_BATCH_LIMIT is between 1 and 255.
+#endif
+#if !defined(OE_BRIDGE_PENDING_LIMIT) || OE_BRIDGE_PENDING_LIMIT < 1 || OE_BRIDGE_PENDING_LIMIT > 256
+#error Invalid definition: OE_BRIDGE_PENDING_LIMIT. Please make sure that OE_BRIDGE_PENDING_LIMIT is between 1 and 256.
+#endif
+#endif
+
 #if OE_MESSAGE_QUEUE_LENGTH < 1
 #error Invalid definition: OE_MESSAGE_QUEUE_LENGTH. Please make sure that OE_MESSAGE_QUEUE_LENGTH is at least 1.
 #endif
@@ -68,6 +138,48 @@ typedef uint8_t OE_KernelID_t;
 #define OE_NO_KERNEL 0xFF
 #endif
 
+/**
+ * The port may provide OE_CURRENT_KERNEL() in oe_port.h. It returns the ID of the
+ * kernel in whose context the caller is running. If the caller does not run inside
+ * a kernel (e.g. an ISR or another thread) or if the port cannot tell, OE_NO_KERNEL
+ * is returned. The core uses this information for message statistics and to keep a
+ * kernel from waiting for room in a message queue (see OE_OVERLOAD_BLOCK), which only
+ * the kernel itself could make. Therefore the port has to provide it in order to use
+ * the overload policies.
+ */
+#ifndef OE_CURRENT_KERNEL
+#if OE_USE_OVERLOAD_POLICY
+#error Missing definition: OE_CURRENT_KERNEL. Please return the ID of the current kernel in oe_port.h in order to use the overload policies.
+#endif
+#define OE_CURRENT_KERNEL() OE_NO_KERNEL
+#endif
+
+/**
+ * The port may provide OE_YIELD() in oe_port.h. It lets other threads run while a
+ * sender waits for free space in a message queue (see OE_OVERLOAD_BLOCK).
+ */
+#ifndef OE_YIELD
+#define OE_YIELD() OE_NOP()
+#endif
+
+/**
+ * The port may provide OE_MEMORY_BARRIER() in oe_port.h. It orders the memory accesses
+ * of an ISR and the kernels on the staging rings (see OE_USE_ISR_SEND). On a single
+ * core MCU a compiler barrier is sufficient.
+ */
+#ifndef OE_MEMORY_BARRIER
+#define OE_MEMORY_BARRIER() __sync_synchronize()
+#endif
+
+/**
+ * The port may provide OE_READ_BARRIER() in oe_port.h. It keeps the loads before the
+ * barrier from being reordered with the loads after it. A kernel uses it when it
+ * reads its request map without locking (see OE_RequestMap_copyHandlers()).
+ */
+#ifndef OE_READ_BARRIER
+#define OE_READ_BARRIER() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#endif
+
 /**
  * OE_Kernel_t is a struct that holds the data of a kernel.
  */
@@ -88,6 +200,59 @@ typedef void (*OE_MessageHandler_t)();
 
 #define OE_NO_HANDLER NULL
 
+#if OE_USE_SHARED_CORE
+/**
+ * If the core is shared between processes, messages refer to response handlers by an
+ * index into a table of the sending process (see OE_Core_getResponseHandler()).
+ */
+typedef uint16_t OE_ResponseIndex_t;
+
+#define OE_NO_RESPONSE_INDEX 0
+#endif // OE_USE_SHARED_CORE
+
+#if OE_USE_EPOLL
+/**
+ * The kernels can idle in epoll_wait() (see oe_epoll.h). The port maps OE_IDLE() and
+ * OE_RESUME() to these functions.
+ */
+void OE_Epoll_idle(
+    OE_KernelID_t KernelID);
+
+void OE_Epoll_resume(
+    OE_KernelID_t KernelID);
+#endif // OE_USE_EPOLL
+
+#if OE_USE_BRIDGE
+/**
+ * Requests that a bridge received from another node are tagged. The upper half of
+ * the tag is the number of the bridge, the lower half identifies the request on the
+ * other node (see oe_bridge.h).
+ */
+typedef uint32_t OE_BridgeTag_t;
+
+#define OE_NO_BRIDGE_TAG 0
+#endif // OE_USE_BRIDGE
+
+#if OE_USE_MESSAGE_POOL
+/**
+ * A block of the message pool is referred to by a handle (see oe_message_pool.h). A
+ * request can carry a block in its header.
+ */
+typedef uint32_t OE_Block_t;
+
+#define OE_NO_BLOCK 0
+#endif // OE_USE_MESSAGE_POOL
+
+#if OE_USE_COROUTINES
+/**
+ * Each await of a coroutine tags the requests it sends (see oe_coroutine.h). Their
+ * responses keep the tag.
+ */
+typedef uint16_t OE_AwaitTag_t;
+
+#define OE_NO_AWAIT_TAG 0
+#endif // OE_USE_COROUTINES
+
 /* A data type to store message information is defined. */
 typedef uint8_t OE_MessageInformation_t;
 
@@ -127,6 +292,16 @@ typedef uint8_t OE_MessageInformation_t;
  */
 #define OE_MESSAGE_DATA_EMPTY 0b10
 
+#if OE_USE_JOURNAL
+/**
+ * @note OE_MESSAGE_REPLAYED: The request was logged before and is sent again by the
+ * journal on startup (see oe_journal.h). The journal does not append it again. Handlers
+ * can check this bit, e.g. to skip side effects that already happened. Only the journal
+ * can set it (see OE_Core_replayRequest()), the core clears it in all other requests.
+ */
+#define OE_MESSAGE_REPLAYED 0b100
+#endif // OE_USE_JOURNAL
+
 /**
  * The message header is used to store the general message data. The core
  * uses the header to forward messages to kernels. The kernels then forward those messages
@@ -152,6 +327,41 @@ typedef struct OE_MessageHeader_s
      */
     OE_MessageHandler_t ResponseHandler;
 
+#if OE_USE_SHARED_CORE
+    /**
+     * A queued request refers to its response handler by this index. The core sets it
+     * and clears the response handler, since function pointers are only valid in the
+     * process that sent the request.
+     */
+    OE_ResponseIndex_t ResponseIndex;
+#endif // OE_USE_SHARED_CORE
+
+#if OE_USE_BRIDGE
+    /**
+     * The tag of a request that came from another node. Responses keep the tag of
+     * their request, so the bridge can route them back to the other node.
+     */
+    OE_BridgeTag_t BridgeTag;
+#endif // OE_USE_BRIDGE
+
+#if OE_USE_MESSAGE_POOL
+    /**
+     * A request can carry a block of the message pool for a payload that does not fit
+     * into the message data. Sending the request passes the sender's reference on and
+     * clears the block from the sender's header. The block is released after the last
+     * receiving kernel has handled the request. Responses never carry a block.
+     */
+    OE_Block_t Block;
+#endif // OE_USE_MESSAGE_POOL
+
+#if OE_USE_COROUTINES
+    /**
+     * The tag of the await that sent a request. Responses keep the tag of their
+     * request, so a coroutine can drop the responses to its earlier awaits.
+     */
+    OE_AwaitTag_t AwaitTag;
+#endif // OE_USE_COROUTINES
+
     /**
      * This is the ID of the kernel from which a request is sent. 
      * The response handler is executed in this kernel.
@@ -178,6 +388,90 @@ struct OE_Message_s
     uint8_t Data[OE_MESSAGE_DATA_SIZE];
 };
 
+#if OE_USE_REQUEST_ATTRIBUTES
+/**
+ * The overload policy decides what happens to a request if a receiving message queue
+ * is full or the request limit is reached.
+ */
+typedef enum OE_OverloadPolicy_e
+{
+    /* The request is rejected with an error. This is the default. */
+    OE_OVERLOAD_REJECT,
+    /* The oldest queued message of the same request is dropped to make room. */
+    OE_OVERLOAD_DROP_OLDEST,
+    /* The newest queued message of the same request is overwritten. */
+    OE_OVERLOAD_COALESCE_LATEST,
+    /**
+     * The sender waits until there is room or the block timeout has passed. Only use
+     * this policy for requests sent by threads outside of the kernels, never from a
+     * kernel or an ISR.
+     */
+    OE_OVERLOAD_BLOCK,
+} OE_OverloadPolicy_t;
+
+/**
+ * The request attributes set the request limit, the rate limit, the overload policy, the
+ * coalescing and the sharding of each request. They are generated into the macro
+ * OE_REQUEST_ATTRIBUTES in oe_requests.h and stored in a const table by the core. Requests
+ * without attributes use OE_REQUEST_LIMIT, are not rate limited, are rejected on overload
+ * and are never coalesced or sharded.
+ */
+typedef struct OE_RequestAttributes_s
+{
+    /**
+     * The request limit determines how many requests of the same type can be queued
+     * in one kernel at most. If it is 0, OE_REQUEST_LIMIT is used.
+     */
+    size_t RequestLimit;
+
+    /**
+     * The rate limit determines how many requests of the same type can be sent per
+     * rate period. If it is 0, the request is not rate limited.
+     */
+    uint32_t RateLimit;
+
+    /* The length of the rate period in ticks of OE_GET_TICKS(). */
+    uint32_t RatePeriod;
+
+    /**
+     * The burst determines how many requests can be sent at once after a quiet
+     * time. If it is 0, the burst equals the rate limit.
+     */
+    uint32_t RateBurst;
+
+    /* The overload policy is only used if OE_USE_OVERLOAD_POLICY is set. */
+    OE_OverloadPolicy_t OverloadPolicy;
+
+    /* The maximum time in ticks of OE_GET_TICKS() a sender waits with OE_OVERLOAD_BLOCK. */
+    uint32_t BlockTimeout;
+
+    /**
+     * If set, a new request replaces the parameters of a queued request of the same
+     * type instead of taking another slot. Only used if OE_USE_COALESCING is set.
+     */
+    bool Coalesce;
+
+    /**
+     * Requests are only coalesced if their keys match. The key is the first request
+     * parameter. If the key size is 0, every queued request of the same type is replaced.
+     */
+    size_t CoalesceKeySize;
+
+    /**
+     * If the shard key size is not 0, the request is only sent to one subscribing kernel.
+     * The kernel is chosen by the hash of the shard key, which is the first request
+     * parameter. Only used if OE_USE_SHARDING is set.
+     */
+    size_t ShardKeySize;
+
+} OE_RequestAttributes_t;
+
+/* The table is empty if oe_requests.h does not provide any attributes. */
+#ifndef OE_REQUEST_ATTRIBUTES
+#define OE_REQUEST_ATTRIBUTES {{0}}
+#endif
+#endif // OE_USE_REQUEST_ATTRIBUTES
+
 #if OE_USE_REQUEST_LIMIT
 /**
  * To limit the amount of queued request messages at a time the core works with
@@ -187,22 +481,112 @@ typedef struct OE_RequestRegisterEntry_s
 {
     /**
      * The number of requests stores how many times a specific request is currently queued.
+     * It is compared to the request limit in the request attributes.
      */
     size_t NumberOfRequests;
 
-    /**
-     * The request limit determines how many requests of the same type can be queued at most.
-     * This is useful to stop an external flooding of requests which could stop the kernels
-     * from processing other types of messages.
-     *
-     * The request limit is currently defined globally be the macro REQUEST_LIMIT. This might
-     * be changed in the future in order to set an individual limit for each request.
-     */
-    size_t RequestLimit;
-
 } OE_RequestRegisterEntry_t;
 #endif // OE_USE_REQUEST_LIMIT
 
+#if OE_USE_RATE_LIMIT
+/**
+ * The rate limit is a token bucket. Each sent request takes one token and each
+ * rate period adds RateLimit tokens, up to the burst. This way a flooding source
+ * cannot fill the message queues, while other requests still get through.
+ */
+typedef struct OE_RateBucket_s
+{
+    /* The number of requests that can be sent right now. */
+    uint32_t Tokens;
+
+    /* The tick at which tokens were last added. */
+    uint32_t LastRefill;
+
+} OE_RateBucket_t;
+#endif // OE_USE_RATE_LIMIT
+
+/**
+ * A request filter lets a message handler only receive the requests whose parameters
+ * match. The field of Size bytes at Offset in the request parameters is masked and
+ * compared to Value. Filters are only used if OE_USE_REQUEST_FILTERS is set.
+ */
+typedef struct OE_RequestFilter_s
+{
+    /* The offset of the field in the request parameters. */
+    uint16_t Offset;
+
+    /* The size of the field in bytes: 1, 2 or 4. If it is 0, every request passes. */
+    uint8_t Size;
+
+    /* The mask is applied to the field before it is compared. */
+    uint32_t Mask;
+
+    /* The value the masked field has to match. */
+    uint32_t Value;
+
+} OE_RequestFilter_t;
+
+/* This filter lets every request pass. */
+#define OE_NO_FILTER ((OE_RequestFilter_t){0})
+
+/**
+ * Create a filter for a field of a request parameter struct, e.g.
+ * OE_REQUEST_FILTER(struct requestArgs_Name_s, DeviceID, 0xFF, 3).
+ */
+#define OE_REQUEST_FILTER(ArgsType, Field, FieldMask, FieldValue) \
+    ((OE_RequestFilter_t){ \
+        .Offset = offsetof(ArgsType, Field), \
+        .Size = sizeof(((ArgsType *)0)->Field), \
+        .Mask = (FieldMask), \
+        .Value = (FieldValue)})
+
+#if OE_USE_REQUEST_FILTERS
+/**
+ * The core keeps the filters of the handlers a kernel registered for a request.
+ * A request is queued if one of the filters matches.
+ */
+typedef struct OE_RequestFilters_s
+{
+    OE_RequestFilter_t Filters[OE_REQUEST_HANDLER_LIMIT];
+
+    /* If the number of filters is 0, one of the handlers takes every request. */
+    size_t NumberOfFilters;
+
+} OE_RequestFilters_t;
+#endif // OE_USE_REQUEST_FILTERS
+
+#if OE_USE_MESSAGE_STATISTICS
+/**
+ * The core can count the messages that flow between the kernels. One entry of
+ * message statistics exists for each combination of sending kernel, request ID
+ * and receiving kernel.
+ */
+typedef struct OE_MessageStatistics_s
+{
+    /* The number of request messages that were queued. */
+    uint32_t Requests;
+
+    /* The number of response messages that were queued. */
+    uint32_t Responses;
+
+    /* The number of payload bytes that were copied into the message queues. */
+    uint32_t Bytes;
+
+} OE_MessageStatistics_t;
+
+/**
+ * A callback of this type is used to export the message statistics.
+ * It is called once for each entry that counted at least one message.
+ * If the sending kernel is unknown, SenderID is OE_NO_KERNEL.
+ */
+typedef void (*OE_StatisticsCallback_t)(
+    OE_KernelID_t SenderID,
+    OE_RequestID_t RequestID,
+    OE_KernelID_t ReceiverID,
+    const OE_MessageStatistics_t *Statistics,
+    void *Context);
+#endif // OE_USE_MESSAGE_STATISTICS
+
 /**
  * There are a couple of different errors that can occure during kernel operation.
  * These errors are listed here.
@@ -223,6 +607,9 @@ typedef enum OE_Error_e
     /*General purpose errors*/
     OE_ERROR_UNSPECIFIED,
     OE_ERROR_PARAMETER_INVALID,
+    /*New errors are appended to keep the values of the others*/
+    OE_ERROR_RATE_LIMIT_REACHED,
+    OE_ERROR_NO_RECEIVER,
     
     /**
      * The last element in this enum MUST be "OE_NUMBER_OF_ERRORS".
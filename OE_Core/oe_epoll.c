@@ -0,0 +1,223 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#include "oe_epoll.h"
+
+#if OE_USE_EPOLL
+#include "oe_core_mod.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+/* The number of ready files that are handled per wait. More are handled at the next wait. */
+#define OE_EPOLL_EVENTS_PER_WAIT 8
+
+/* The eventfd is marked with a request ID that no file can use. */
+#define OE_EPOLL_RESUME_MARK ((uint64_t)OE_NUMBER_OF_REQUESTS << 32)
+
+typedef struct OE_EpollKernel_s
+{
+    int EpollFile;
+    int EventFile;
+    bool Open;
+} OE_EpollKernel_t;
+
+static OE_EpollKernel_t OE_EpollKernels[OE_NUMBER_OF_KERNELS];
+
+/**
+ * @brief Add, change or remove a file of a kernel.
+ *
+ * @param KernelID The ID of the kernel.
+ * @param Operation The epoll operation, e.g. EPOLL_CTL_ADD.
+ * @param File The file descriptor.
+ * @param Events The events to wait for.
+ * @param Data The data that is reported with the events.
+ * @return OE_Error_t An error is returned if
+ * - the kernel is not open.
+ * - the operation fails.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static OE_Error_t OE_Epoll_control(
+    OE_KernelID_t KernelID,
+    int Operation,
+    int File,
+    uint32_t Events,
+    uint64_t Data);
+
+OE_Error_t OE_Epoll_open(
+    OE_KernelID_t KernelID)
+{
+    OE_EpollKernel_t *EpollKernel;
+    uint64_t Count;
+
+    if (KernelID >= OE_NUMBER_OF_KERNELS)
+    {
+        return OE_ERROR_KERNEL_ID_INVALID;
+    }
+
+    EpollKernel = &OE_EpollKernels[KernelID];
+
+    if (EpollKernel->Open)
+    {
+        /**
+         * The eventfd is kept, because other threads may resume the kernel at any time.
+         * Pending resumes are dropped, the kernel checks its message queue anyway.
+         */
+        while (read(EpollKernel->EventFile, &Count, sizeof(Count)) == sizeof(Count));
+        close(EpollKernel->EpollFile);
+    }
+    else
+    {
+        EpollKernel->EventFile = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+        if (EpollKernel->EventFile < 0)
+        {
+            return OE_ERROR_UNSPECIFIED;
+        }
+    }
+
+    EpollKernel->Open = false;
+    EpollKernel->EpollFile = epoll_create1(EPOLL_CLOEXEC);
+
+    if (EpollKernel->EpollFile < 0)
+    {
+        close(EpollKernel->EventFile);
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    EpollKernel->Open = true;
+
+    if (OE_Epoll_control(
+            KernelID,
+            EPOLL_CTL_ADD,
+            EpollKernel->EventFile,
+            EPOLLIN,
+            OE_EPOLL_RESUME_MARK) != OE_ERROR_NONE)
+    {
+        close(EpollKernel->EpollFile);
+        close(EpollKernel->EventFile);
+        EpollKernel->Open = false;
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    return OE_ERROR_NONE;
+}
+
+OE_Error_t OE_Epoll_addFile(
+    OE_Kernel_t *Kernel,
+    int File,
+    uint32_t Events,
+    OE_RequestID_t RequestID)
+{
+    if (RequestID >= OE_NUMBER_OF_REQUESTS)
+    {
+        return OE_ERROR_REQUEST_ID_INVALID;
+    }
+
+    /* The request ID and the file are reported with the events. */
+    return OE_Epoll_control(
+        Kernel->KernelID,
+        EPOLL_CTL_ADD,
+        File,
+        Events,
+        ((uint64_t)RequestID << 32) | (uint32_t)File);
+}
+
+OE_Error_t OE_Epoll_removeFile(
+    OE_Kernel_t *Kernel,
+    int File)
+{
+    return OE_Epoll_control(
+        Kernel->KernelID,
+        EPOLL_CTL_DEL,
+        File,
+        0,
+        0);
+}
+
+void OE_Epoll_idle(
+    OE_KernelID_t KernelID)
+{
+    struct epoll_event Events[OE_EPOLL_EVENTS_PER_WAIT];
+    OE_EpollKernel_t *EpollKernel;
+    OE_RequestID_t RequestID;
+    uint64_t Count;
+    int NumberOfEvents;
+
+    if (KernelID >= OE_NUMBER_OF_KERNELS || !OE_EpollKernels[KernelID].Open)
+    {
+        return;
+    }
+
+    EpollKernel = &OE_EpollKernels[KernelID];
+
+    NumberOfEvents = epoll_wait(
+        EpollKernel->EpollFile,
+        Events,
+        OE_EPOLL_EVENTS_PER_WAIT,
+        -1);
+
+    for (int Index = 0; Index < NumberOfEvents; Index++)
+    {
+        if (Events[Index].data.u64 == OE_EPOLL_RESUME_MARK)
+        {
+            /* Reading resets the counter of the eventfd. */
+            while (read(EpollKernel->EventFile, &Count, sizeof(Count)) < 0 && errno == EINTR);
+            continue;
+        }
+
+        RequestID = (OE_RequestID_t)(Events[Index].data.u64 >> 32);
+
+        OE_Core_sendRequestTo(
+            KernelID,
+            &(OE_MessageHeader_t){.RequestID = RequestID},
+            &(OE_EpollEvent_t){
+                .File = (int)(uint32_t)Events[Index].data.u64,
+                .Events = Events[Index].events,
+            });
+    }
+}
+
+void OE_Epoll_resume(
+    OE_KernelID_t KernelID)
+{
+    uint64_t Count = 1;
+
+    if (KernelID >= OE_NUMBER_OF_KERNELS || !OE_EpollKernels[KernelID].Open)
+    {
+        return;
+    }
+
+    /* The counter only saturates after 2^64 - 2 resumes, so this never blocks. */
+    while (write(OE_EpollKernels[KernelID].EventFile, &Count, sizeof(Count)) < 0 && errno == EINTR);
+}
+
+OE_Error_t OE_Epoll_control(
+    OE_KernelID_t KernelID,
+    int Operation,
+    int File,
+    uint32_t Events,
+    uint64_t Data)
+{
+    struct epoll_event Event = {
+        .events = Events,
+        .data.u64 = Data,
+    };
+
+    if (KernelID >= OE_NUMBER_OF_KERNELS || !OE_EpollKernels[KernelID].Open)
+    {
+        return OE_ERROR_KERNEL_ID_INVALID;
+    }
+
+    if (epoll_ctl(OE_EpollKernels[KernelID].EpollFile, Operation, File, &Event) != 0)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    return OE_ERROR_NONE;
+}
+#endif // OE_USE_EPOLL
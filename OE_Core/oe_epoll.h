@@ -0,0 +1,113 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_EPOLL_H
+#define OE_EPOLL_H
+
+/**
+ * @brief This is the header file of the epoll integration (Linux only). It lets a kernel
+ * wait for messages and file descriptors at the same time, so that modules do not
+ * need threads of their own for I/O.
+ *
+ * Each kernel owns an epoll instance and an eventfd. They are opened when the kernel
+ * is initialized. The port lets the kernels idle and resume with these functions:
+ *
+ *     #define OE_IDLE(KernelID) OE_Epoll_idle(KernelID)
+ *     #define OE_RESUME(KernelID) OE_Epoll_resume(KernelID)
+ *
+ * OE_Epoll_resume() writes to the eventfd of the kernel, so a kernel that is resumed
+ * before it idles does not wait.
+ *
+ * A module registers a file descriptor together with a request. Whenever the file is
+ * ready while its kernel idles, the request is sent to this kernel only, with an
+ * OE_EpollEvent_t as parameters. The request must be subscribed by the kernel and its
+ * parameters must be an int File followed by a uint32_t Events, e.g.:
+ *
+ *     request parameters:
+ *     - name: File
+ *       type: int
+ *     - name: Events
+ *       type: uint32_t
+ *
+ * The files are level triggered. The request handler has to read or write the file,
+ * otherwise the request is sent again the next time the kernel idles. If the request
+ * cannot be queued, it is sent again the same way.
+ *
+ * The eventfds belong to the process that opened them, so the kernels of other
+ * processes could not be resumed. The epoll integration cannot be used together with
+ * a shared core (see oe_shared_core.h).
+ */
+
+#include "oe_defines.h"
+
+#if OE_USE_EPOLL
+#include "oe_kernel.h"
+
+#include <sys/epoll.h>
+
+/* The parameters of a request that is sent when a file is ready. */
+typedef struct OE_EpollEvent_s
+{
+    /* The file descriptor. */
+    int File;
+
+    /* The ready events, e.g. EPOLLIN. */
+    uint32_t Events;
+
+} OE_EpollEvent_t;
+
+/**
+ * @brief Open the epoll instance and the eventfd of a kernel.
+ *
+ * This function is called by OE_Kernel_staticInit(). If the kernel was opened before,
+ * all of its files are removed.
+ *
+ * @param KernelID The ID of the kernel.
+ * @return OE_Error_t An error is returned if
+ * - the kernel ID is invalid.
+ * - the epoll instance or the eventfd cannot be created.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Epoll_open(
+    OE_KernelID_t KernelID);
+
+/**
+ * @brief Wait for a file of a kernel.
+ *
+ * @param Kernel Pointer to the kernel that waits for the file.
+ * @param File The file descriptor.
+ * @param Events The events to wait for, e.g. EPOLLIN.
+ * @param RequestID The ID of the request that is sent when the file is ready.
+ * @return OE_Error_t An error is returned if
+ * - the kernel is not open.
+ * - the request ID is invalid.
+ * - the file cannot be added, e.g. because it is added already.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Epoll_addFile(
+    OE_Kernel_t *Kernel,
+    int File,
+    uint32_t Events,
+    OE_RequestID_t RequestID);
+
+/**
+ * @brief Stop waiting for a file of a kernel.
+ *
+ * A request that was sent already is still handled.
+ *
+ * @param Kernel Pointer to the kernel that waits for the file.
+ * @param File The file descriptor.
+ * @return OE_Error_t An error is returned if
+ * - the kernel is not open.
+ * - the file was not added.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Epoll_removeFile(
+    OE_Kernel_t *Kernel,
+    int File);
+#endif // OE_USE_EPOLL
+
+#endif // OE_EPOLL_H
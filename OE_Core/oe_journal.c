@@ -0,0 +1,703 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#include "oe_journal.h"
+
+#if OE_USE_JOURNAL
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* The log format changes with this version. */
+#define OE_JOURNAL_VERSION 1
+
+/* The log file starts with "OEJL". */
+#define OE_JOURNAL_MAGIC 0x4C4A454F
+
+/* The type of a record. */
+#define OE_JOURNAL_RECORD_DATA_EMPTY 0x01
+#define OE_JOURNAL_RECORD_ENCODED 0x02
+
+/* Records start at multiples of 4 bytes. */
+#define OE_JOURNAL_RECORD_SIZE(DataLength) \
+    ((OE_JOURNAL_RECORD_HEADER_SIZE + (DataLength) + 3) & ~(size_t)3)
+
+/* The open journal. Its request handler appends to it. */
+static OE_Journal_t *OE_OpenJournal;
+
+/**
+ * @brief Append a subscribed request to the open journal.
+ *
+ * @param Header Pointer to the header of the request message.
+ * @param Parameters Pointer to the request parameters.
+ */
+static void OE_Journal_handleRequest(
+    OE_MessageHeader_t *Header,
+    const void *Parameters);
+
+/**
+ * @brief Subscribe or unsubscribe the requests of the journal.
+ *
+ * @param Journal Pointer to the journal.
+ * @param Count The number of requests to unsubscribe, or the number of requests in the
+ * config to subscribe.
+ * @param Subscribe Subscribe the requests if true, unsubscribe them otherwise.
+ * @return OE_Error_t An error is returned if
+ * - subscribing a request fails. The requests before it are unsubscribed again.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static OE_Error_t OE_Journal_subscribe(
+    OE_Journal_t *Journal,
+    size_t Count,
+    bool Subscribe);
+
+/**
+ * @brief Read the log header and find the end of the valid records.
+ *
+ * A log of another configuration is cleared. Bytes after the last valid record, e.g.
+ * a torn record, are cleared, so that no record after them becomes valid again.
+ *
+ * @param Journal Pointer to the journal.
+ * @return OE_Error_t An error is returned if
+ * - writing the file fails.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static OE_Error_t OE_Journal_recover(
+    OE_Journal_t *Journal);
+
+/**
+ * @brief Check a record.
+ *
+ * @param Journal Pointer to the journal.
+ * @param Offset The offset of the record in the log.
+ * @return size_t The size of the record including its padding is returned. Returns 0 if
+ * there is no valid record at the offset.
+ */
+static size_t OE_Journal_checkRecord(
+    OE_Journal_t *Journal,
+    size_t Offset);
+
+/**
+ * @brief Write the log header and commit it.
+ *
+ * @param Journal Pointer to the journal.
+ * @return OE_Error_t An error is returned if
+ * - writing the file fails.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static OE_Error_t OE_Journal_writeHeader(
+    OE_Journal_t *Journal);
+
+/**
+ * @brief Compute the CRC-32 of a record. The epoch of the log is part of the CRC.
+ *
+ * @param Epoch The epoch of the log.
+ * @param Buffer Pointer to the record after its CRC.
+ * @param Length The number of bytes.
+ * @return uint32_t The CRC is returned.
+ */
+static uint32_t OE_Journal_crc(
+    uint32_t Epoch,
+    const uint8_t *Buffer,
+    size_t Length);
+
+static inline void OE_Journal_write16(
+    uint8_t *Buffer,
+    uint16_t Value)
+{
+    /* The log is little endian on all machines. */
+    Buffer[0] = (uint8_t)(Value & 0xFF);
+    Buffer[1] = (uint8_t)(Value >> 8);
+}
+
+static inline uint16_t OE_Journal_read16(
+    const uint8_t *Buffer)
+{
+    return (uint16_t)(Buffer[0] | (Buffer[1] << 8));
+}
+
+static inline void OE_Journal_write32(
+    uint8_t *Buffer,
+    uint32_t Value)
+{
+    OE_Journal_write16(&(Buffer[0]), (uint16_t)(Value & 0xFFFF));
+    OE_Journal_write16(&(Buffer[2]), (uint16_t)(Value >> 16));
+}
+
+static inline uint32_t OE_Journal_read32(
+    const uint8_t *Buffer)
+{
+    return (uint32_t)OE_Journal_read16(&(Buffer[0])) |
+        ((uint32_t)OE_Journal_read16(&(Buffer[2])) << 16);
+}
+
+OE_Error_t OE_Journal_open(
+    OE_Journal_t *Journal,
+    OE_Kernel_t *Kernel,
+    const OE_JournalConfig_t *Config)
+{
+    struct stat Status;
+    void *Log;
+    OE_Error_t Error;
+
+    if (Journal == NULL || Kernel == NULL || Config == NULL || Config->Path == NULL)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    if (Config->Size < OE_JOURNAL_HEADER_SIZE + OE_JOURNAL_RECORD_SIZE(OE_JOURNAL_DATA_SIZE) ||
+        Config->Size > UINT32_MAX || Config->GroupSize < 1 ||
+        (Config->NumberOfRequests > 0 && Config->Requests == NULL))
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    for (size_t Index = 0; Index < Config->NumberOfRequests; Index++)
+    {
+        if (Config->Requests[Index] >= OE_NUMBER_OF_REQUESTS)
+        {
+            return OE_ERROR_REQUEST_ID_INVALID;
+        }
+    }
+
+    memset(Journal, 0, sizeof(OE_Journal_t));
+    Journal->Kernel = Kernel;
+    Journal->Config = *Config;
+    Journal->File = -1;
+
+    OE_ENTER_CRITICAL();
+
+    if (OE_OpenJournal != NULL)
+    {
+        OE_EXIT_CRITICAL();
+        return OE_ERROR_HANDLER_LIMIT_REACHED;
+    }
+
+    OE_OpenJournal = Journal;
+
+    OE_EXIT_CRITICAL();
+
+    Journal->File = open(Config->Path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+    if (Journal->File < 0 ||
+        fstat(Journal->File, &Status) != 0 ||
+        ((size_t)Status.st_size != Config->Size && ftruncate(Journal->File, (off_t)Config->Size) != 0))
+    {
+        OE_Journal_close(Journal);
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    Log = mmap(NULL, Config->Size, PROT_READ | PROT_WRITE, MAP_SHARED, Journal->File, 0);
+
+    if (Log == MAP_FAILED)
+    {
+        OE_Journal_close(Journal);
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    Journal->Log = (uint8_t *)Log;
+
+    Error = OE_Journal_recover(Journal);
+
+    if (Error == OE_ERROR_NONE)
+    {
+        Error = OE_Journal_subscribe(
+            Journal,
+            Config->NumberOfRequests,
+            true);
+    }
+
+    if (Error != OE_ERROR_NONE)
+    {
+        OE_Journal_close(Journal);
+        return Error;
+    }
+
+    return OE_ERROR_NONE;
+}
+
+void OE_Journal_close(
+    OE_Journal_t *Journal)
+{
+    OE_ENTER_CRITICAL();
+
+    if (OE_OpenJournal != Journal)
+    {
+        OE_EXIT_CRITICAL();
+        return;
+    }
+
+    OE_OpenJournal = NULL;
+
+    OE_EXIT_CRITICAL();
+
+    if (Journal->Log != NULL)
+    {
+        OE_Journal_commit(Journal);
+
+        OE_Journal_subscribe(
+            Journal,
+            Journal->Config.NumberOfRequests,
+            false);
+
+        munmap(Journal->Log, Journal->Config.Size);
+        Journal->Log = NULL;
+    }
+
+    if (Journal->File >= 0)
+    {
+        close(Journal->File);
+        Journal->File = -1;
+    }
+}
+
+size_t OE_Journal_replay(
+    OE_Journal_t *Journal)
+{
+    OE_MessageHeader_t Header;
+    const uint8_t *Record;
+    const void *Parameters;
+    size_t Count = 0;
+    size_t Size;
+    size_t DataLength;
+    uint8_t Type;
+    OE_RequestID_t RequestID;
+    OE_Error_t Error;
+#if OE_USE_WIRE_FORMAT
+    OE_WireDecoder_t Decode;
+
+    /* The parameters are decoded into a buffer that is aligned for any struct. */
+    union
+    {
+        uint8_t Bytes[OE_MESSAGE_DATA_SIZE];
+        max_align_t Alignment;
+    } Data;
+#endif // OE_USE_WIRE_FORMAT
+
+    while (Journal->ReplayOffset < Journal->Length)
+    {
+        Record = &(Journal->Log[Journal->ReplayOffset]);
+        RequestID = (OE_RequestID_t)OE_Journal_read16(&(Record[4]));
+        DataLength = OE_Journal_read16(&(Record[6]));
+        Type = Record[8];
+        Size = OE_JOURNAL_RECORD_SIZE(DataLength);
+        Parameters = NULL;
+
+        if (!(Type & OE_JOURNAL_RECORD_DATA_EMPTY))
+        {
+            Parameters = &(Record[OE_JOURNAL_RECORD_HEADER_SIZE]);
+        }
+
+#if OE_USE_WIRE_FORMAT
+        if (Parameters != NULL && (Type & OE_JOURNAL_RECORD_ENCODED))
+        {
+            Decode = (Journal->Config.Codecs != NULL) ?
+                Journal->Config.Codecs[RequestID].DecodeRequest : NULL;
+
+            /* The encoded parameters must be read completely. */
+            if (Decode == NULL ||
+                Decode(Data.Bytes, Parameters, DataLength) != DataLength)
+            {
+                Journal->RecordsDropped++;
+                Journal->ReplayOffset += Size;
+                continue;
+            }
+
+            Parameters = Data.Bytes;
+        }
+        else
+#endif // OE_USE_WIRE_FORMAT
+        if (Parameters != NULL && DataLength != OE_MESSAGE_DATA_SIZE)
+        {
+            Journal->RecordsDropped++;
+            Journal->ReplayOffset += Size;
+            continue;
+        }
+
+        /* Replayed requests are never answered and not appended again. */
+        Header = (OE_MessageHeader_t){
+            .RequestID = RequestID,
+            .ResponseHandler = OE_NO_HANDLER,
+            .KernelID = Journal->Kernel->KernelID,
+        };
+
+        Error = OE_Core_replayRequest(
+            &Header,
+            Parameters);
+
+        /* The request is sent again when the kernels have made room. */
+        if (Error == OE_ERROR_MESSAGE_QUEUE_FULL || Error == OE_ERROR_REQUEST_LIMIT_REACHED)
+        {
+            break;
+        }
+
+        Journal->ReplayOffset += Size;
+        Journal->RecordsReplayed++;
+        Count++;
+    }
+
+    return Count;
+}
+
+OE_Error_t OE_Journal_append(
+    OE_Journal_t *Journal,
+    const OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    uint8_t *Record;
+    size_t DataLength = 0;
+    uint8_t Type = 0;
+#if OE_USE_WIRE_FORMAT
+    OE_WireEncoder_t Encode = NULL;
+#endif
+
+    if (Header->RequestID >= OE_NUMBER_OF_REQUESTS)
+    {
+        return OE_ERROR_REQUEST_ID_INVALID;
+    }
+
+    if (Header->Information & OE_MESSAGE_REPLAYED)
+    {
+        return OE_ERROR_NONE;
+    }
+
+    if (Header->Information & OE_MESSAGE_DATA_EMPTY)
+    {
+        Parameters = NULL;
+    }
+
+    /* The log does not wrap. */
+    if (Journal->Length + OE_JOURNAL_RECORD_SIZE(OE_JOURNAL_DATA_SIZE) > Journal->Config.Size)
+    {
+        Journal->RecordsDropped++;
+        return OE_ERROR_MESSAGE_QUEUE_FULL;
+    }
+
+    Record = &(Journal->Log[Journal->Length]);
+
+    if (Parameters == NULL)
+    {
+        Type |= OE_JOURNAL_RECORD_DATA_EMPTY;
+    }
+#if OE_USE_WIRE_FORMAT
+    else if (Journal->Config.Codecs != NULL)
+    {
+        Encode = Journal->Config.Codecs[Header->RequestID].EncodeRequest;
+    }
+
+    if (Encode != NULL)
+    {
+        Type |= OE_JOURNAL_RECORD_ENCODED;
+        DataLength = Encode(Parameters, &(Record[OE_JOURNAL_RECORD_HEADER_SIZE]));
+    }
+    else
+#endif // OE_USE_WIRE_FORMAT
+    if (Parameters != NULL)
+    {
+        memcpy(
+            &(Record[OE_JOURNAL_RECORD_HEADER_SIZE]),
+            Parameters,
+            OE_MESSAGE_DATA_SIZE);
+
+        DataLength = OE_MESSAGE_DATA_SIZE;
+    }
+
+    OE_Journal_write16(&(Record[4]), (uint16_t)Header->RequestID);
+    OE_Journal_write16(&(Record[6]), (uint16_t)DataLength);
+    Record[8] = Type;
+
+    /* The padding is cleared, so that the log holds no stale bytes. */
+    memset(
+        &(Record[OE_JOURNAL_RECORD_HEADER_SIZE + DataLength]),
+        0,
+        OE_JOURNAL_RECORD_SIZE(DataLength) - OE_JOURNAL_RECORD_HEADER_SIZE - DataLength);
+
+    OE_Journal_write32(
+        &(Record[0]),
+        OE_Journal_crc(
+            Journal->Epoch,
+            &(Record[4]),
+            OE_JOURNAL_RECORD_HEADER_SIZE - 4 + DataLength));
+
+    Journal->Length += OE_JOURNAL_RECORD_SIZE(DataLength);
+    Journal->RecordsAppended++;
+
+    if (Journal->Uncommitted == 0)
+    {
+        Journal->CommitStart = OE_GET_TICKS();
+    }
+
+    Journal->Uncommitted++;
+
+    if (Journal->Uncommitted >= Journal->Config.GroupSize)
+    {
+        OE_Journal_commit(Journal);
+    }
+
+    return OE_ERROR_NONE;
+}
+
+OE_Error_t OE_Journal_commit(
+    OE_Journal_t *Journal)
+{
+    size_t PageSize = (size_t)sysconf(_SC_PAGESIZE);
+    size_t Start;
+
+    if (Journal->Uncommitted == 0)
+    {
+        return OE_ERROR_NONE;
+    }
+
+    /* The mapping is written in whole pages. */
+    Start = Journal->CommittedLength - (Journal->CommittedLength % PageSize);
+
+    if (msync(&(Journal->Log[Start]), Journal->Length - Start, MS_SYNC) != 0)
+    {
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    Journal->RecordsCommitted += Journal->Uncommitted;
+    Journal->Commits++;
+    Journal->Uncommitted = 0;
+    Journal->CommittedLength = Journal->Length;
+
+    return OE_ERROR_NONE;
+}
+
+size_t OE_Journal_poll(
+    OE_Journal_t *Journal)
+{
+    size_t Count = Journal->Uncommitted;
+
+    if (Count > 0 &&
+        (uint32_t)(OE_GET_TICKS() - Journal->CommitStart) >= Journal->Config.CommitTicks &&
+        OE_Journal_commit(Journal) == OE_ERROR_NONE)
+    {
+        return Count;
+    }
+
+    return 0;
+}
+
+OE_Error_t OE_Journal_clear(
+    OE_Journal_t *Journal)
+{
+    /* The records of the old epoch become invalid at once. */
+    Journal->Epoch++;
+    Journal->Length = OE_JOURNAL_HEADER_SIZE;
+    Journal->CommittedLength = OE_JOURNAL_HEADER_SIZE;
+    Journal->ReplayOffset = OE_JOURNAL_HEADER_SIZE;
+    Journal->Uncommitted = 0;
+
+    return OE_Journal_writeHeader(Journal);
+}
+
+void OE_Journal_handleRequest(
+    OE_MessageHeader_t *Header,
+    const void *Parameters)
+{
+    OE_Journal_t *Journal = OE_OpenJournal;
+
+    if (Journal == NULL)
+    {
+        return;
+    }
+
+    OE_Journal_append(
+        Journal,
+        Header,
+        Parameters);
+}
+
+OE_Error_t OE_Journal_subscribe(
+    OE_Journal_t *Journal,
+    size_t Count,
+    bool Subscribe)
+{
+    OE_MessageHandler_t RequestHandler = (OE_MessageHandler_t)OE_Journal_handleRequest;
+    OE_RequestID_t RequestID;
+    OE_Error_t Error;
+
+    for (size_t Index = 0; Index < Count; Index++)
+    {
+        RequestID = Journal->Config.Requests[Index];
+
+        if (!Subscribe)
+        {
+            OE_Kernel_unregisterHandlers(
+                Journal->Kernel,
+                &RequestID,
+                &RequestHandler,
+                1);
+
+            continue;
+        }
+
+        Error = OE_Kernel_registerHandlers(
+            Journal->Kernel,
+            &RequestID,
+            &RequestHandler,
+            1);
+
+        if (Error != OE_ERROR_NONE)
+        {
+            OE_Journal_subscribe(
+                Journal,
+                Index,
+                false);
+
+            /* The journal is closed without unsubscribing again. */
+            Journal->Config.NumberOfRequests = 0;
+
+            return Error;
+        }
+    }
+
+    return OE_ERROR_NONE;
+}
+
+OE_Error_t OE_Journal_recover(
+    OE_Journal_t *Journal)
+{
+    uint8_t *Log = Journal->Log;
+    size_t Offset = OE_JOURNAL_HEADER_SIZE;
+    size_t End;
+    size_t Size;
+
+    if (OE_Journal_read32(&(Log[0])) != OE_JOURNAL_MAGIC)
+    {
+        /* A new log starts with the first epoch. */
+        Journal->Epoch = 0;
+        return OE_Journal_clear(Journal);
+    }
+
+    Journal->Epoch = OE_Journal_read32(&(Log[12]));
+
+    if (Log[4] != OE_JOURNAL_VERSION ||
+        OE_Journal_read16(&(Log[6])) != OE_NUMBER_OF_REQUESTS ||
+        OE_Journal_read16(&(Log[8])) != OE_MESSAGE_DATA_SIZE)
+    {
+        return OE_Journal_clear(Journal);
+    }
+
+    while ((Size = OE_Journal_checkRecord(Journal, Offset)) > 0)
+    {
+        Offset += Size;
+    }
+
+    Journal->Length = Offset;
+    Journal->CommittedLength = Offset;
+    Journal->ReplayOffset = OE_JOURNAL_HEADER_SIZE;
+
+    /* Find the last byte that is not cleared yet. */
+    for (End = Journal->Config.Size; End > Offset; End--)
+    {
+        if (Log[End - 1] != 0)
+        {
+            break;
+        }
+    }
+
+    if (End > Offset)
+    {
+        memset(&(Log[Offset]), 0, End - Offset);
+
+        if (msync(Log, End, MS_SYNC) != 0)
+        {
+            return OE_ERROR_UNSPECIFIED;
+        }
+    }
+
+    return OE_ERROR_NONE;
+}
+
+size_t OE_Journal_checkRecord(
+    OE_Journal_t *Journal,
+    size_t Offset)
+{
+    const uint8_t *Record = &(Journal->Log[Offset]);
+    size_t DataLength;
+
+    if (Offset + OE_JOURNAL_RECORD_HEADER_SIZE > Journal->Config.Size)
+    {
+        return 0;
+    }
+
+    DataLength = OE_Journal_read16(&(Record[6]));
+
+    if (DataLength > OE_JOURNAL_DATA_SIZE ||
+        Offset + OE_JOURNAL_RECORD_SIZE(DataLength) > Journal->Config.Size ||
+        OE_Journal_read16(&(Record[4])) >= OE_NUMBER_OF_REQUESTS)
+    {
+        return 0;
+    }
+
+    if (OE_Journal_read32(&(Record[0])) != OE_Journal_crc(
+            Journal->Epoch,
+            &(Record[4]),
+            OE_JOURNAL_RECORD_HEADER_SIZE - 4 + DataLength))
+    {
+        return 0;
+    }
+
+    return OE_JOURNAL_RECORD_SIZE(DataLength);
+}
+
+OE_Error_t OE_Journal_writeHeader(
+    OE_Journal_t *Journal)
+{
+    uint8_t *Log = Journal->Log;
+
+    OE_Journal_write32(&(Log[0]), OE_JOURNAL_MAGIC);
+    Log[4] = OE_JOURNAL_VERSION;
+    Log[5] = 0;
+    OE_Journal_write16(&(Log[6]), OE_NUMBER_OF_REQUESTS);
+    OE_Journal_write16(&(Log[8]), OE_MESSAGE_DATA_SIZE);
+    OE_Journal_write16(&(Log[10]), 0);
+    OE_Journal_write32(&(Log[12]), Journal->Epoch);
+
+    if (msync(Log, OE_JOURNAL_HEADER_SIZE, MS_SYNC) != 0)
+    {
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    return OE_ERROR_NONE;
+}
+
+uint32_t OE_Journal_crc(
+    uint32_t Epoch,
+    const uint8_t *Buffer,
+    size_t Length)
+{
+    /* CRC-32 (IEEE 802.3), computed a nibble at a time to keep the table small. */
+    static const uint32_t Table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+        0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+        0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    uint8_t EpochBytes[4];
+    uint32_t Crc = 0xFFFFFFFF;
+
+    OE_Journal_write32(EpochBytes, Epoch);
+
+    for (size_t Index = 0; Index < sizeof(EpochBytes) + Length; Index++)
+    {
+        uint8_t Byte = (Index < sizeof(EpochBytes)) ?
+            EpochBytes[Index] : Buffer[Index - sizeof(EpochBytes)];
+
+        Crc = (Crc >> 4) ^ Table[(Crc ^ Byte) & 0x0F];
+        Crc = (Crc >> 4) ^ Table[(Crc ^ (Byte >> 4)) & 0x0F];
+    }
+
+    return Crc ^ 0xFFFFFFFF;
+}
+#endif // OE_USE_JOURNAL
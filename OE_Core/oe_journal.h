@@ -0,0 +1,227 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_JOURNAL_H
+#define OE_JOURNAL_H
+
+/**
+ * @brief This is the header file of the journal (POSIX only). The journal appends
+ * requests to a log file, so that they survive a reboot, and sends them again on startup.
+ *
+ * Requests are marked as persistent in the module config:
+ *
+ *     - name: Config_Set
+ *       persistent: true
+ *
+ * The marked requests are listed in OE_PERSISTENT_REQUESTS in oe_requests.h. When the
+ * journal is opened, it subscribes these requests in the kernel it belongs to and
+ * appends each of them to the log. The journal should have a kernel of its own, so that
+ * committing the log never blocks the kernels of the application.
+ *
+ * The log file is mapped into memory. Appending a request only copies it into the
+ * mapping. The appended records are committed to the file in groups: once GroupSize
+ * records are waiting or once CommitTicks have passed since the first of them, see
+ * OE_Journal_poll(). A record is durable once it is committed. Each record is protected
+ * by a CRC, so a record that was torn by a crash is detected and the log ends before it.
+ *
+ * OE_Journal_replay() sends the logged requests again and has to be called once all
+ * modules are initialized, but before the kernels run, i.e. before Kernel_Start. The
+ * replayed requests are marked with OE_MESSAGE_REPLAYED and are not appended again.
+ *
+ * The log does not wrap. If it is full, new records are dropped until the log is
+ * cleared with OE_Journal_clear(), e.g. after the application has sent its current
+ * state as new requests. A log of another configuration, i.e. another oe_requests.h,
+ * is cleared when it is opened. Parameters of requests that have codecs in the config
+ * are logged in the wire format (see oe_wire.h), all others are copied as they are.
+ *
+ * Only one journal can be open at a time. A journal is not locked, so all of its
+ * functions have to be called from the thread of the kernel it belongs to, or before
+ * the kernels run.
+ */
+
+#include "oe_defines.h"
+#include "oe_wire.h"
+
+#if OE_USE_JOURNAL
+
+/* The log header holds the magic, the version, the configuration and the epoch. */
+#define OE_JOURNAL_HEADER_SIZE 16
+
+/* Each record holds its CRC, the request ID, the data length and its type. */
+#define OE_JOURNAL_RECORD_HEADER_SIZE 9
+
+/* Encoded parameters may take more space than the message data. */
+#if OE_USE_WIRE_FORMAT
+#define OE_JOURNAL_DATA_SIZE OE_WIRE_DATA_LIMIT
+#else
+#define OE_JOURNAL_DATA_SIZE OE_MESSAGE_DATA_SIZE
+#endif
+
+/**
+ * The config of a journal.
+ */
+typedef struct OE_JournalConfig_s
+{
+    /* The path of the log file. The file is created if it does not exist. */
+    const char *Path;
+
+    /* The size of the log file in bytes. */
+    size_t Size;
+
+    /**
+     * The requests that are appended to the log, e.g. an array that is initialized with
+     * OE_PERSISTENT_REQUESTS. The array has to stay valid while the journal is open.
+     */
+    const OE_RequestID_t *Requests;
+    size_t NumberOfRequests;
+
+    /* The number of records that are committed together. */
+    size_t GroupSize;
+
+    /* The records are committed after this many ticks, even if the group is not full. */
+    uint32_t CommitTicks;
+
+#if OE_USE_WIRE_FORMAT
+    /**
+     * The codecs of the requests by request ID, e.g. an array that is initialized with
+     * OE_REQUEST_CODECS. Parameters without codec are copied as they are. NULL logs
+     * all parameters as they are. The array has to stay valid while the journal is open.
+     */
+    const OE_WireCodec_t *Codecs;
+#endif // OE_USE_WIRE_FORMAT
+
+} OE_JournalConfig_t;
+
+typedef struct OE_Journal_s
+{
+    /* The kernel that subscribes the persistent requests. */
+    OE_Kernel_t *Kernel;
+
+    OE_JournalConfig_t Config;
+
+    /* The log file and its mapping. */
+    int File;
+    uint8_t *Log;
+
+    /* The records of other epochs are invalid. Clearing the log starts a new epoch. */
+    uint32_t Epoch;
+
+    /* The end of all records and the end of the committed records. */
+    size_t Length;
+    size_t CommittedLength;
+
+    /* The number of records that wait for the commit and the ticks of the first one. */
+    size_t Uncommitted;
+    uint32_t CommitStart;
+
+    /* The replay continues at this offset. */
+    size_t ReplayOffset;
+
+    /* Counters for diagnostics. */
+    uint32_t RecordsAppended;
+    uint32_t RecordsCommitted;
+    uint32_t RecordsReplayed;
+    uint32_t RecordsDropped;
+    uint32_t Commits;
+
+} OE_Journal_t;
+
+/**
+ * @brief Open a journal and subscribe its requests.
+ *
+ * The valid records of the log are kept for OE_Journal_replay(). New records are
+ * appended after them.
+ *
+ * @param Journal Pointer to the journal.
+ * @param Kernel Pointer to the kernel the journal belongs to.
+ * @param Config Pointer to the config of the journal. It is copied.
+ * @return OE_Error_t An error is returned if
+ * - a parameter is invalid.
+ * - a journal is open already.
+ * - the log file cannot be opened or mapped.
+ * - the requests cannot be subscribed.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Journal_open(
+    OE_Journal_t *Journal,
+    OE_Kernel_t *Kernel,
+    const OE_JournalConfig_t *Config);
+
+/**
+ * @brief Commit the log and close the journal.
+ *
+ * @param Journal Pointer to the journal.
+ */
+void OE_Journal_close(
+    OE_Journal_t *Journal);
+
+/**
+ * @brief Send the logged requests again.
+ *
+ * If a request cannot be sent because a message queue is full, the replay stops
+ * before it. It continues there when this function is called again.
+ *
+ * @param Journal Pointer to the journal.
+ * @return size_t The number of sent requests is returned.
+ */
+size_t OE_Journal_replay(
+    OE_Journal_t *Journal);
+
+/**
+ * @brief Append a request to the log.
+ *
+ * The journal appends its subscribed requests by itself. Replayed requests are not
+ * appended.
+ *
+ * @param Journal Pointer to the journal.
+ * @param Header Pointer to the header of the request message.
+ * @param Parameters Pointer to the request parameters, or NULL.
+ * @return OE_Error_t An error is returned if
+ * - the request ID is invalid.
+ * - the log is full.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Journal_append(
+    OE_Journal_t *Journal,
+    const OE_MessageHeader_t *Header,
+    const void *Parameters);
+
+/**
+ * @brief Commit the appended records to the log file. This call waits for the file.
+ *
+ * @param Journal Pointer to the journal.
+ * @return OE_Error_t An error is returned if
+ * - writing the file fails. The records are committed with the next commit.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Journal_commit(
+    OE_Journal_t *Journal);
+
+/**
+ * @brief Commit the appended records if their group is due.
+ *
+ * This function has to be called regularly, e.g. from the loop of the kernel the
+ * journal belongs to.
+ *
+ * @param Journal Pointer to the journal.
+ * @return size_t The number of committed records is returned.
+ */
+size_t OE_Journal_poll(
+    OE_Journal_t *Journal);
+
+/**
+ * @brief Remove all records from the log.
+ *
+ * @param Journal Pointer to the journal.
+ * @return OE_Error_t An error is returned if
+ * - writing the file fails.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Journal_clear(
+    OE_Journal_t *Journal);
+#endif // OE_USE_JOURNAL
+
+#endif // OE_JOURNAL_H
@@ -7,16 +7,33 @@
 #include "oe_kernel.h"
 #include "oe_core_mod.h"
 #include "oe_core_intf.h"
+#include "oe_epoll.h"
 
 OE_Error_t OE_Kernel_staticInit(
     OE_Kernel_t *Kernel)
 {
-    /* Init the request map. */
+#if !OE_USE_FAST_BOOT
+    /* Init the request map. It is zero already with OE_USE_FAST_BOOT. */
     OE_RequestMap_staticInit(
         &(Kernel->RequestMap));
+#endif // OE_USE_FAST_BOOT
+
+    Kernel->Epoch = 0;
 
     /* Connect the kernel to the core. */
+#if OE_USE_EPOLL
+    OE_Error_t Error = OE_Core_connectKernel(Kernel);
+
+    if (Error != OE_ERROR_NONE)
+    {
+        return Error;
+    }
+
+    /* The kernel idles in its epoll instance. */
+    return OE_Epoll_open(Kernel->KernelID);
+#else
     return OE_Core_connectKernel(Kernel);
+#endif // OE_USE_EPOLL
 }
 
 OE_Error_t OE_Kernel_registerHandlers(
@@ -29,9 +46,27 @@ OE_Error_t OE_Kernel_registerHandlers(
         Kernel,
         RequestIDs,
         RequestHandlers,
+        NULL,
         NumberOfRequests);
 }
 
+#if OE_USE_REQUEST_FILTERS
+OE_Error_t OE_Kernel_registerFilteredHandlers(
+    OE_Kernel_t *Kernel,
+    OE_RequestID_t *RequestIDs,
+    OE_MessageHandler_t *RequestHandlers,
+    const OE_RequestFilter_t *Filters,
+    size_t NumberOfRequests)
+{
+    return OE_RequestMap_registerHandlers(
+        Kernel,
+        RequestIDs,
+        RequestHandlers,
+        Filters,
+        NumberOfRequests);
+}
+#endif // OE_USE_REQUEST_FILTERS
+
 void OE_Kernel_unregisterHandlers(
     OE_Kernel_t *Kernel,
     OE_RequestID_t *RequestIDs,
@@ -45,6 +80,38 @@ void OE_Kernel_unregisterHandlers(
         NumberOfRequests);
 }
 
+void OE_Kernel_synchronize(
+    OE_Kernel_t *Kernel)
+{
+    uint32_t Epoch;
+
+    if (OE_CURRENT_KERNEL() == Kernel->KernelID)
+    {
+        return;
+    }
+
+    /* The core changes the epoch inside the critical section. */
+    OE_ENTER_CRITICAL();
+    Epoch = Kernel->Epoch;
+    OE_EXIT_CRITICAL();
+
+    /* The kernel is between two messages. */
+    if ((Epoch & 1) == 0)
+    {
+        return;
+    }
+
+    /* Wait until the kernel asks the core for its next message. */
+    while (Kernel->Epoch == Epoch)
+    {
+        OE_YIELD();
+    }
+
+    /* Everything the kernel did before is visible now. */
+    OE_ENTER_CRITICAL();
+    OE_EXIT_CRITICAL();
+}
+
 bool OE_Kernel_handlerRegistered(
     OE_Kernel_t *Kernel,
     OE_RequestID_t RequestID)
@@ -123,44 +190,79 @@ void OE_Kernel_handleMessage(
 {
     if (Message->Header.Information & OE_MESSAGE_TYPE_REQUEST) // Request
     {
-        OE_RequestMapNode_t *MapNode = OE_RequestMap_getHandlers(
-            &(Kernel->RequestMap),
-            Message->Header.RequestID);
+        OE_RequestMapNode_t MapNode;
 
-        if (MapNode == NULL)
+        if (Message->Header.RequestID >= OE_NUMBER_OF_REQUESTS)
         {
             return;
         }
 
-        for (size_t Count = 0; Count < MapNode->NumberOfHandlers; Count++)
+        /**
+         * The handlers are called from a copy. Handlers that are (un)registered
+         * meanwhile, e.g. by one of the handlers, do not change this dispatch.
+         */
+        OE_RequestMap_copyHandlers(
+            &(Kernel->RequestMap),
+            Message->Header.RequestID,
+            &MapNode);
+
+        for (size_t Count = 0; Count < MapNode.NumberOfHandlers; Count++)
         {
+#if OE_USE_REQUEST_FILTERS
+            /* Other handlers of this kernel may have wanted the request. */
+            if (!OE_RequestFilter_matches(
+                    &(MapNode.Filters[Count]),
+                    (Message->Header.Information & OE_MESSAGE_DATA_EMPTY) ? NULL : Message->Data))
+            {
+                continue;
+            }
+#endif // OE_USE_REQUEST_FILTERS
+
             if (Message->Header.Information & OE_MESSAGE_DATA_EMPTY)
             {
                 /* There is no message data. */
-                MapNode->RequestHandlers[Count](
+                MapNode.RequestHandlers[Count](
                     &(Message->Header));
             }
             else
             {
                 /* Message data is present. */
-                MapNode->RequestHandlers[Count](
+                MapNode.RequestHandlers[Count](
                     &(Message->Header),
                     Message->Data);
             }
         }
+
+#if OE_USE_MESSAGE_POOL
+        /* All handlers of this kernel are done with the block. */
+        OE_Core_releaseBlock(Message->Header.Block);
+#endif // OE_USE_MESSAGE_POOL
     }
     else // Response
     {
+#if OE_USE_SHARED_CORE
+        /* The index was given out by this process when the request was sent. */
+        OE_MessageHandler_t ResponseHandler = OE_Core_getResponseHandler(
+            Message->Header.ResponseIndex);
+
+        if (ResponseHandler == OE_NO_HANDLER)
+        {
+            return;
+        }
+#else
+        OE_MessageHandler_t ResponseHandler = Message->Header.ResponseHandler;
+#endif // OE_USE_SHARED_CORE
+
         if (Message->Header.Information & OE_MESSAGE_DATA_EMPTY)
         {
             /* There is no message data. */
-            Message->Header.ResponseHandler(
+            ResponseHandler(
                 &(Message->Header));
         }
         else
         {
             /* Message data is present. */
-            Message->Header.ResponseHandler(
+            ResponseHandler(
                 &(Message->Header),
                 Message->Data);
         }
@@ -38,6 +38,9 @@ struct OE_Kernel_s
     /* Connection to the core. */
     OE_Core_t *Core;
 
+    /* The core makes this odd while the kernel handles a message, see OE_Kernel_synchronize(). */
+    volatile uint32_t Epoch;
+
     /* The request map maps request IDs to message handlers. */
     OE_RequestMap_t RequestMap;
 }; /* A typedef is done in oe_defines.h */
@@ -48,6 +51,10 @@ struct OE_Kernel_s
  * This function initializes the request map
  * and connects the kernel to the core.
  *
+ * With OE_USE_FAST_BOOT the kernel has to be in zero-initialized
+ * static storage, e.g. a static variable, and the request map is
+ * not initialized again.
+ *
  * @param Kernel The pointer to the kernel to be initialized.
  */
 OE_Error_t OE_Kernel_staticInit(
@@ -76,6 +83,35 @@ OE_Error_t OE_Kernel_registerHandlers(
     OE_MessageHandler_t *RequestHandlers,
     size_t NumberOfRequests);
 
+#if OE_USE_REQUEST_FILTERS
+/**
+ * @brief Register a list of message handlers with request filters.
+ *
+ * This function works like OE_Kernel_registerHandlers(), but each handler only
+ * receives the requests that match the filter at the same index. The filters are
+ * checked by the core before a request is queued. A request that none of the
+ * handlers of this kernel wants does not take a slot in its message queue.
+ * Use OE_NO_FILTER for handlers that take every request.
+ *
+ * @param Kernel The pointer to the kernel that will register the handlers
+ * in its request map.
+ * @param RequestIDs Pointer to the array of request IDs.
+ * @param RequestHandlers Pointer to the array of message handlers to be registered.
+ * @param Filters Pointer to the array of request filters.
+ * @param NumberOfHandlers The number of request IDs, handlers and filters.
+ * @return OE_Error_t An error is returned if
+ * - registering the handlers results in an error.
+ * - one of the filters exceeds the message data or has an unsupported size.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_Kernel_registerFilteredHandlers(
+    OE_Kernel_t *Kernel,
+    OE_RequestID_t *RequestIDs,
+    OE_MessageHandler_t *RequestHandlers,
+    const OE_RequestFilter_t *Filters,
+    size_t NumberOfRequests);
+#endif // OE_USE_REQUEST_FILTERS
+
 /**
  * @brief Unregister a list of message handlers for a list of request IDs.
  *
@@ -83,6 +119,8 @@ OE_Error_t OE_Kernel_registerHandlers(
  * It is used by a module to unregister one or more message handlers.
  * This can be done at any time during operation. Once a request handler is
  * unregistered, the kernel will no longer execute it when the request occures.
+ * A dispatch that already started on another thread may still call the handler
+ * once. Use OE_Kernel_synchronize() to wait for it.
  *
  * @param Kernel The pointer to the kernel that will unregister the handlers
  * in its request map.
@@ -96,6 +134,26 @@ void OE_Kernel_unregisterHandlers(
     OE_MessageHandler_t *RequestHandlers,
     size_t NumberOfRequests);
 
+/**
+ * @brief Wait until a message that a kernel is handling right now is handled.
+ *
+ * The kernel reads its request map without locking it. A handler that is
+ * unregistered from another thread may therefore still run once. After this
+ * function returns, the kernel has left the message it was handling, so such a
+ * handler is done and its data may be released. The end of a message is noticed
+ * when the kernel asks the core for the next one (see OE_Core_getMessage()), so
+ * the fast path does not pay for it.
+ *
+ * The function returns immediately if the kernel is idle or if it is called by
+ * a handler of the kernel itself and the port provides OE_CURRENT_KERNEL().
+ * Otherwise it must not be called by a handler of the kernel, since it would
+ * wait for itself.
+ *
+ * @param Kernel The pointer to the kernel to wait for.
+ */
+void OE_Kernel_synchronize(
+    OE_Kernel_t *Kernel);
+
 /**
  * @brief Checks if at least one handler is registered for a given request ID.
  *
@@ -151,7 +209,7 @@ bool OE_Kernel_runOnce(
  *
  * This method is called after a new message was received from the core.
  * According to the message type the message is forwarded as either a request or
- * a response.
+ * a response. The block a request carries is released after its handlers returned.
  *
  * @param Kernel The pointer to the kernel that handles the message.
  * @param Message Pointer to the received message.
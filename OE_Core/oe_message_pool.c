@@ -0,0 +1,252 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#include "oe_message_pool.h"
+
+#if OE_USE_MESSAGE_POOL
+/* The pool is shared by all kernels (and processes), so its lists and counters are accessed atomically. */
+#define OE_MESSAGE_POOL_LOAD(Value) __atomic_load_n(Value, __ATOMIC_ACQUIRE)
+#define OE_MESSAGE_POOL_CAS(Value, Expected, Desired) \
+    __atomic_compare_exchange_n(Value, Expected, Desired, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+/* A handle holds the generation of the block in its upper half and the block number in its lower half. */
+#define OE_MESSAGE_POOL_HANDLE(Index, Generation) (((OE_Block_t)(Generation) << 16) | (OE_Block_t)((Index) + 1))
+
+#define OE_MESSAGE_POOL_BLOCK_SIZE(Size, Count) (Size),
+#define OE_MESSAGE_POOL_BLOCK_COUNT(Size, Count) (Count),
+
+static const uint32_t OE_MessagePool_blockSizes[OE_MESSAGE_POOL_NUMBER_OF_CLASSES] = {
+    OE_MESSAGE_POOL_CLASSES(OE_MESSAGE_POOL_BLOCK_SIZE)};
+
+static const uint16_t OE_MessagePool_blockCounts[OE_MESSAGE_POOL_NUMBER_OF_CLASSES] = {
+    OE_MESSAGE_POOL_CLASSES(OE_MESSAGE_POOL_BLOCK_COUNT)};
+
+/**
+ * @brief Get the index of the block a handle refers to.
+ *
+ * @param Block The handle of the block.
+ * @return size_t The index of the block is returned. Returns OE_MESSAGE_POOL_NUMBER_OF_BLOCKS
+ * if the handle is out of range.
+ */
+static inline size_t OE_MessagePool_indexOf(
+    OE_Block_t Block);
+
+/**
+ * @brief Put a free block on the free list of its class.
+ *
+ * @param MessagePool The pointer to the message pool.
+ * @param Index The index of the block.
+ */
+static inline void OE_MessagePool_push(
+    OE_MessagePool_t *MessagePool,
+    size_t Index);
+
+/**
+ * @brief Take a block from the free list of a class.
+ *
+ * @param MessagePool The pointer to the message pool.
+ * @param Class The size class.
+ * @return size_t The index of the block is returned. Returns OE_MESSAGE_POOL_NUMBER_OF_BLOCKS
+ * if the class has no free block.
+ */
+static inline size_t OE_MessagePool_pop(
+    OE_MessagePool_t *MessagePool,
+    size_t Class);
+
+void OE_MessagePool_staticInit(
+    OE_MessagePool_t *MessagePool)
+{
+    size_t Index = 0;
+    uint32_t Offset = 0;
+
+    for (size_t Class = 0; Class < OE_MESSAGE_POOL_NUMBER_OF_CLASSES; Class++)
+    {
+        MessagePool->FreeLists[Class] = 0;
+
+        for (size_t Count = 0; Count < OE_MessagePool_blockCounts[Class]; Count++)
+        {
+            MessagePool->References[Index] = 0;
+            MessagePool->Generations[Index] = 0;
+            MessagePool->Classes[Index] = (uint8_t)Class;
+            MessagePool->Offsets[Index] = Offset;
+
+            Offset += OE_MessagePool_blockSizes[Class];
+            Index++;
+        }
+    }
+
+    /* Push in reverse order, so that the blocks are handed out in order of their memory. */
+    while (Index-- > 0)
+    {
+        OE_MessagePool_push(MessagePool, Index);
+    }
+}
+
+OE_Block_t OE_MessagePool_allocate(
+    OE_MessagePool_t *MessagePool,
+    size_t Size)
+{
+    size_t Index;
+
+    for (size_t Class = 0; Class < OE_MESSAGE_POOL_NUMBER_OF_CLASSES; Class++)
+    {
+        if (Size > OE_MessagePool_blockSizes[Class])
+        {
+            continue;
+        }
+
+        /* A larger class is used if all blocks of this one are taken. */
+        Index = OE_MessagePool_pop(MessagePool, Class);
+
+        if (Index < OE_MESSAGE_POOL_NUMBER_OF_BLOCKS)
+        {
+            __atomic_store_n(&MessagePool->References[Index], 1, __ATOMIC_RELEASE);
+
+            return OE_MESSAGE_POOL_HANDLE(Index, MessagePool->Generations[Index]);
+        }
+    }
+
+    return OE_NO_BLOCK;
+}
+
+void *OE_MessagePool_getData(
+    OE_MessagePool_t *MessagePool,
+    OE_Block_t Block)
+{
+    size_t Index = OE_MessagePool_indexOf(Block);
+
+    if (Index >= OE_MESSAGE_POOL_NUMBER_OF_BLOCKS ||
+        OE_MESSAGE_POOL_HANDLE(Index, MessagePool->Generations[Index]) != Block)
+    {
+        return NULL;
+    }
+
+    return (uint8_t *)MessagePool->Memory + MessagePool->Offsets[Index];
+}
+
+size_t OE_MessagePool_getSize(
+    OE_MessagePool_t *MessagePool,
+    OE_Block_t Block)
+{
+    size_t Index = OE_MessagePool_indexOf(Block);
+
+    if (Index >= OE_MESSAGE_POOL_NUMBER_OF_BLOCKS ||
+        OE_MESSAGE_POOL_HANDLE(Index, MessagePool->Generations[Index]) != Block)
+    {
+        return 0;
+    }
+
+    return OE_MessagePool_blockSizes[MessagePool->Classes[Index]];
+}
+
+bool OE_MessagePool_retain(
+    OE_MessagePool_t *MessagePool,
+    OE_Block_t Block)
+{
+    size_t Index = OE_MessagePool_indexOf(Block);
+    uint16_t References;
+
+    /* The caller holds a reference, so the generation cannot change meanwhile. */
+    if (Index >= OE_MESSAGE_POOL_NUMBER_OF_BLOCKS ||
+        OE_MESSAGE_POOL_HANDLE(Index, OE_MESSAGE_POOL_LOAD(&MessagePool->Generations[Index])) != Block)
+    {
+        return false;
+    }
+
+    References = OE_MESSAGE_POOL_LOAD(&MessagePool->References[Index]);
+
+    do
+    {
+        /* A free block cannot be revived. */
+        if (References == 0 || References == UINT16_MAX)
+        {
+            return false;
+        }
+    } while (!OE_MESSAGE_POOL_CAS(&MessagePool->References[Index], &References, References + 1));
+
+    return true;
+}
+
+void OE_MessagePool_release(
+    OE_MessagePool_t *MessagePool,
+    OE_Block_t Block)
+{
+    size_t Index = OE_MessagePool_indexOf(Block);
+
+    if (Index >= OE_MESSAGE_POOL_NUMBER_OF_BLOCKS ||
+        OE_MESSAGE_POOL_HANDLE(Index, OE_MESSAGE_POOL_LOAD(&MessagePool->Generations[Index])) != Block ||
+        OE_MESSAGE_POOL_LOAD(&MessagePool->References[Index]) == 0)
+    {
+        return;
+    }
+
+    if (__atomic_sub_fetch(&MessagePool->References[Index], 1, __ATOMIC_ACQ_REL) != 0)
+    {
+        return;
+    }
+
+    /* The handles of this block are invalid from now on. */
+    __atomic_add_fetch(&MessagePool->Generations[Index], 1, __ATOMIC_RELEASE);
+
+    OE_MessagePool_push(MessagePool, Index);
+}
+
+size_t OE_MessagePool_indexOf(
+    OE_Block_t Block)
+{
+    uint16_t Number = (uint16_t)(Block & 0xFFFF);
+
+    if (Number == 0 || Number > OE_MESSAGE_POOL_NUMBER_OF_BLOCKS)
+    {
+        return OE_MESSAGE_POOL_NUMBER_OF_BLOCKS;
+    }
+
+    return Number - 1;
+}
+
+void OE_MessagePool_push(
+    OE_MessagePool_t *MessagePool,
+    size_t Index)
+{
+    uint32_t *FreeList = &MessagePool->FreeLists[MessagePool->Classes[Index]];
+    uint32_t Head = OE_MESSAGE_POOL_LOAD(FreeList);
+    uint32_t Tag;
+
+    do
+    {
+        __atomic_store_n(&MessagePool->Next[Index], (uint16_t)(Head & 0xFFFF), __ATOMIC_RELAXED);
+        Tag = (Head >> 16) + 1;
+    } while (!OE_MESSAGE_POOL_CAS(FreeList, &Head, (Tag << 16) | (uint32_t)(Index + 1)));
+}
+
+size_t OE_MessagePool_pop(
+    OE_MessagePool_t *MessagePool,
+    size_t Class)
+{
+    uint32_t *FreeList = &MessagePool->FreeLists[Class];
+    uint32_t Head = OE_MESSAGE_POOL_LOAD(FreeList);
+    uint16_t Number;
+    uint32_t Tag;
+
+    do
+    {
+        Number = (uint16_t)(Head & 0xFFFF);
+
+        if (Number == 0)
+        {
+            return OE_MESSAGE_POOL_NUMBER_OF_BLOCKS;
+        }
+
+        /* The next block may be outdated, the tag makes the swap fail in that case. */
+        Tag = (Head >> 16) + 1;
+    } while (!OE_MESSAGE_POOL_CAS(
+        FreeList,
+        &Head,
+        (Tag << 16) | __atomic_load_n(&MessagePool->Next[Number - 1], __ATOMIC_RELAXED)));
+
+    return Number - 1;
+}
+#endif // OE_USE_MESSAGE_POOL
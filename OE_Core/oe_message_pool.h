@@ -0,0 +1,130 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_MESSAGE_POOL_H
+#define OE_MESSAGE_POOL_H
+
+/**
+ * @brief This file is the header of the message pool, a pool of fixed size blocks for
+ * payloads that do not fit into the message data. The core holds one message pool.
+ *
+ * The blocks are grouped into size classes, see OE_MESSAGE_POOL_CLASSES in oe_config.h.
+ * Each class has a fixed number of blocks in static memory, so the pool never
+ * fragments. A block is allocated from the smallest class that fits and has a free
+ * block. The free blocks of each class are kept in a lock-free list, so blocks can be
+ * allocated and freed from any thread without a critical section.
+ *
+ * A block is referred to by a handle, not by a pointer, so a handle can be passed
+ * between processes that share the core. The handle also holds the generation of the
+ * block, so a handle is invalid once its block was freed.
+ *
+ * Each block counts its references. Allocating a block takes the first reference and
+ * the block is freed when the last one is released. A request that carries a block
+ * (see the Block in OE_MessageHeader_t) holds one reference for each queued message.
+ */
+
+#include "oe_defines.h"
+
+#if OE_USE_MESSAGE_POOL
+typedef struct OE_MessagePool_s
+{
+    /**
+     * The free list of each size class. The lower half holds the number of the first free
+     * block (its index + 1, 0 if the list is empty). The upper half is a tag that changes
+     * with each update, so that an update based on an outdated list fails.
+     */
+    uint32_t FreeLists[OE_MESSAGE_POOL_NUMBER_OF_CLASSES];
+
+    /* The number of the next free block of each free block. */
+    uint16_t Next[OE_MESSAGE_POOL_NUMBER_OF_BLOCKS];
+
+    /* The number of references of each block. Free blocks have none. */
+    uint16_t References[OE_MESSAGE_POOL_NUMBER_OF_BLOCKS];
+
+    /* The generation of each block changes when the block is freed. */
+    uint16_t Generations[OE_MESSAGE_POOL_NUMBER_OF_BLOCKS];
+
+    /* The size class and the memory offset of each block. */
+    uint8_t Classes[OE_MESSAGE_POOL_NUMBER_OF_BLOCKS];
+    uint32_t Offsets[OE_MESSAGE_POOL_NUMBER_OF_BLOCKS];
+
+    /* The memory of the blocks. */
+    uint64_t Memory[OE_MESSAGE_POOL_MEMORY_SIZE / sizeof(uint64_t)];
+
+} OE_MessagePool_t;
+
+/**
+ * @brief Initialize the message pool statically. All blocks are free afterwards.
+ *
+ * @param MessagePool The pointer to the message pool to be initialized.
+ */
+void OE_MessagePool_staticInit(
+    OE_MessagePool_t *MessagePool);
+
+/**
+ * @brief Allocate a block. The caller holds its first reference.
+ *
+ * @param MessagePool The pointer to the message pool.
+ * @param Size The number of bytes that are needed.
+ * @return OE_Block_t The handle of the block is returned. Returns OE_NO_BLOCK if
+ * no class that fits has a free block.
+ */
+OE_Block_t OE_MessagePool_allocate(
+    OE_MessagePool_t *MessagePool,
+    size_t Size);
+
+/**
+ * @brief Get the memory of a block.
+ *
+ * @param MessagePool The pointer to the message pool.
+ * @param Block The handle of the block.
+ * @return void* The pointer to the memory of the block is returned. Returns NULL if
+ * the handle is invalid.
+ */
+void *OE_MessagePool_getData(
+    OE_MessagePool_t *MessagePool,
+    OE_Block_t Block);
+
+/**
+ * @brief Get the size of a block.
+ *
+ * @param MessagePool The pointer to the message pool.
+ * @param Block The handle of the block.
+ * @return size_t The size of the block's class is returned. Returns 0 if the handle
+ * is invalid.
+ */
+size_t OE_MessagePool_getSize(
+    OE_MessagePool_t *MessagePool,
+    OE_Block_t Block);
+
+/**
+ * @brief Take another reference to a block.
+ *
+ * The caller has to hold a reference already, e.g. the one of the request it handles.
+ *
+ * @param MessagePool The pointer to the message pool.
+ * @param Block The handle of the block.
+ * @return true The reference was taken.
+ * @return false The handle is invalid.
+ */
+bool OE_MessagePool_retain(
+    OE_MessagePool_t *MessagePool,
+    OE_Block_t Block);
+
+/**
+ * @brief Release a reference to a block. The block is freed with its last reference.
+ *
+ * Invalid handles and OE_NO_BLOCK are ignored.
+ *
+ * @param MessagePool The pointer to the message pool.
+ * @param Block The handle of the block.
+ */
+void OE_MessagePool_release(
+    OE_MessagePool_t *MessagePool,
+    OE_Block_t Block);
+#endif // OE_USE_MESSAGE_POOL
+
+#endif // OE_MESSAGE_POOL_H
@@ -79,4 +79,149 @@ OE_Message_t* OE_MessageQueue_getMessage(
     MessageQueue->NumberOfMessages--;
 
     return Message;
-}
\ No newline at end of file
+}
+
+OE_Message_t* OE_MessageQueue_findRequest(
+    OE_MessageQueue_t *MessageQueue,
+    OE_RequestID_t RequestID,
+    bool Newest)
+{
+    OE_Message_t *Found = NULL;
+    OE_Message_t *Message;
+    size_t Index = MessageQueue->Tail;
+
+    for (size_t Count = 0; Count < MessageQueue->NumberOfMessages; Count++)
+    {
+        Message = &(MessageQueue->Messages[Index]);
+
+        if ((Message->Header.Information & OE_MESSAGE_TYPE_REQUEST) &&
+            (Message->Header.RequestID == RequestID))
+        {
+            Found = Message;
+
+            if (!Newest)
+            {
+                break;
+            }
+        }
+
+        Index = (Index == OE_MESSAGE_QUEUE_LENGTH) ? 0 : Index + 1;
+    }
+
+    return Found;
+}
+
+OE_Message_t* OE_MessageQueue_findKey(
+    OE_MessageQueue_t *MessageQueue,
+    OE_RequestID_t RequestID,
+    const void *Key,
+    size_t KeySize)
+{
+    OE_Message_t *Found = NULL;
+    OE_Message_t *Message;
+    size_t Index = MessageQueue->Tail;
+
+    for (size_t Count = 0; Count < MessageQueue->NumberOfMessages; Count++)
+    {
+        Message = &(MessageQueue->Messages[Index]);
+
+        if ((Message->Header.Information & OE_MESSAGE_TYPE_REQUEST) &&
+            (Message->Header.RequestID == RequestID) &&
+            (KeySize == 0 || memcmp(Message->Data, Key, KeySize) == 0))
+        {
+            Found = Message;
+        }
+
+        Index = (Index == OE_MESSAGE_QUEUE_LENGTH) ? 0 : Index + 1;
+    }
+
+    return Found;
+}
+
+void OE_MessageQueue_removeMessage(
+    OE_MessageQueue_t *MessageQueue,
+    OE_Message_t *Message)
+{
+    size_t Index = (size_t)(Message - MessageQueue->Messages);
+    size_t Next;
+
+    if (MessageQueue->NumberOfMessages == 0)
+    {
+        return;
+    }
+
+    /* Move all newer messages up by one. */
+    Next = (Index == OE_MESSAGE_QUEUE_LENGTH) ? 0 : Index + 1;
+
+    while (Next != MessageQueue->Head)
+    {
+        MessageQueue->Messages[Index] = MessageQueue->Messages[Next];
+        Index = Next;
+        Next = (Next == OE_MESSAGE_QUEUE_LENGTH) ? 0 : Next + 1;
+    }
+
+    MessageQueue->Head = Index;
+    MessageQueue->NumberOfMessages--;
+}
+
+#if OE_USE_ISR_SEND
+void OE_StagingRing_staticInit(
+    OE_StagingRing_t *StagingRing)
+{
+    memset(StagingRing->Messages, 0, OE_STAGING_RING_LENGTH * sizeof(OE_Message_t));
+
+    StagingRing->Head = 0;
+    StagingRing->Tail = 0;
+    StagingRing->Merging = false;
+}
+
+OE_Message_t* OE_StagingRing_allocateMessage(
+    OE_StagingRing_t *StagingRing)
+{
+    size_t Head = StagingRing->Head;
+
+    if ((Head + 2 * OE_STAGING_RING_LENGTH - StagingRing->Tail) % (2 * OE_STAGING_RING_LENGTH) >= OE_STAGING_RING_LENGTH)
+    {
+        return NULL;
+    }
+
+    /* The slot must not be written before the kernel is done with it. */
+    OE_MEMORY_BARRIER();
+
+    return &(StagingRing->Messages[Head % OE_STAGING_RING_LENGTH]);
+}
+
+void OE_StagingRing_publish(
+    OE_StagingRing_t *StagingRing)
+{
+    /* The message has to be complete before the kernels can see it. */
+    OE_MEMORY_BARRIER();
+
+    StagingRing->Head = (StagingRing->Head + 1) % (2 * OE_STAGING_RING_LENGTH);
+}
+
+OE_Message_t* OE_StagingRing_peekMessage(
+    OE_StagingRing_t *StagingRing)
+{
+    size_t Tail = StagingRing->Tail;
+
+    if (StagingRing->Head == Tail)
+    {
+        return NULL;
+    }
+
+    /* The message must not be read before the head. */
+    OE_MEMORY_BARRIER();
+
+    return &(StagingRing->Messages[Tail % OE_STAGING_RING_LENGTH]);
+}
+
+void OE_StagingRing_removeMessage(
+    OE_StagingRing_t *StagingRing)
+{
+    /* The message has to be read completely before the ISR may overwrite it. */
+    OE_MEMORY_BARRIER();
+
+    StagingRing->Tail = (StagingRing->Tail + 1) % (2 * OE_STAGING_RING_LENGTH);
+}
+#endif // OE_USE_ISR_SEND
\ No newline at end of file
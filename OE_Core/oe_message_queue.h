@@ -70,4 +70,122 @@ OE_Message_t* OE_MessageQueue_allocateMessage(
 OE_Message_t* OE_MessageQueue_getMessage(
     OE_MessageQueue_t *MessageQueue);
 
+/**
+ * @brief Find a queued request message with the given request ID.
+ *
+ * Only messages that are still waiting in the queue are searched. Response
+ * messages are skipped.
+ *
+ * @param MessageQueue The pointer to the message queue.
+ * @param RequestID The request ID to look for.
+ * @param Newest If true, the newest matching message is returned, otherwise the oldest.
+ * @return OE_Message_t* The pointer to the matching message is returned.
+ * Returns NULL if there is no matching message.
+ */
+OE_Message_t* OE_MessageQueue_findRequest(
+    OE_MessageQueue_t *MessageQueue,
+    OE_RequestID_t RequestID,
+    bool Newest);
+
+/**
+ * @brief Find the newest queued request message with the given request ID and key.
+ *
+ * The key is compared with the first bytes of the message data. Only messages that
+ * are still waiting in the queue are searched. Response messages are skipped.
+ *
+ * @param MessageQueue The pointer to the message queue.
+ * @param RequestID The request ID to look for.
+ * @param Key Pointer to the key. May be NULL if the key size is 0.
+ * @param KeySize The size of the key. If it is 0, every message of the request matches.
+ * @return OE_Message_t* The pointer to the matching message is returned.
+ * Returns NULL if there is no matching message.
+ */
+OE_Message_t* OE_MessageQueue_findKey(
+    OE_MessageQueue_t *MessageQueue,
+    OE_RequestID_t RequestID,
+    const void *Key,
+    size_t KeySize);
+
+/**
+ * @brief Remove a queued message from the message queue.
+ *
+ * All newer messages move up by one, so the order of the queue is kept.
+ *
+ * @param MessageQueue The pointer to the message queue.
+ * @param Message The pointer to a message that is waiting in the queue,
+ * e.g. returned by OE_MessageQueue_findRequest().
+ */
+void OE_MessageQueue_removeMessage(
+    OE_MessageQueue_t *MessageQueue,
+    OE_Message_t *Message);
+
+#if OE_USE_ISR_SEND
+/**
+ * The staging ring is a lock-free single producer queue. An ISR stages requests in its
+ * ring without entering a critical section. The kernels merge the staged requests into
+ * their message queues. The head and the tail run from 0 to 2 * OE_STAGING_RING_LENGTH - 1,
+ * so a full ring can be told apart from an empty one and all slots can be used.
+ */
+typedef struct OE_StagingRing_s
+{
+    /* An array is used to store the staged messages. */
+    OE_Message_t Messages[OE_STAGING_RING_LENGTH];
+    /* The head counts the staged messages. Only the ISR writes the head. */
+    volatile size_t Head;
+    /* The tail counts the merged messages. Only the merging kernel writes the tail. */
+    volatile size_t Tail;
+    /* This is set while a kernel merges the ring. */
+    bool Merging;
+} OE_StagingRing_t;
+
+/**
+ * @brief Initialize the staging ring statically.
+ *
+ * @param StagingRing The pointer to the staging ring to be initialized.
+ */
+void OE_StagingRing_staticInit(
+    OE_StagingRing_t *StagingRing);
+
+/**
+ * @brief Get the next free message of the staging ring.
+ *
+ * This function is called by the ISR that owns the ring. The message is only
+ * visible to the kernels after OE_StagingRing_publish() has been called.
+ *
+ * @param StagingRing The pointer to the staging ring.
+ * @return OE_Message_t* The pointer to the next free message is returned.
+ * Returns NULL if the ring is full.
+ */
+OE_Message_t* OE_StagingRing_allocateMessage(
+    OE_StagingRing_t *StagingRing);
+
+/**
+ * @brief Publish the message allocated last.
+ *
+ * @param StagingRing The pointer to the staging ring.
+ */
+void OE_StagingRing_publish(
+    OE_StagingRing_t *StagingRing);
+
+/**
+ * @brief Get the oldest staged message without removing it.
+ *
+ * This function is called by the merging kernel.
+ *
+ * @param StagingRing The pointer to the staging ring.
+ * @return OE_Message_t* The pointer to the oldest staged message is returned.
+ * Returns NULL if the ring is empty.
+ */
+OE_Message_t* OE_StagingRing_peekMessage(
+    OE_StagingRing_t *StagingRing);
+
+/**
+ * @brief Remove the oldest staged message and give its slot back to the ISR.
+ *
+ * @param StagingRing The pointer to the staging ring.
+ */
+void OE_StagingRing_removeMessage(
+    OE_StagingRing_t *StagingRing);
+#endif // OE_USE_ISR_SEND
+
 #endif // OE_MESSAGE_QUEUE_H
\ No newline at end of file
@@ -33,6 +33,46 @@ static inline bool OE_RequestMap_handlerRegistered(
     OE_RequestMapNode_t *Node,
     OE_MessageHandler_t RequestHandler);
 
+/**
+ * @brief Mark a map node as being changed.
+ *
+ * A kernel that copies the handlers of the node meanwhile repeats the copy.
+ *
+ * @param Node The node that will be changed.
+ */
+static inline void OE_RequestMap_beginUpdate(
+    OE_RequestMapNode_t *Node);
+
+/**
+ * @brief Mark the change of a map node as finished.
+ *
+ * @param Node The node that was changed.
+ */
+static inline void OE_RequestMap_endUpdate(
+    OE_RequestMapNode_t *Node);
+
+#if OE_USE_REQUEST_FILTERS
+/**
+ * @brief Check if a request filter can be applied to the message data.
+ *
+ * @param Filter The filter to be checked.
+ * @return true If the filter is valid.
+ * @return false If the size is not supported or the field exceeds the message data.
+ */
+static inline bool OE_RequestMap_filterValid(
+    const OE_RequestFilter_t *Filter);
+
+/**
+ * @brief Tell the core which filters the handlers of a request use.
+ *
+ * @param Kernel Pointer to the kernel that owns the request map.
+ * @param RequestID The request ID whose handlers changed.
+ */
+static inline void OE_RequestMap_updateFilters(
+    OE_Kernel_t *Kernel,
+    OE_RequestID_t RequestID);
+#endif // OE_USE_REQUEST_FILTERS
+
 void OE_RequestMap_staticInit(
     OE_RequestMap_t *RequestMap)
 {
@@ -41,9 +81,13 @@ void OE_RequestMap_staticInit(
         for (size_t Handler = 0; Handler < OE_REQUEST_HANDLER_LIMIT; Handler++)
         {
             RequestMap->MapNodes[Node].RequestHandlers[Handler] = OE_NO_HANDLER;
+#if OE_USE_REQUEST_FILTERS
+            RequestMap->MapNodes[Node].Filters[Handler] = OE_NO_FILTER;
+#endif // OE_USE_REQUEST_FILTERS
         }
 
         RequestMap->MapNodes[Node].NumberOfHandlers = 0;
+        RequestMap->MapNodes[Node].Sequence = 0;
     }
 }
 
@@ -51,25 +95,46 @@ OE_Error_t OE_RequestMap_registerHandlers(
     OE_Kernel_t *Kernel,
     OE_RequestID_t *RequestIDs,
     OE_MessageHandler_t *RequestHandlers,
+    const OE_RequestFilter_t *Filters,
     size_t NumberOfRequests)
 {
     size_t Count;
     OE_RequestMapNode_t *Node;
     OE_RequestMap_t *RequestMap = &(Kernel->RequestMap);
 
+#if !OE_USE_REQUEST_FILTERS
+    (void)Filters;
+#endif // OE_USE_REQUEST_FILTERS
+
+    /**
+     * Other threads may register handlers at the same time. The kernel itself
+     * reads the map without locking it.
+     */
+    OE_ENTER_CRITICAL();
+
     /* Control loop */
     for (Count = 0; Count < NumberOfRequests; Count++)
     {
         if (RequestIDs[Count] >= OE_NUMBER_OF_REQUESTS)
         {
+            OE_EXIT_CRITICAL();
             return OE_ERROR_REQUEST_ID_INVALID;
         }
 
         if (RequestHandlers[Count] == NULL)
         {
+            OE_EXIT_CRITICAL();
             return OE_ERROR_PARAMETER_INVALID;
         }
 
+#if OE_USE_REQUEST_FILTERS
+        if (Filters != NULL && !OE_RequestMap_filterValid(&Filters[Count]))
+        {
+            OE_EXIT_CRITICAL();
+            return OE_ERROR_PARAMETER_INVALID;
+        }
+#endif // OE_USE_REQUEST_FILTERS
+
         Node = &(RequestMap->MapNodes[RequestIDs[Count]]);
 
         /* Can the map store another handler? */
@@ -77,6 +142,7 @@ OE_Error_t OE_RequestMap_registerHandlers(
         && (!OE_RequestMap_handlerRegistered(Node, RequestHandlers[Count])))
         {            
             /* There's no more space in the map */
+            OE_EXIT_CRITICAL();
             return OE_ERROR_HANDLER_LIMIT_REACHED;
         }
     }
@@ -85,22 +151,37 @@ OE_Error_t OE_RequestMap_registerHandlers(
     {
         Node = &(RequestMap->MapNodes[RequestIDs[Count]]);
 
-        if (Node->NumberOfHandlers == 0)
+        if (OE_RequestMap_handlerRegistered(Node, RequestHandlers[Count]))
         {
-            /* We now register the first handler. */
-            Node->RequestHandlers[0] = RequestHandlers[Count];
-            Node->NumberOfHandlers = 1;
+            continue;
+        }
+
+        OE_RequestMap_beginUpdate(Node);
+#if OE_USE_REQUEST_FILTERS
+        Node->Filters[Node->NumberOfHandlers] = (Filters != NULL) ? Filters[Count] : OE_NO_FILTER;
+#endif // OE_USE_REQUEST_FILTERS
+        Node->RequestHandlers[Node->NumberOfHandlers] = RequestHandlers[Count];
+        Node->NumberOfHandlers++;
+        OE_RequestMap_endUpdate(Node);
 
+#if OE_USE_REQUEST_FILTERS
+        /* The filters are set before the first subscription. */
+        OE_RequestMap_updateFilters(
+            Kernel,
+            RequestIDs[Count]);
+#endif // OE_USE_REQUEST_FILTERS
+
+        if (Node->NumberOfHandlers == 1)
+        {
+            /* We just registered the first handler. */
             OE_Core_subscribeRequest(
                 Kernel->KernelID, 
                 RequestIDs[Count]);
         }
-        else if (!OE_RequestMap_handlerRegistered(Node, RequestHandlers[Count]))
-        {
-            Node->RequestHandlers[Node->NumberOfHandlers++] = RequestHandlers[Count];  
-        }
     }
 
+    OE_EXIT_CRITICAL();
+
     return OE_ERROR_NONE;
 }
 
@@ -114,6 +195,8 @@ void OE_RequestMap_unregisterHandlers(
     OE_RequestMapNode_t *Node;
     OE_RequestMap_t *RequestMap = &(Kernel->RequestMap);
 
+    OE_ENTER_CRITICAL();
+
     /* Remove the handlers from the request map. */
     for (Count = 0; Count < NumberOfRequests; Count++)
     {
@@ -125,15 +208,33 @@ void OE_RequestMap_unregisterHandlers(
         
         Node = &(RequestMap->MapNodes[RequestIDs[Count]]);
 
-        if (OE_RequestMap_removeHandler(Node, RequestHandlers[Count])
-        && (Node->NumberOfHandlers == 0))
+        if (!OE_RequestMap_handlerRegistered(Node, RequestHandlers[Count]))
+        {
+            continue;
+        }
+
+        OE_RequestMap_beginUpdate(Node);
+        OE_RequestMap_removeHandler(Node, RequestHandlers[Count]);
+        OE_RequestMap_endUpdate(Node);
+
+        if (Node->NumberOfHandlers == 0)
         {
             /* We just removed the last handler. */
             OE_Core_unsubscribeRequest(
                 Kernel->KernelID, 
                 RequestIDs[Count]);
         }
+#if OE_USE_REQUEST_FILTERS
+        else
+        {
+            OE_RequestMap_updateFilters(
+                Kernel,
+                RequestIDs[Count]);
+        }
+#endif // OE_USE_REQUEST_FILTERS
     }
+
+    OE_EXIT_CRITICAL();
 }
 
 OE_RequestMapNode_t* OE_RequestMap_getHandlers(
@@ -144,6 +245,47 @@ OE_RequestMapNode_t* OE_RequestMap_getHandlers(
     return &(RequestMap->MapNodes[RequestID]);
 }
 
+void OE_RequestMap_copyHandlers(
+    OE_RequestMap_t *RequestMap,
+    OE_RequestID_t RequestID,
+    OE_RequestMapNode_t *Copy)
+{
+    OE_RequestMapNode_t *Node = &(RequestMap->MapNodes[RequestID]);
+    uint32_t Sequence;
+    size_t NumberOfHandlers;
+
+    do
+    {
+        /* Wait until the writer is done. */
+        while ((Sequence = Node->Sequence) & 1)
+        {
+            OE_YIELD();
+        }
+        OE_READ_BARRIER();
+
+        /* The count may be torn while the node changes, the copy is repeated then. */
+        NumberOfHandlers = Node->NumberOfHandlers;
+        if (NumberOfHandlers > OE_REQUEST_HANDLER_LIMIT)
+        {
+            NumberOfHandlers = OE_REQUEST_HANDLER_LIMIT;
+        }
+
+        /* There are only a few handlers, a loop is faster than memcpy() here. */
+        for (size_t Count = 0; Count < NumberOfHandlers; Count++)
+        {
+            Copy->RequestHandlers[Count] = Node->RequestHandlers[Count];
+#if OE_USE_REQUEST_FILTERS
+            Copy->Filters[Count] = Node->Filters[Count];
+#endif // OE_USE_REQUEST_FILTERS
+        }
+        Copy->NumberOfHandlers = NumberOfHandlers;
+
+        OE_READ_BARRIER();
+    } while (Node->Sequence != Sequence);
+
+    Copy->Sequence = Sequence;
+}
+
 bool OE_RequestMap_removeHandler(
     OE_RequestMapNode_t *Node,
     OE_MessageHandler_t EventHandler)
@@ -183,11 +325,21 @@ bool OE_RequestMap_removeHandler(
                 &(Node->RequestHandlers[Count]),
                 &(Node->RequestHandlers[Count + 1]),
                 sizeof(OE_MessageHandler_t) * (Node->NumberOfHandlers - Count - 1));
+#if OE_USE_REQUEST_FILTERS
+            /* The filters are moved the same way. */
+            memmove(
+                &(Node->Filters[Count]),
+                &(Node->Filters[Count + 1]),
+                sizeof(OE_RequestFilter_t) * (Node->NumberOfHandlers - Count - 1));
+#endif // OE_USE_REQUEST_FILTERS
 
             /* Decrease the handler count. */
             Node->NumberOfHandlers--;
             /* The last handler in the array is reset. */
             Node->RequestHandlers[Node->NumberOfHandlers] = OE_NO_HANDLER;
+#if OE_USE_REQUEST_FILTERS
+            Node->Filters[Node->NumberOfHandlers] = OE_NO_FILTER;
+#endif // OE_USE_REQUEST_FILTERS
             /* That's it. Easy, right? */
             return true;
         }
@@ -196,6 +348,20 @@ bool OE_RequestMap_removeHandler(
     return false;
 }
 
+void OE_RequestMap_beginUpdate(
+    OE_RequestMapNode_t *Node)
+{
+    Node->Sequence++;
+    OE_MEMORY_BARRIER();
+}
+
+void OE_RequestMap_endUpdate(
+    OE_RequestMapNode_t *Node)
+{
+    OE_MEMORY_BARRIER();
+    Node->Sequence++;
+}
+
 bool OE_RequestMap_handlerRegistered(
     OE_RequestMapNode_t *Node,
     OE_MessageHandler_t RequestHandler)
@@ -213,4 +379,90 @@ bool OE_RequestMap_handlerRegistered(
     }
 
     return false;
-}
\ No newline at end of file
+}
+
+#if OE_USE_REQUEST_FILTERS
+bool OE_RequestFilter_matches(
+    const OE_RequestFilter_t *Filter,
+    const void *Parameters)
+{
+    const uint8_t *Field;
+    uint32_t Value;
+
+    if (Filter->Size == 0)
+    {
+        return true;
+    }
+
+    /* A request without parameters has no field to compare. */
+    if (Parameters == NULL)
+    {
+        return false;
+    }
+
+    Field = (const uint8_t *)Parameters + Filter->Offset;
+
+    /* The field may be unaligned. */
+    switch (Filter->Size)
+    {
+    case sizeof(uint8_t):
+        Value = *Field;
+        break;
+
+    case sizeof(uint16_t):
+    {
+        uint16_t Value16;
+        memcpy(&Value16, Field, sizeof(Value16));
+        Value = Value16;
+        break;
+    }
+
+    default:
+        memcpy(&Value, Field, sizeof(Value));
+        break;
+    }
+
+    return (Value & Filter->Mask) == Filter->Value;
+}
+
+bool OE_RequestMap_filterValid(
+    const OE_RequestFilter_t *Filter)
+{
+    if (Filter->Size != 0 &&
+        Filter->Size != sizeof(uint8_t) &&
+        Filter->Size != sizeof(uint16_t) &&
+        Filter->Size != sizeof(uint32_t))
+    {
+        return false;
+    }
+
+    return (size_t)Filter->Offset + Filter->Size <= OE_MESSAGE_DATA_SIZE;
+}
+
+void OE_RequestMap_updateFilters(
+    OE_Kernel_t *Kernel,
+    OE_RequestID_t RequestID)
+{
+    OE_RequestMapNode_t *Node = &(Kernel->RequestMap.MapNodes[RequestID]);
+
+    for (size_t Count = 0; Count < Node->NumberOfHandlers; Count++)
+    {
+        if (Node->Filters[Count].Size == 0)
+        {
+            /* This handler takes every request, so the core does not need to filter. */
+            OE_Core_filterRequest(
+                Kernel->KernelID,
+                RequestID,
+                NULL,
+                0);
+            return;
+        }
+    }
+
+    OE_Core_filterRequest(
+        Kernel->KernelID,
+        RequestID,
+        Node->Filters,
+        Node->NumberOfHandlers);
+}
+#endif // OE_USE_REQUEST_FILTERS
\ No newline at end of file
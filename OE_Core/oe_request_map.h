@@ -38,6 +38,15 @@
  *
  *      N =
  *  OE_NUMBER_OF_REQUESTS - 1
+ *
+ * Handlers may be registered and unregistered at any time, also by other threads
+ * while the kernel dispatches a request. The kernel never locks the map. Each map
+ * node carries a sequence number that is odd while the node is being changed. The
+ * kernel copies the handlers of a request and retries if the sequence number
+ * changed in the meantime (see OE_RequestMap_copyHandlers()). It then calls the
+ * handlers from its copy, so a change of the node during the dispatch does not
+ * affect the running dispatch. Changes of the map are serialized by the critical
+ * section.
  */
 
 #include "oe_defines.h"
@@ -48,6 +57,12 @@ typedef struct OE_RequestMapNode_s
     OE_MessageHandler_t RequestHandlers[OE_REQUEST_HANDLER_LIMIT];
     /* This holds the number of currently registered handlers. */
     size_t NumberOfHandlers;
+    /* This is odd while the node is being changed. */
+    volatile uint32_t Sequence;
+#if OE_USE_REQUEST_FILTERS
+    /* Each handler has a filter. OE_NO_FILTER lets every request pass. */
+    OE_RequestFilter_t Filters[OE_REQUEST_HANDLER_LIMIT];
+#endif // OE_USE_REQUEST_FILTERS
 } OE_RequestMapNode_t;
 
 typedef struct OE_RequestMap_s
@@ -73,13 +88,19 @@ void OE_RequestMap_staticInit(
  * request ID, the second handler for the second ID and so on. Trying to register
  * a handler that is already registered does not have any effect.
  *
+ * If OE_USE_REQUEST_FILTERS is set, each handler is registered with the filter at
+ * the same index. The core is told about the filters of the kernel.
+ *
  * @param Kernel Pointer to the kernel whose request map will store the handlers.
  * @param RequestIDs Pointer to the array of request IDs.
  * @param RequestHandlers Pointer to the array of message handlers to be registered.
+ * @param Filters Pointer to the array of request filters. If it is NULL, the handlers
+ * take every request.
  * @param NumberOfHandlers The number of request IDs and handlers.
  * @return OE_Error_t An error is returned if
  * - one of the request IDs is invalid.
  * - one of the message handlers is invalid.
+ * - one of the filters is invalid.
  * - there is no space left in the request map for one of the request IDs.
  * Otherwise OE_ERROR_NONE is returned.
  */
@@ -87,6 +108,7 @@ OE_Error_t OE_RequestMap_registerHandlers(
     OE_Kernel_t *Kernel,
     OE_RequestID_t *RequestIDs,
     OE_MessageHandler_t *RequestHandlers,
+    const OE_RequestFilter_t *Filters,
     size_t NumberOfHandlers);
 
 /**
@@ -112,6 +134,9 @@ void OE_RequestMap_unregisterHandlers(
 /**
  * @brief Get the map node associated to a given request ID.
  *
+ * The node may change while it is read. Use OE_RequestMap_copyHandlers() to get a
+ * consistent list of handlers.
+ *
  * @param RequestMap Pointer to the request map.
  * @param RequestID The request ID of the handlers to be read from the map.
  * @return OE_RequestMapNode_t* A pointer to the map node is returned.
@@ -121,4 +146,33 @@ OE_RequestMapNode_t* OE_RequestMap_getHandlers(
     OE_RequestMap_t *RequestMap,
     OE_RequestID_t RequestID);
 
+/**
+ * @brief Copy the handlers of a request without locking the map.
+ *
+ * If the map node is changed while it is copied, the copy is repeated. Only the
+ * registered handlers (and filters) are copied, the rest of the copy is left as it is.
+ *
+ * @param RequestMap Pointer to the request map.
+ * @param RequestID The request ID of the handlers to be copied. It has to be valid.
+ * @param Copy Pointer to the map node that receives the copy.
+ */
+void OE_RequestMap_copyHandlers(
+    OE_RequestMap_t *RequestMap,
+    OE_RequestID_t RequestID,
+    OE_RequestMapNode_t *Copy);
+
+#if OE_USE_REQUEST_FILTERS
+/**
+ * @brief Check if request parameters match a request filter.
+ *
+ * @param Filter Pointer to the filter.
+ * @param Parameters Pointer to the request parameters. NULL if the request has none.
+ * @return true If the filter lets the request pass.
+ * @return false If the request is filtered out.
+ */
+bool OE_RequestFilter_matches(
+    const OE_RequestFilter_t *Filter,
+    const void *Parameters);
+#endif // OE_USE_REQUEST_FILTERS
+
 #endif // OE_REQUEST_MAP_H
\ No newline at end of file
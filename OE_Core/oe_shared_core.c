@@ -0,0 +1,191 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#include "oe_shared_core.h"
+
+#if OE_USE_SHARED_CORE
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Get the segment that holds a core.
+ *
+ * @param Core Pointer to the core in the segment.
+ * @return OE_SharedCore_t* The pointer to the segment is returned.
+ */
+static inline OE_SharedCore_t* OE_SharedCore_of(
+    module_OE_Core_t *Core);
+
+OE_Error_t OE_SharedCore_create(
+    const char *Name,
+    OE_Kernel_t *Kernel,
+    module_OE_Core_t **Core)
+{
+    OE_SharedCore_t *SharedCore;
+    OE_Error_t Error;
+    int File;
+
+    if (Name == NULL || Core == NULL)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    File = shm_open(Name, O_RDWR | O_CREAT | O_EXCL, 0600);
+
+    if (File < 0)
+    {
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    if (ftruncate(File, sizeof(OE_SharedCore_t)) != 0)
+    {
+        close(File);
+        shm_unlink(Name);
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    SharedCore = mmap(
+        NULL,
+        sizeof(OE_SharedCore_t),
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED,
+        File,
+        0);
+
+    /* The mapping stays valid without the file descriptor. */
+    close(File);
+
+    if (SharedCore == MAP_FAILED)
+    {
+        shm_unlink(Name);
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    OE_PORT_SHARED_INIT(&SharedCore->PortData);
+    OE_PORT_SHARED_ATTACH(&SharedCore->PortData);
+
+    Error = initModule_OE_Core(
+        &SharedCore->Core,
+        NULL,
+        Kernel);
+
+    if (Error != OE_ERROR_NONE)
+    {
+        OE_SharedCore_detach(&SharedCore->Core);
+        shm_unlink(Name);
+        return Error;
+    }
+
+    SharedCore->NumberOfKernels = OE_NUMBER_OF_KERNELS;
+    SharedCore->NumberOfRequests = OE_NUMBER_OF_REQUESTS;
+    SharedCore->Size = sizeof(OE_SharedCore_t);
+
+    /* Other processes may attach as soon as the magic is set. */
+    OE_MEMORY_BARRIER();
+    SharedCore->Magic = OE_SHARED_CORE_MAGIC;
+
+    *Core = &SharedCore->Core;
+
+    return OE_ERROR_NONE;
+}
+
+OE_Error_t OE_SharedCore_attach(
+    const char *Name,
+    module_OE_Core_t **Core)
+{
+    OE_SharedCore_t *SharedCore;
+    struct stat Status;
+    int File;
+
+    if (Name == NULL || Core == NULL)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    File = shm_open(Name, O_RDWR, 0);
+
+    if (File < 0)
+    {
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    /* A segment of another size was created with another configuration. */
+    if (fstat(File, &Status) != 0 || (size_t)Status.st_size != sizeof(OE_SharedCore_t))
+    {
+        close(File);
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    SharedCore = mmap(
+        NULL,
+        sizeof(OE_SharedCore_t),
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED,
+        File,
+        0);
+
+    close(File);
+
+    if (SharedCore == MAP_FAILED)
+    {
+        return OE_ERROR_UNSPECIFIED;
+    }
+
+    if (SharedCore->Magic != OE_SHARED_CORE_MAGIC)
+    {
+        /* The core is not initialized yet. */
+        munmap(SharedCore, sizeof(OE_SharedCore_t));
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    OE_MEMORY_BARRIER();
+
+    if (SharedCore->NumberOfKernels != OE_NUMBER_OF_KERNELS ||
+        SharedCore->NumberOfRequests != OE_NUMBER_OF_REQUESTS ||
+        SharedCore->Size != sizeof(OE_SharedCore_t))
+    {
+        munmap(SharedCore, sizeof(OE_SharedCore_t));
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    OE_PORT_SHARED_ATTACH(&SharedCore->PortData);
+
+    OE_Core_attach(&SharedCore->Core);
+
+    *Core = &SharedCore->Core;
+
+    return OE_ERROR_NONE;
+}
+
+void OE_SharedCore_detach(
+    module_OE_Core_t *Core)
+{
+    OE_SharedCore_t *SharedCore = OE_SharedCore_of(Core);
+
+    OE_PORT_SHARED_DETACH(&SharedCore->PortData);
+
+    munmap(SharedCore, sizeof(OE_SharedCore_t));
+}
+
+OE_Error_t OE_SharedCore_unlink(
+    const char *Name)
+{
+    if (Name == NULL || shm_unlink(Name) != 0)
+    {
+        return OE_ERROR_PARAMETER_INVALID;
+    }
+
+    return OE_ERROR_NONE;
+}
+
+OE_SharedCore_t* OE_SharedCore_of(
+    module_OE_Core_t *Core)
+{
+    return (OE_SharedCore_t *)((uint8_t *)Core - offsetof(OE_SharedCore_t, Core));
+}
+#endif // OE_USE_SHARED_CORE
@@ -0,0 +1,146 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_SHARED_CORE_H
+#define OE_SHARED_CORE_H
+
+/**
+ * @brief This is the header file of the shared core. Usually, all kernels run as threads
+ * of one process and the core is plain static memory. If OE_USE_SHARED_CORE is set, the
+ * core can be placed in a POSIX shared memory segment instead. The kernels may then run
+ * in separate processes, e.g. to isolate faults. The message queues, subscriptions and
+ * request registers are shared, so requests are still written once into the queue of
+ * the receiving kernel and handled in place.
+ *
+ * Only data without pointers is shared. The kernels and their request maps stay in
+ * the process that connected them. A queued request refers to its response handler by
+ * an index into a table of the sending process (see OE_Core_getResponseHandler()).
+ * All processes have to be built with the same oe_config.h and oe_requests.h.
+ *
+ * One process creates the segment, which also initializes the core. The other
+ * processes attach to it and then connect their kernels as usual:
+ *
+ *     Process A                                   Process B
+ *     OE_SharedCore_create("/app", &Kernel_0,     OE_SharedCore_attach("/app", &Core);
+ *                          &Core);                OE_Kernel_staticInit(&Kernel_1);
+ *     OE_Kernel_staticInit(&Kernel_0);            ...
+ *
+ * The port has to make OE_ENTER_CRITICAL(), OE_IDLE() and OE_RESUME() work across
+ * processes. For this purpose the segment holds data of the port, e.g. process-shared
+ * mutexes. The port may provide the following in oe_port.h:
+ * - OE_PORT_SHARED_DATA_T: The type of the port data in the segment.
+ * - OE_PORT_SHARED_INIT(PortData): Initialize the port data once in the creating process.
+ * - OE_PORT_SHARED_ATTACH(PortData): Use the port data in this process.
+ * - OE_PORT_SHARED_DETACH(PortData): Stop using the port data in this process.
+ *
+ * A process that dies while it holds the critical section blocks the others, unless
+ * the port uses robust mutexes. The kernels of a process that exits stay connected.
+ */
+
+#include "oe_defines.h"
+
+#if OE_USE_SHARED_CORE
+#include "oe_core_mod.h"
+
+#ifndef OE_PORT_SHARED_DATA_T
+#define OE_PORT_SHARED_DATA_T uint8_t
+#endif
+
+#ifndef OE_PORT_SHARED_INIT
+#define OE_PORT_SHARED_INIT(PortData) ((void)(PortData))
+#endif
+
+#ifndef OE_PORT_SHARED_ATTACH
+#define OE_PORT_SHARED_ATTACH(PortData) ((void)(PortData))
+#endif
+
+#ifndef OE_PORT_SHARED_DETACH
+#define OE_PORT_SHARED_DETACH(PortData) ((void)(PortData))
+#endif
+
+/* The segment is only valid if it starts with this value. */
+#define OE_SHARED_CORE_MAGIC 0x4F45534Du
+
+typedef struct OE_SharedCore_s
+{
+    /* This is set after the core was initialized. */
+    volatile uint32_t Magic;
+    /* A process with another configuration must not attach. */
+    uint32_t NumberOfKernels;
+    uint32_t NumberOfRequests;
+    size_t Size;
+
+    /* The core itself. */
+    module_OE_Core_t Core;
+
+    /* The data of the port, e.g. process-shared mutexes. */
+    OE_PORT_SHARED_DATA_T PortData;
+} OE_SharedCore_t;
+
+/**
+ * @brief Create a shared memory segment and initialize the core in it.
+ *
+ * The segment must not exist yet. Other processes can attach to the segment
+ * once this function returns.
+ *
+ * @param Name The name of the segment, e.g. "/my_app". See shm_open().
+ * @param Kernel Pointer to the kernel the core module is connected to.
+ * @param Core Returns the pointer to the core in the segment.
+ * @return OE_Error_t An error is returned if
+ * - a parameter is invalid.
+ * - the segment cannot be created or mapped.
+ * - initializing the core results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_SharedCore_create(
+    const char *Name,
+    OE_Kernel_t *Kernel,
+    module_OE_Core_t **Core);
+
+/**
+ * @brief Attach to the core in an existing shared memory segment.
+ *
+ * The kernels of this process can be connected after this function returned.
+ *
+ * @param Name The name of the segment.
+ * @param Core Returns the pointer to the core in the segment.
+ * @return OE_Error_t An error is returned if
+ * - the segment cannot be opened or mapped.
+ * - the core in the segment is not initialized yet.
+ * - the segment was created with another configuration.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_SharedCore_attach(
+    const char *Name,
+    module_OE_Core_t **Core);
+
+/**
+ * @brief Unmap the segment from this process.
+ *
+ * The core and the kernels of this process must not be used afterwards.
+ *
+ * @param Core Pointer to the core returned by OE_SharedCore_create()
+ * or OE_SharedCore_attach().
+ */
+void OE_SharedCore_detach(
+    module_OE_Core_t *Core);
+
+/**
+ * @brief Remove the name of a segment.
+ *
+ * Processes that mapped the segment can still use it. The memory is released
+ * once all of them have detached.
+ *
+ * @param Name The name of the segment.
+ * @return OE_Error_t An error is returned if
+ * - the segment does not exist.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t OE_SharedCore_unlink(
+    const char *Name);
+#endif // OE_USE_SHARED_CORE
+
+#endif // OE_SHARED_CORE_H
@@ -0,0 +1,432 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_TYPED_HPP
+#define OE_TYPED_HPP
+
+/**
+ * @brief This is the header file of the typed C++ interface (C++17). It lets modules
+ * that are written in C++ send requests, respond to them and register their handlers
+ * with types that the compiler checks. The C core stays the runtime, this header only
+ * adds inline functions and templates on top of it.
+ *
+ * A request is described by its ID and the types of its parameters, e.g. with the
+ * structs of a generated interface header:
+ *
+ *     using Measure = OE::Request<
+ *         RID_Measure,
+ *         requestArgs_Measure_s,
+ *         responseArgs_Measure_s>;
+ *
+ * OE::NoArgs stands for a request or response without parameters. A request without
+ * response leaves out the third type. The sizes of the parameters are checked against
+ * OE_MESSAGE_DATA_SIZE at compile time.
+ *
+ *     OE::send<Measure>({Channel}, handleResponse, Module->Kernel->KernelID);
+ *     OE::respond<Measure>(Header, {Value});
+ *
+ * The handlers of a module are listed in a handler table. Each entry generates the
+ * function that the kernel calls, which calls the typed handler directly, so the
+ * compiler can inline it:
+ *
+ *     using Handlers = OE::HandlerTable<
+ *         OE::On<Measure, handleMeasure>,
+ *         OE::On<Reset, handleReset>>;
+ *
+ *     Handlers::registerAt(Kernel);
+ *
+ * Handlers take a pointer to the message header and, if the request has parameters,
+ * a pointer to them. The parameter types have to be trivially copyable, since the core
+ * copies them bytewise.
+ */
+
+#if !defined(__cplusplus) || __cplusplus < 201703L
+#error oe_typed.hpp needs C++17.
+#endif
+
+extern "C" {
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+}
+
+#include <cstring>
+#include <type_traits>
+
+namespace OE
+{
+    /* The parameters of a request or response without parameters. */
+    struct NoArgs
+    {
+    };
+
+    /* The response type of a request that is not responded to. */
+    struct NoResponse
+    {
+    };
+
+    namespace Detail
+    {
+        /* The typed signature of a handler for messages with the given parameters. */
+        template <typename Args>
+        struct Handler
+        {
+            using Type = void (*)(OE_MessageHeader_t *Header, Args *Args_);
+        };
+
+        template <>
+        struct Handler<NoArgs>
+        {
+            using Type = void (*)(OE_MessageHeader_t *Header);
+        };
+
+        template <>
+        struct Handler<NoResponse>
+        {
+            using Type = void (*)(OE_MessageHeader_t *Header);
+        };
+
+        /**
+         * The core always copies OE_MESSAGE_DATA_SIZE bytes of parameters. They are
+         * padded here, so that smaller parameters are not read beyond their end.
+         */
+        struct MessageData
+        {
+            template <typename Args>
+            explicit MessageData(const Args &Args_)
+            {
+                std::memcpy(Data, &Args_, sizeof(Args));
+            }
+
+            uint8_t Data[OE_MESSAGE_DATA_SIZE] = {};
+        };
+
+        template <typename Args>
+        constexpr bool isEmpty = std::is_same_v<Args, NoArgs> || std::is_same_v<Args, NoResponse>;
+
+        template <typename Args>
+        constexpr bool isValid = isEmpty<Args> ||
+            (std::is_trivially_copyable_v<Args> && sizeof(Args) <= OE_MESSAGE_DATA_SIZE);
+    } // namespace Detail
+
+    /**
+     * @brief The descriptor of a request.
+     *
+     * @tparam ID The ID of the request.
+     * @tparam RequestArgsType The type of the request parameters, or OE::NoArgs.
+     * @tparam ResponseArgsType The type of the response parameters, OE::NoArgs for a
+     * response without parameters, or OE::NoResponse.
+     */
+    template <
+        OE_RequestID_t ID,
+        typename RequestArgsType = NoArgs,
+        typename ResponseArgsType = NoResponse>
+    struct Request
+    {
+        static_assert(ID < OE_NUMBER_OF_REQUESTS, "The request ID is invalid.");
+        static_assert(Detail::isValid<RequestArgsType>,
+            "The request parameters must be trivially copyable and fit into OE_MESSAGE_DATA_SIZE.");
+        static_assert(Detail::isValid<ResponseArgsType>,
+            "The response parameters must be trivially copyable and fit into OE_MESSAGE_DATA_SIZE.");
+        static_assert(!std::is_same_v<RequestArgsType, NoResponse>,
+            "OE::NoResponse only describes responses.");
+
+        using RequestArgs = RequestArgsType;
+        using ResponseArgs = ResponseArgsType;
+
+        using RequestHandler = typename Detail::Handler<RequestArgs>::Type;
+        using ResponseHandler = typename Detail::Handler<ResponseArgs>::Type;
+
+        static constexpr OE_RequestID_t RequestID = ID;
+
+        static constexpr bool HasRequestArgs = !Detail::isEmpty<RequestArgs>;
+        static constexpr bool HasResponse = !std::is_same_v<ResponseArgs, NoResponse>;
+        static constexpr bool HasResponseArgs = !Detail::isEmpty<ResponseArgs>;
+
+        static constexpr size_t RequestSize = HasRequestArgs ? sizeof(RequestArgs) : 0;
+        static constexpr size_t ResponseSize = HasResponseArgs ? sizeof(ResponseArgs) : 0;
+    };
+
+    namespace Detail
+    {
+        inline OE_Error_t send(
+            OE_KernelID_t ReceiverID,
+            OE_MessageHeader_t *Header,
+            const void *Parameters)
+        {
+            if (ReceiverID == OE_NUMBER_OF_KERNELS)
+            {
+                return OE_Core_sendRequest(Header, Parameters);
+            }
+
+            return OE_Core_sendRequestTo(ReceiverID, Header, Parameters);
+        }
+
+        /* OE_NUMBER_OF_KERNELS as receiver sends the request to all subscribers. */
+        template <typename R>
+        inline OE_Error_t send(
+            OE_KernelID_t ReceiverID,
+            const typename R::RequestArgs *Args,
+            OE_MessageHandler_t ResponseHandler,
+            OE_KernelID_t KernelID)
+        {
+            OE_MessageHeader_t MessageHeader = {};
+
+            MessageHeader.RequestID = R::RequestID;
+            MessageHeader.ResponseHandler = ResponseHandler;
+            MessageHeader.KernelID = KernelID;
+
+            if constexpr (R::HasRequestArgs)
+            {
+                MessageData Data(*Args);
+                return send(ReceiverID, &MessageHeader, Data.Data);
+            }
+            else
+            {
+                return send(ReceiverID, &MessageHeader, nullptr);
+            }
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Send a request that is not responded to.
+     *
+     * @param Args The request parameters.
+     * @return OE_Error_t The result of OE_Core_sendRequest() is returned.
+     */
+    template <typename R>
+    inline OE_Error_t send(
+        const typename R::RequestArgs &Args)
+    {
+        static_assert(R::HasRequestArgs && !R::HasResponse, "The request takes other arguments.");
+        return Detail::send<R>(OE_NUMBER_OF_KERNELS, &Args, OE_NO_HANDLER, 0);
+    }
+
+    /**
+     * @brief Send a request without parameters that is not responded to.
+     *
+     * @return OE_Error_t The result of OE_Core_sendRequest() is returned.
+     */
+    template <typename R>
+    inline OE_Error_t send(void)
+    {
+        static_assert(!R::HasRequestArgs && !R::HasResponse, "The request takes other arguments.");
+        return Detail::send<R>(OE_NUMBER_OF_KERNELS, nullptr, OE_NO_HANDLER, 0);
+    }
+
+    /**
+     * @brief Send a request that is responded to.
+     *
+     * @param Args The request parameters.
+     * @param ResponseHandler The response handler, or nullptr to ignore the response.
+     * @param KernelID The ID of the kernel that executes the response handler.
+     * @return OE_Error_t The result of OE_Core_sendRequest() is returned.
+     */
+    template <typename R>
+    inline OE_Error_t send(
+        const typename R::RequestArgs &Args,
+        typename R::ResponseHandler ResponseHandler,
+        OE_KernelID_t KernelID)
+    {
+        static_assert(R::HasRequestArgs && R::HasResponse, "The request takes other arguments.");
+        return Detail::send<R>(
+            OE_NUMBER_OF_KERNELS,
+            &Args,
+            reinterpret_cast<OE_MessageHandler_t>(ResponseHandler),
+            KernelID);
+    }
+
+    /**
+     * @brief Send a request without parameters that is responded to.
+     *
+     * @param ResponseHandler The response handler, or nullptr to ignore the response.
+     * @param KernelID The ID of the kernel that executes the response handler.
+     * @return OE_Error_t The result of OE_Core_sendRequest() is returned.
+     */
+    template <typename R>
+    inline OE_Error_t send(
+        typename R::ResponseHandler ResponseHandler,
+        OE_KernelID_t KernelID)
+    {
+        static_assert(!R::HasRequestArgs && R::HasResponse, "The request takes other arguments.");
+        return Detail::send<R>(
+            OE_NUMBER_OF_KERNELS,
+            nullptr,
+            reinterpret_cast<OE_MessageHandler_t>(ResponseHandler),
+            KernelID);
+    }
+
+    /**
+     * @brief Send a request that is not responded to to one kernel.
+     *
+     * @param ReceiverID The ID of the kernel that receives the request.
+     * @param Args The request parameters.
+     * @return OE_Error_t The result of OE_Core_sendRequestTo() is returned.
+     */
+    template <typename R>
+    inline OE_Error_t sendTo(
+        OE_KernelID_t ReceiverID,
+        const typename R::RequestArgs &Args)
+    {
+        static_assert(R::HasRequestArgs && !R::HasResponse, "The request takes other arguments.");
+
+        if (ReceiverID >= OE_NUMBER_OF_KERNELS)
+        {
+            return OE_ERROR_KERNEL_ID_INVALID;
+        }
+
+        return Detail::send<R>(ReceiverID, &Args, OE_NO_HANDLER, 0);
+    }
+
+    /**
+     * @brief Send a request that is responded to to one kernel.
+     *
+     * @param ReceiverID The ID of the kernel that receives the request.
+     * @param Args The request parameters.
+     * @param ResponseHandler The response handler, or nullptr to ignore the response.
+     * @param KernelID The ID of the kernel that executes the response handler.
+     * @return OE_Error_t The result of OE_Core_sendRequestTo() is returned.
+     */
+    template <typename R>
+    inline OE_Error_t sendTo(
+        OE_KernelID_t ReceiverID,
+        const typename R::RequestArgs &Args,
+        typename R::ResponseHandler ResponseHandler,
+        OE_KernelID_t KernelID)
+    {
+        static_assert(R::HasRequestArgs && R::HasResponse, "The request takes other arguments.");
+
+        if (ReceiverID >= OE_NUMBER_OF_KERNELS)
+        {
+            return OE_ERROR_KERNEL_ID_INVALID;
+        }
+
+        return Detail::send<R>(
+            ReceiverID,
+            &Args,
+            reinterpret_cast<OE_MessageHandler_t>(ResponseHandler),
+            KernelID);
+    }
+
+    /**
+     * @brief Respond to a request.
+     *
+     * @param RequestHeader Pointer to the header of the request message.
+     * @param Args The response parameters.
+     * @return OE_Error_t The result of OE_Core_sendResponse() is returned.
+     */
+    template <typename R>
+    inline OE_Error_t respond(
+        OE_MessageHeader_t *RequestHeader,
+        const typename R::ResponseArgs &Args)
+    {
+        static_assert(R::HasResponseArgs, "The response takes other arguments.");
+
+        Detail::MessageData Data(Args);
+
+        return OE_Core_sendResponse(RequestHeader, Data.Data);
+    }
+
+    /**
+     * @brief Respond to a request without response parameters.
+     *
+     * @param RequestHeader Pointer to the header of the request message.
+     * @return OE_Error_t The result of OE_Core_sendResponse() is returned.
+     */
+    template <typename R>
+    inline OE_Error_t respond(
+        OE_MessageHeader_t *RequestHeader)
+    {
+        static_assert(R::HasResponse && !R::HasResponseArgs, "The response takes other arguments.");
+        return OE_Core_sendResponse(RequestHeader, nullptr);
+    }
+
+    /**
+     * @brief An entry of a handler table.
+     *
+     * @tparam R The descriptor of the request.
+     * @tparam Function The typed request handler.
+     */
+    template <
+        typename R,
+        typename R::RequestHandler Function,
+        bool HasRequestArgs = R::HasRequestArgs>
+    struct On
+    {
+        using Request = R;
+
+        /* The function that the kernel calls. */
+        static void handle(OE_MessageHeader_t *Header, void *Args)
+        {
+            Function(Header, static_cast<typename R::RequestArgs *>(Args));
+        }
+    };
+
+    template <typename R, typename R::RequestHandler Function>
+    struct On<R, Function, false>
+    {
+        using Request = R;
+
+        /* The function that the kernel calls. */
+        static void handle(OE_MessageHeader_t *Header)
+        {
+            Function(Header);
+        }
+    };
+
+    /**
+     * @brief A table of request handlers that is generated at compile time.
+     *
+     * @tparam Entries The handlers, see OE::On.
+     */
+    template <typename... Entries>
+    class HandlerTable
+    {
+    public:
+        static constexpr size_t NumberOfRequests = sizeof...(Entries);
+
+        static_assert(NumberOfRequests > 0, "A handler table needs at least one handler.");
+
+        /**
+         * @brief Register the handlers of the table, see OE_Kernel_registerHandlers().
+         *
+         * @param Kernel Pointer to the kernel that executes the handlers.
+         * @return OE_Error_t The result of OE_Kernel_registerHandlers() is returned.
+         */
+        static OE_Error_t registerAt(
+            OE_Kernel_t *Kernel)
+        {
+            return OE_Kernel_registerHandlers(
+                Kernel,
+                RequestIDs,
+                RequestHandlers,
+                NumberOfRequests);
+        }
+
+        /**
+         * @brief Unregister the handlers of the table, see OE_Kernel_unregisterHandlers().
+         *
+         * @param Kernel Pointer to the kernel that executes the handlers.
+         */
+        static void unregisterAt(
+            OE_Kernel_t *Kernel)
+        {
+            OE_Kernel_unregisterHandlers(
+                Kernel,
+                RequestIDs,
+                RequestHandlers,
+                NumberOfRequests);
+        }
+
+    private:
+        static inline OE_RequestID_t RequestIDs[NumberOfRequests] = {
+            Entries::Request::RequestID...};
+
+        static inline OE_MessageHandler_t RequestHandlers[NumberOfRequests] = {
+            reinterpret_cast<OE_MessageHandler_t>(&Entries::handle)...};
+    };
+} // namespace OE
+
+#endif // OE_TYPED_HPP
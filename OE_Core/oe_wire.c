@@ -0,0 +1,122 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#include "oe_wire.h"
+
+#if OE_USE_WIRE_FORMAT
+void OE_Wire_writeFixed(
+    uint8_t *Buffer,
+    size_t *Offset,
+    uint64_t Value,
+    size_t Width)
+{
+    for (size_t Index = 0; Index < Width; Index++)
+    {
+        Buffer[(*Offset)++] = (uint8_t)(Value >> (8 * Index));
+    }
+}
+
+void OE_Wire_writeVarint(
+    uint8_t *Buffer,
+    size_t *Offset,
+    uint64_t Value)
+{
+    /* Seven bits per byte, the top bit is set if more bytes follow. */
+    while (Value >= 0x80)
+    {
+        Buffer[(*Offset)++] = (uint8_t)(Value | 0x80);
+        Value >>= 7;
+    }
+
+    Buffer[(*Offset)++] = (uint8_t)Value;
+}
+
+void OE_Wire_writeBytes(
+    uint8_t *Buffer,
+    size_t *Offset,
+    const void *Value,
+    size_t Width)
+{
+    memcpy(&(Buffer[*Offset]), Value, Width);
+    *Offset += Width;
+}
+
+bool OE_Wire_readFixed(
+    const uint8_t *Buffer,
+    size_t Size,
+    size_t *Offset,
+    size_t Width,
+    uint64_t *Value)
+{
+    if (*Offset + Width > Size)
+    {
+        return false;
+    }
+
+    *Value = 0;
+
+    for (size_t Index = 0; Index < Width; Index++)
+    {
+        *Value |= (uint64_t)Buffer[(*Offset)++] << (8 * Index);
+    }
+
+    return true;
+}
+
+bool OE_Wire_readVarint(
+    const uint8_t *Buffer,
+    size_t Size,
+    size_t *Offset,
+    size_t Width,
+    uint64_t *Value)
+{
+    size_t Position = *Offset;
+    unsigned int Shift = 0;
+    uint8_t Byte;
+
+    *Value = 0;
+
+    do
+    {
+        /* A 64 bit value takes at most 10 bytes. */
+        if (Position >= Size || Shift > 63)
+        {
+            return false;
+        }
+
+        Byte = Buffer[Position++];
+        *Value |= (uint64_t)(Byte & 0x7F) << Shift;
+        Shift += 7;
+    } while (Byte & 0x80);
+
+    if (Width < sizeof(uint64_t) && (*Value >> (8 * Width)) != 0)
+    {
+        return false;
+    }
+
+    *Offset = Position;
+
+    return true;
+}
+
+bool OE_Wire_readBytes(
+    const uint8_t *Buffer,
+    size_t Size,
+    size_t *Offset,
+    size_t Width,
+    void *Value)
+{
+    if (*Offset + Width > Size)
+    {
+        return false;
+    }
+
+    memcpy(Value, &(Buffer[*Offset]), Width);
+    *Offset += Width;
+
+    return true;
+}
+#endif // OE_USE_WIRE_FORMAT
@@ -0,0 +1,210 @@
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ *
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+
+#ifndef OE_WIRE_H
+#define OE_WIRE_H
+
+/**
+ * @brief This is the header file of the wire format. The wire format is a compact
+ * encoding of request and response parameters that does not depend on the compiler.
+ *
+ * The Systembuilder generates an encode and a decode function for each parameter
+ * struct of an interface, e.g. encodeRequest_<Name>() and decodeResponse_<Name>().
+ * The parameters are written one after another without padding:
+ * - Integers, bool and char are written little endian with their fixed width.
+ * - Integers with the encoding 'varint' in the module config are written as
+ *   LEB128 varints. Signed integers are zigzag encoded first.
+ * - float and double are written little endian as IEEE 754 bit patterns.
+ * - Other types are copied as they are. Both sides must agree on their layout.
+ *
+ * OE_REQUEST_CODECS in oe_requests.h lists the generated functions by request ID.
+ * It can only be used where the headers of all interfaces are included.
+ */
+
+#include "oe_defines.h"
+
+#if OE_USE_WIRE_FORMAT
+#include <string.h>
+
+/**
+ * The maximum size of encoded parameters. A varint takes at most 1.5 times the
+ * width of its integer, and only integers of 16 bit or more can be varints.
+ */
+#define OE_WIRE_DATA_LIMIT (OE_MESSAGE_DATA_SIZE + (OE_MESSAGE_DATA_SIZE + 1) / 2)
+
+/**
+ * @brief Encode a parameter struct.
+ *
+ * @param Parameters Pointer to the parameter struct.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+typedef size_t (*OE_WireEncoder_t)(
+    const void *Parameters,
+    uint8_t *Buffer);
+
+/**
+ * @brief Decode a parameter struct.
+ *
+ * @param Parameters Pointer to the parameter struct.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+typedef size_t (*OE_WireDecoder_t)(
+    void *Parameters,
+    const uint8_t *Buffer,
+    size_t Size);
+
+/* The generated functions of a request. Requests without parameters have none. */
+typedef struct OE_WireCodec_s
+{
+    OE_WireEncoder_t EncodeRequest;
+    OE_WireDecoder_t DecodeRequest;
+    OE_WireEncoder_t EncodeResponse;
+    OE_WireDecoder_t DecodeResponse;
+} OE_WireCodec_t;
+
+/**
+ * @brief Write an integer with a fixed width.
+ *
+ * @param Buffer Pointer to the buffer.
+ * @param Offset Pointer to the write position. It is advanced by Width.
+ * @param Value The value. Only the lower Width bytes are written.
+ * @param Width The number of bytes, at most 8.
+ */
+void OE_Wire_writeFixed(
+    uint8_t *Buffer,
+    size_t *Offset,
+    uint64_t Value,
+    size_t Width);
+
+/**
+ * @brief Write an integer as varint.
+ *
+ * @param Buffer Pointer to the buffer.
+ * @param Offset Pointer to the write position. It is advanced by the varint.
+ * @param Value The value.
+ */
+void OE_Wire_writeVarint(
+    uint8_t *Buffer,
+    size_t *Offset,
+    uint64_t Value);
+
+/**
+ * @brief Copy a value as it is.
+ *
+ * @param Buffer Pointer to the buffer.
+ * @param Offset Pointer to the write position. It is advanced by Width.
+ * @param Value Pointer to the value.
+ * @param Width The size of the value.
+ */
+void OE_Wire_writeBytes(
+    uint8_t *Buffer,
+    size_t *Offset,
+    const void *Value,
+    size_t Width);
+
+/**
+ * @brief Read an integer with a fixed width.
+ *
+ * @param Buffer Pointer to the buffer.
+ * @param Size The number of bytes in the buffer.
+ * @param Offset Pointer to the read position. It is advanced by Width.
+ * @param Width The number of bytes, at most 8.
+ * @param Value Pointer to the value.
+ * @return bool false is returned if the buffer is too short.
+ */
+bool OE_Wire_readFixed(
+    const uint8_t *Buffer,
+    size_t Size,
+    size_t *Offset,
+    size_t Width,
+    uint64_t *Value);
+
+/**
+ * @brief Read a varint.
+ *
+ * @param Buffer Pointer to the buffer.
+ * @param Size The number of bytes in the buffer.
+ * @param Offset Pointer to the read position. It is advanced by the varint.
+ * @param Width The width of the integer the value has to fit into.
+ * @param Value Pointer to the value.
+ * @return bool false is returned if the buffer is too short or the value is too large.
+ */
+bool OE_Wire_readVarint(
+    const uint8_t *Buffer,
+    size_t Size,
+    size_t *Offset,
+    size_t Width,
+    uint64_t *Value);
+
+/**
+ * @brief Copy a value as it is.
+ *
+ * @param Buffer Pointer to the buffer.
+ * @param Size The number of bytes in the buffer.
+ * @param Offset Pointer to the read position. It is advanced by Width.
+ * @param Width The size of the value.
+ * @param Value Pointer to the value.
+ * @return bool false is returned if the buffer is too short.
+ */
+bool OE_Wire_readBytes(
+    const uint8_t *Buffer,
+    size_t Size,
+    size_t *Offset,
+    size_t Width,
+    void *Value);
+
+/* Signed varints are zigzag encoded, so that small negative values stay short. */
+static inline uint64_t OE_Wire_zigzag(
+    int64_t Value)
+{
+    return ((uint64_t)Value << 1) ^ (uint64_t)(Value >> 63);
+}
+
+static inline int64_t OE_Wire_unzigzag(
+    uint64_t Value)
+{
+    return (int64_t)(Value >> 1) ^ -(int64_t)(Value & 1);
+}
+
+static inline uint64_t OE_Wire_fromFloat(
+    float Value)
+{
+    uint32_t Bits;
+    memcpy(&Bits, &Value, sizeof(Bits));
+    return Bits;
+}
+
+static inline float OE_Wire_toFloat(
+    uint64_t Bits)
+{
+    uint32_t Value = (uint32_t)Bits;
+    float Float;
+    memcpy(&Float, &Value, sizeof(Float));
+    return Float;
+}
+
+static inline uint64_t OE_Wire_fromDouble(
+    double Value)
+{
+    uint64_t Bits;
+    memcpy(&Bits, &Value, sizeof(Bits));
+    return Bits;
+}
+
+static inline double OE_Wire_toDouble(
+    uint64_t Bits)
+{
+    double Double;
+    memcpy(&Double, &Bits, sizeof(Double));
+    return Double;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+#endif // OE_WIRE_H
@@ -0,0 +1,81 @@
+"""
+OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT license
+
+https://github.com/SamuelArdayaLieb/OpenEDOS
+"""
+
+import re
+import logging
+from typing import Dict, List
+
+DEFINE_PATTERN = re.compile(r"^\s*#\s*define\s+(\w+)\s+([^\n/]*)")
+MACRO_PATTERN = re.compile(r"^\s*#\s*define\s+(\w+)\([^)]*\)\s*([^\n/]*)")
+IF_PATTERN = re.compile(r"^\s*#\s*if\s+(\w+)")
+ENUM_ENTRY_PATTERN = re.compile(r"^\s*(\w+)\s*(=\s*[^,]+)?,?\s*$")
+
+
+def read_defines(path_to_header: str) -> Dict[str, str]:
+    """
+    Read all simple '#define NAME VALUE' lines of a header like oe_config.h.
+    Function-like macros such as '#define NAME(ARG) VALUE' are read by their name.
+    Continued lines are joined.
+    """
+    defines: Dict[str, str] = {}
+    logging.debug(f"Reading defines from {path_to_header}...")
+    with open(path_to_header, "r") as file:
+        text = file.read().replace("\\\n", " ")
+    for line in text.split("\n"):
+        match = DEFINE_PATTERN.match(line) or MACRO_PATTERN.match(line)
+        if match is not None:
+            defines[match.group(1)] = match.group(2).strip()
+    return defines
+
+
+def define_as_int(defines: Dict[str, str], name: str, default: int = 0) -> int:
+    """
+    Return the value of a define as integer or the default if it is missing
+    or not a plain number.
+    """
+    if name not in defines:
+        return default
+    try:
+        return int(defines[name], 0)
+    except ValueError:
+        return default
+
+
+def read_request_ids(path_to_requests_header: str, defines: Dict[str, str]) -> List[str]:
+    """
+    Read the request IDs of oe_requests.h in the order of the enum.
+    Entries inside '#if MACRO' blocks are only listed if MACRO is set
+    in the given defines. The index of an entry equals its request ID.
+    """
+    request_ids: List[str] = []
+    enabled: List[bool] = []
+    in_enum = False
+
+    logging.debug(f"Reading request IDs from {path_to_requests_header}...")
+    with open(path_to_requests_header, "r") as file:
+        for line in file:
+            line = re.sub(r"/\*.*?\*/|//.*", "", line)
+            if not in_enum:
+                if "OE_RequestID_e" in line or re.search(r"typedef\s+enum", line):
+                    in_enum = True
+                continue
+            match = IF_PATTERN.match(line)
+            if match is not None:
+                enabled.append(define_as_int(defines, match.group(1)) != 0)
+                continue
+            if re.match(r"^\s*#\s*endif", line):
+                if enabled:
+                    enabled.pop()
+                continue
+            if not all(enabled):
+                continue
+            match = ENUM_ENTRY_PATTERN.match(line)
+            if match is None or match.group(1) == "":
+                continue
+            if match.group(1) == "OE_NUMBER_OF_REQUESTS":
+                break
+            request_ids.append(match.group(1))
+    return request_ids
@@ -6,12 +6,19 @@ https://github.com/SamuelArdayaLieb/OpenEDOS
 
 import os
 import logging
-from typing import Dict
+from typing import Dict, Tuple
 
 from .module import Module
 from .interface import Interface
 from .user_code import CodeParser
-from .message_handlers import Request, Parameter, RequestHandler, ResponseHandler
+from .message_handlers import (
+    Request,
+    Parameter,
+    RequestHandler,
+    ResponseHandler,
+    OVERLOAD_POLICIES,
+    WIRE_ENCODINGS,
+)
 from . import utils
 
 
@@ -212,6 +219,9 @@ class ConfigParser:
                             type=request_parameter_type,
                             description=request_parameter_description,
                         )
+                        error_count = self._parameter_encoding(
+                            request_parameter_config, request_parameter, name, error_count
+                        )
                         debug = f"Config '{self.name}': Request '{name}': Adding request parameter with:\n"
                         debug += f"Parameter name: {request_parameter_name}\n"
                         debug += f"Parameter type: {request_parameter_type}\n"
@@ -262,6 +272,9 @@ class ConfigParser:
                                 type=response_parameter_type,
                                 description=response_parameter_description,
                             )
+                            error_count = self._parameter_encoding(
+                                response_parameter_config, response_parameter, name, error_count
+                            )
                             debug = f"Config '{self.name}': Request '{name}': Adding response parameter with:\n"
                             debug += f"Parameter name: {response_parameter_name}\n"
                             debug += f"Parameter type: {response_parameter_type}\n"
@@ -270,6 +283,131 @@ class ConfigParser:
                             response_parameters[response_parameter_name] = (
                                 response_parameter
                             )
+                request_limit, error_count = self._positive_int(
+                    request_config, "request limit", name, error_count
+                )
+                rate_limit, rate_period, rate_burst = 0, 0, 0
+                rate_config = (
+                    request_config["rate limit"]
+                    if "rate limit" in request_config
+                    else None
+                )
+                if rate_config is not None:
+                    if not isinstance(rate_config, dict) or "requests" not in rate_config or "ticks" not in rate_config:
+                        error_count += 1
+                        logging.error(
+                            f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{name}':\n"
+                            "The rate limit needs the keys 'requests' and 'ticks'!"
+                        )
+                    else:
+                        rate_limit, error_count = self._positive_int(
+                            rate_config, "requests", name, error_count
+                        )
+                        rate_period, error_count = self._positive_int(
+                            rate_config, "ticks", name, error_count
+                        )
+                        rate_burst, error_count = self._positive_int(
+                            rate_config, "burst", name, error_count
+                        )
+                overload_policy = (
+                    request_config["overload policy"]
+                    if "overload policy" in request_config
+                    and request_config["overload policy"] is not None
+                    else "reject"
+                )
+                if overload_policy not in OVERLOAD_POLICIES:
+                    error_count += 1
+                    logging.error(
+                        f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{name}':\n"
+                        f"Unknown overload policy '{overload_policy}'! Choose one of: {', '.join(OVERLOAD_POLICIES)}."
+                    )
+                    overload_policy = "reject"
+                block_timeout, error_count = self._positive_int(
+                    request_config, "block timeout", name, error_count
+                )
+                if overload_policy == "block" and block_timeout == 0:
+                    logging.warning(
+                        f"Config '{self.name}': Request '{name}': The overload policy 'block' has no 'block timeout'. The request will not wait."
+                    )
+                coalesce = (
+                    request_config["coalesce"]
+                    if "coalesce" in request_config
+                    and request_config["coalesce"] is not None
+                    else False
+                )
+                coalesce_key = None
+                if isinstance(coalesce, str):
+                    # The key is compared at the start of the message data.
+                    if len(request_parameters) == 0 or coalesce != next(iter(request_parameters)):
+                        error_count += 1
+                        logging.error(
+                            f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{name}':\n"
+                            f"The coalescing key '{coalesce}' has to be the first request parameter!"
+                        )
+                    else:
+                        coalesce_key = request_parameters[coalesce]
+                    coalesce = True
+                elif not isinstance(coalesce, bool):
+                    error_count += 1
+                    logging.error(
+                        f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{name}':\n"
+                        "'coalesce' has to be true, false or the name of the first request parameter!"
+                    )
+                    coalesce = False
+                if coalesce and has_response:
+                    logging.warning(
+                        f"Config '{self.name}': Request '{name}': The request is coalesced. Only the last sender of a coalesced request gets a response."
+                    )
+                shard_key = None
+                shard_key_name = (
+                    request_config["shard key"]
+                    if "shard key" in request_config
+                    else None
+                )
+                if shard_key_name is not None:
+                    # The key is hashed at the start of the message data.
+                    if len(request_parameters) == 0 or shard_key_name != next(iter(request_parameters)):
+                        error_count += 1
+                        logging.error(
+                            f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{name}':\n"
+                            f"The shard key '{shard_key_name}' has to be the first request parameter!"
+                        )
+                    else:
+                        shard_key = request_parameters[shard_key_name]
+                    if has_response:
+                        logging.warning(
+                            f"Config '{self.name}': Request '{name}': The request is sharded. Only one kernel sends a response."
+                        )
+                unicast = (
+                    request_config["unicast"]
+                    if "unicast" in request_config
+                    and request_config["unicast"] is not None
+                    else False
+                )
+                if not isinstance(unicast, bool):
+                    error_count += 1
+                    logging.error(
+                        f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{name}':\n"
+                        "'unicast' has to be true or false!"
+                    )
+                    unicast = False
+                persistent = (
+                    request_config["persistent"]
+                    if "persistent" in request_config
+                    and request_config["persistent"] is not None
+                    else False
+                )
+                if not isinstance(persistent, bool):
+                    error_count += 1
+                    logging.error(
+                        f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{name}':\n"
+                        "'persistent' has to be true or false!"
+                    )
+                    persistent = False
+                if persistent and has_response:
+                    logging.warning(
+                        f"Config '{self.name}': Request '{name}': The request is persistent. Replayed requests do not get a response."
+                    )
                 request = Request(
                     name=name,
                     request_description=request_description,
@@ -277,12 +415,61 @@ class ConfigParser:
                     has_response=has_response,
                     response_description=response_description,
                     response_args=response_parameters,
+                    request_limit=request_limit,
+                    rate_limit=rate_limit,
+                    rate_period=rate_period,
+                    rate_burst=rate_burst,
+                    overload_policy=overload_policy,
+                    block_timeout=block_timeout,
+                    coalesce=coalesce,
+                    coalesce_key=coalesce_key,
+                    unicast=unicast,
+                    shard_key=shard_key,
+                    persistent=persistent,
                 )
                 self.requests[name] = request
         else:
             logging.debug(f"Config '{self.name}': No requests defined.")
         return error_count
 
+    def _positive_int(
+        self, config: Dict, key: str, request_name: str, error_count: int
+    ) -> Tuple[int, int]:
+        if key not in config or config[key] is None:
+            return 0, error_count
+        value = config[key]
+        if not isinstance(value, int) or isinstance(value, bool) or value < 1:
+            error_count += 1
+            logging.error(
+                f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{request_name}':\n"
+                f"'{key}' must be a positive integer!"
+            )
+            return 0, error_count
+        return value, error_count
+
+    def _parameter_encoding(
+        self, config: Dict, parameter: Parameter, request_name: str, error_count: int
+    ) -> int:
+        if "encoding" not in config or config["encoding"] is None:
+            return error_count
+        encoding = config["encoding"]
+        if encoding not in WIRE_ENCODINGS:
+            error_count += 1
+            logging.error(
+                f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{request_name}':\n"
+                f"Parameter '{parameter.name}': The encoding has to be one of {WIRE_ENCODINGS}!"
+            )
+            return error_count
+        if encoding == "varint" and not parameter.can_be_varint:
+            error_count += 1
+            logging.error(
+                f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': Request '{request_name}':\n"
+                f"Parameter '{parameter.name}': Only integers of 16 bit or more can be varints!"
+            )
+            return error_count
+        parameter.encoding = encoding
+        return error_count
+
     def create_interface(self) -> None:
         logging.debug(f"Config '{self.name}': Analyzing interface...")
         header_user_codes = {}
@@ -390,11 +577,19 @@ class ConfigParser:
                 )
                 if description is None:
                     description = ""
+                is_async = handler_config.get("async", False)
+                if not isinstance(is_async, bool):
+                    error_count += 1
+                    logging.error(
+                        f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Config '{self.name}': 'async' of subscribed request '{name}' must be true or false!"
+                    )
+                    is_async = False
                 handler = RequestHandler(
                     request=request,
                     description=description,
                     user_codes=user_codes,
                     module_name=self.name,
+                    is_async=is_async,
                 )
                 request.request_handlers.append(handler)
                 self.request_handlers[name] = handler
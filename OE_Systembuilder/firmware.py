@@ -170,26 +170,28 @@ class Firmware:
         for config_parser in self.config_parsers.values():
             config_parser.generate()
 
-    def system_info(self) -> None:
-        max_handlers: Dict[str, int] = dict.fromkeys(self.requests.keys(), 0)
-        handlers: Dict[str, int] = dict.fromkeys(self.requests.keys(), 0)
-
+    def handler_limit(self) -> int:
+        """
+        Return the highest number of handlers that one kernel registers for one
+        request. Each kernel has its own request map, so handlers of different
+        kernels do not add up.
+        """
+        limit = 0
         for kernel in self.kernels.values():
+            handlers: Dict[str, int] = {}
             for module in kernel.modules.values():
                 for request_handler in module.request_handlers.values():
-                    if request_handler.request.name in handlers:
-                        handlers[request_handler.request.name] += 1
-            for name, n_handlers in handlers.items():
-                if n_handlers > max_handlers[name]:
-                    max_handlers[name] = n_handlers
-
-        handler_limit = max(max_handlers.values()) if len(max_handlers) > 0 else 0
+                    name = request_handler.request.name
+                    handlers[name] = handlers.get(name, 0) + 1
+            limit = max([limit] + list(handlers.values()))
+        return limit
 
+    def system_info(self) -> None:
         logging.info(f"The number of kernels is {len(self.kernels)}.")
-        logging.info(f"The request handler limit is {handler_limit}.")
+        logging.info(f"The request handler limit is {self.handler_limit()}.")
 
-        message = f"Determination of the message data size is not implemented yet.\n"
-        message += "Please determine the message data size manually!"
+        message = "Run the command 'footprint' to determine the message data size\n"
+        message += "and the static RAM footprint of the OpenEDOS Core."
         logging.info(message)
 
 
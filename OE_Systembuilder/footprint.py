@@ -0,0 +1,485 @@
+"""
+OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT license
+
+https://github.com/SamuelArdayaLieb/OpenEDOS
+"""
+
+import re
+import logging
+from typing import Dict, List, Tuple
+
+from .firmware import Firmware
+from .message_handlers import Parameter
+from . import config_header
+from . import utils
+
+ARRAY_PATTERN = re.compile(r"^(\w+)\s*\[\s*(\w+)\s*\]$")
+POOL_CLASS_PATTERN = re.compile(r"CLASS\(\s*(\d+)\s*,\s*(\d+)\s*\)")
+
+# The basic types of each target as (size, alignment) in bytes.
+_COMMON_TYPES = {
+    "char": (1, 1),
+    "signed char": (1, 1),
+    "unsigned char": (1, 1),
+    "bool": (1, 1),
+    "_Bool": (1, 1),
+    "int8_t": (1, 1),
+    "uint8_t": (1, 1),
+    "int16_t": (2, 2),
+    "uint16_t": (2, 2),
+    "int32_t": (4, 4),
+    "uint32_t": (4, 4),
+    "float": (4, 4),
+}
+
+TYPE_MODELS: Dict[str, Dict[str, Tuple[int, int]]] = {
+    # Cortex-M and other 32 bit ARM targets (AAPCS).
+    "arm32": {
+        **_COMMON_TYPES,
+        "short": (2, 2),
+        "unsigned short": (2, 2),
+        "int": (4, 4),
+        "unsigned int": (4, 4),
+        "long": (4, 4),
+        "unsigned long": (4, 4),
+        "long long": (8, 8),
+        "unsigned long long": (8, 8),
+        "int64_t": (8, 8),
+        "uint64_t": (8, 8),
+        "double": (8, 8),
+        "size_t": (4, 4),
+        "pointer": (4, 4),
+        "enum": (4, 4),
+    },
+    # 32 bit RISC-V (ILP32).
+    "riscv32": {
+        **_COMMON_TYPES,
+        "short": (2, 2),
+        "unsigned short": (2, 2),
+        "int": (4, 4),
+        "unsigned int": (4, 4),
+        "long": (4, 4),
+        "unsigned long": (4, 4),
+        "long long": (8, 8),
+        "unsigned long long": (8, 8),
+        "int64_t": (8, 8),
+        "uint64_t": (8, 8),
+        "double": (8, 8),
+        "size_t": (4, 4),
+        "pointer": (4, 4),
+        "enum": (4, 4),
+    },
+    # 8 bit AVR (avr-gcc). Nothing is aligned, double is 32 bit by default.
+    "avr8": {
+        **{name: (size, 1) for name, (size, _) in _COMMON_TYPES.items()},
+        "short": (2, 1),
+        "unsigned short": (2, 1),
+        "int": (2, 1),
+        "unsigned int": (2, 1),
+        "long": (4, 1),
+        "unsigned long": (4, 1),
+        "long long": (8, 1),
+        "unsigned long long": (8, 1),
+        "int64_t": (8, 1),
+        "uint64_t": (8, 1),
+        "double": (4, 1),
+        "size_t": (2, 1),
+        "pointer": (2, 1),
+        "enum": (2, 1),
+    },
+    # 32 bit x86 (i386 System V), 64 bit types are only 4 byte aligned in structs.
+    "x86": {
+        **_COMMON_TYPES,
+        "short": (2, 2),
+        "unsigned short": (2, 2),
+        "int": (4, 4),
+        "unsigned int": (4, 4),
+        "long": (4, 4),
+        "unsigned long": (4, 4),
+        "long long": (8, 4),
+        "unsigned long long": (8, 4),
+        "int64_t": (8, 4),
+        "uint64_t": (8, 4),
+        "double": (8, 4),
+        "size_t": (4, 4),
+        "pointer": (4, 4),
+        "enum": (4, 4),
+    },
+    # 64 bit Linux hosts (LP64), e.g. the unit tests.
+    "x86_64": {
+        **_COMMON_TYPES,
+        "short": (2, 2),
+        "unsigned short": (2, 2),
+        "int": (4, 4),
+        "unsigned int": (4, 4),
+        "long": (8, 8),
+        "unsigned long": (8, 8),
+        "long long": (8, 8),
+        "unsigned long long": (8, 8),
+        "int64_t": (8, 8),
+        "uint64_t": (8, 8),
+        "double": (8, 8),
+        "size_t": (8, 8),
+        "pointer": (8, 8),
+        "enum": (4, 4),
+    },
+}
+
+DEFAULT_MODEL = "arm32"
+
+
+class TypeModel:
+    """
+    The type model knows the size and alignment of the types used in request
+    and response parameters on one target. Types that are not known (e.g. user
+    structs) can be added with add_type().
+    """
+
+    def __init__(self, model: str, number_of_kernels: int, short_enums: bool = False) -> None:
+        self.name = model
+        self.types: Dict[str, Tuple[int, int]] = dict(TYPE_MODELS[model])
+        if short_enums:
+            # With -fshort-enums the request ID enum fits into one byte if there are few requests.
+            self.types["enum"] = (1, 1)
+        for name in ["intptr_t", "uintptr_t", "ptrdiff_t"]:
+            self.types[name] = self.types["pointer"]
+        self.types["OE_MessageHandler_t"] = self.types["pointer"]
+        self.types["OE_RequestID_t"] = self.types["enum"]
+        self.types["OE_Error_t"] = self.types["enum"]
+        if number_of_kernels >= 0xFF:
+            self.types["OE_KernelID_t"] = self.types["uint16_t"]
+        else:
+            self.types["OE_KernelID_t"] = self.types["uint8_t"]
+
+    def add_type(self, name: str, size: int, alignment: int) -> None:
+        self.types[name] = (size, alignment)
+
+    def size_of(self, type: str) -> Tuple[int, int]:
+        """
+        Return size and alignment of a type or None if the type is unknown.
+        """
+        type = " ".join(
+            word for word in type.replace("*", " * ").split() if word not in ["const", "volatile"]
+        )
+        if "*" in type:
+            return self.types["pointer"]
+        if type.startswith("enum "):
+            return self.types["enum"]
+        if type == "unsigned":
+            type = "unsigned int"
+        return self.types.get(type)
+
+
+def align(offset: int, alignment: int) -> int:
+    return (offset + alignment - 1) // alignment * alignment
+
+
+def struct_layout(members: List[Tuple[int, int, int]]) -> Tuple[int, int]:
+    """
+    Return size and alignment of a struct. Each member is given as
+    (size, alignment, count) in the order of declaration.
+    """
+    offset = 0
+    alignment = 1
+    for size, member_alignment, count in members:
+        offset = align(offset, member_alignment) + size * count
+        alignment = max(alignment, member_alignment)
+    return align(offset, alignment), alignment
+
+
+def args_layout(
+    type_model: TypeModel, args: Dict[str, Parameter], struct_name: str
+) -> Tuple[int, List[str]]:
+    """
+    Return the size of a generated requestArgs/responseArgs struct and the
+    list of unknown types.
+    """
+    members: List[Tuple[int, int, int]] = []
+    unknown: List[str] = []
+    for arg in args.values():
+        type, count = arg.type, 1
+        match = ARRAY_PATTERN.match(arg.name.strip())
+        if match is not None:
+            if not match.group(2).isdigit():
+                unknown.append(f"{struct_name}.{arg.name}")
+                continue
+            count = int(match.group(2))
+        size = type_model.size_of(type)
+        if size is None:
+            unknown.append(type)
+            continue
+        members.append((size[0], size[1], count))
+    return struct_layout(members)[0], unknown
+
+
+class Footprint:
+    """
+    The footprint calculates the message data size from the generated parameter
+    structs and the static RAM of the OpenEDOS Core and the kernels. The RAM is
+    calculated with the sizes in oe_config.h, which the arrays are declared with.
+    The layout follows the structs in oe_defines.h, oe_message_queue.h,
+    oe_request_map.h, oe_kernel.h and oe_core_mod.h.
+    """
+
+    def __init__(
+        self,
+        fw: Firmware,
+        defines: Dict[str, str],
+        number_of_requests: int,
+        type_model: TypeModel,
+    ) -> None:
+        self.fw = fw
+        self.defines = defines
+        self.number_of_requests = number_of_requests
+        self.type_model = type_model
+        self.unknown_types: List[str] = []
+
+        # The values the firmware needs at least, see write_config().
+        self.required_kernels = max(len(fw.kernels), 1)
+        self.required_handler_limit = max(fw.handler_limit(), 1)
+
+        # The arrays are sized by oe_config.h, not by the firmware.
+        self.number_of_kernels = config_header.define_as_int(
+            defines, "OE_NUMBER_OF_KERNELS", self.required_kernels
+        )
+        self.handler_limit = config_header.define_as_int(
+            defines, "OE_REQUEST_HANDLER_LIMIT", self.required_handler_limit
+        )
+        self.queue_length = config_header.define_as_int(defines, "OE_MESSAGE_QUEUE_LENGTH", 1)
+        self.use_request_limit = config_header.define_as_int(defines, "OE_USE_REQUEST_LIMIT") != 0
+        self.use_rate_limit = config_header.define_as_int(defines, "OE_USE_RATE_LIMIT") != 0
+        self.use_statistics = config_header.define_as_int(defines, "OE_USE_MESSAGE_STATISTICS") != 0
+        self.use_isr_send = config_header.define_as_int(defines, "OE_USE_ISR_SEND") != 0
+        self.use_request_filters = config_header.define_as_int(defines, "OE_USE_REQUEST_FILTERS") != 0
+        self.use_shared_core = config_header.define_as_int(defines, "OE_USE_SHARED_CORE") != 0
+        self.use_bridge = config_header.define_as_int(defines, "OE_USE_BRIDGE") != 0
+        self.isr_sources = config_header.define_as_int(defines, "OE_NUMBER_OF_ISR_SOURCES", 1)
+        self.staging_ring_length = config_header.define_as_int(defines, "OE_STAGING_RING_LENGTH", 1)
+        self.use_message_pool = config_header.define_as_int(defines, "OE_USE_MESSAGE_POOL") != 0
+        self.use_coroutines = config_header.define_as_int(defines, "OE_USE_COROUTINES") != 0
+        # The size classes of the pool as (block size, number of blocks).
+        self.pool_classes = [
+            (int(size), int(count))
+            for size, count in POOL_CLASS_PATTERN.findall(defines.get("OE_MESSAGE_POOL_CLASSES", ""))
+        ]
+
+        self.args_sizes: Dict[str, int] = {}
+        for request in fw.requests.values():
+            self._add_args(f"requestArgs_{request.name}", request.request_sender.args)
+            if request.has_response:
+                self._add_args(f"responseArgs_{request.name}", request.response_sender.args)
+        self.required_message_data_size = max(list(self.args_sizes.values()) + [0])
+        self.message_data_size = config_header.define_as_int(
+            defines, "OE_MESSAGE_DATA_SIZE", self.required_message_data_size
+        )
+
+    def _add_args(self, struct_name: str, args: Dict[str, Parameter]) -> None:
+        if len(args) == 0:
+            return
+        size, unknown = args_layout(self.type_model, args, struct_name)
+        for type in unknown:
+            if type not in self.unknown_types:
+                self.unknown_types.append(type)
+        self.args_sizes[struct_name] = size
+
+    def _type(self, name: str) -> Tuple[int, int]:
+        return self.type_model.types[name]
+
+    def message(self) -> Tuple[int, int]:
+        members = [
+            (*self._type("uint8_t"), 1),
+            (*self._type("OE_RequestID_t"), 1),
+            (*self._type("pointer"), 1),
+        ]
+        if self.use_shared_core:
+            members.append((*self._type("uint16_t"), 1))
+        if self.use_bridge:
+            members.append((*self._type("uint32_t"), 1))
+        if self.use_message_pool:
+            members.append((*self._type("uint32_t"), 1))
+        if self.use_coroutines:
+            members.append((*self._type("uint16_t"), 1))
+        members.append((*self._type("OE_KernelID_t"), 1))
+        header = struct_layout(members)
+        return struct_layout([(*header, 1), (1, 1, self.message_data_size)])
+
+    def message_queue(self) -> Tuple[int, int]:
+        return struct_layout(
+            [
+                (*self.message(), self.queue_length + 1),
+                (*self._type("size_t"), 3),
+            ]
+        )
+
+    def staging_ring(self) -> Tuple[int, int]:
+        return struct_layout(
+            [
+                (*self.message(), self.staging_ring_length),
+                (*self._type("size_t"), 2),
+                (*self._type("bool"), 1),
+            ]
+        )
+
+    def message_pool(self) -> Tuple[int, int]:
+        blocks = sum(count for _, count in self.pool_classes)
+        memory = sum(size * count for size, count in self.pool_classes)
+        return struct_layout(
+            [
+                (*self._type("uint32_t"), len(self.pool_classes)),
+                (*self._type("uint16_t"), 3 * blocks),
+                (*self._type("uint8_t"), blocks),
+                (*self._type("uint32_t"), blocks),
+                (*self._type("uint64_t"), memory // 8),
+            ]
+        )
+
+    def request_filter(self) -> Tuple[int, int]:
+        return struct_layout(
+            [
+                (*self._type("uint16_t"), 1),
+                (*self._type("uint8_t"), 1),
+                (*self._type("uint32_t"), 2),
+            ]
+        )
+
+    def request_map(self) -> Tuple[int, int]:
+        members = [
+            (*self._type("pointer"), self.handler_limit),
+            (*self._type("size_t"), 1),
+            (*self._type("uint32_t"), 1),
+        ]
+        if self.use_request_filters:
+            members.append((*self.request_filter(), self.handler_limit))
+        node = struct_layout(members)
+        return node[0] * self.number_of_requests, node[1]
+
+    def kernel(self) -> Tuple[int, int]:
+        return struct_layout(
+            [
+                (*self._type("OE_KernelID_t"), 1),
+                (*self._type("pointer"), 1),
+                (*self._type("uint32_t"), 1),
+                (*self.request_map(), 1),
+            ]
+        )
+
+    def core_parts(self) -> List[Tuple[str, int, int, int]]:
+        """
+        Return the members of module_OE_Core_t as (name, size, alignment, count).
+        """
+        kernels = self.number_of_kernels
+        requests = self.number_of_requests
+        parts = [("Kernel", *self._type("pointer"), 1)]
+        # The kernel pointers of a shared core are kept in each process.
+        if not self.use_shared_core:
+            parts.append(("Kernels", *self._type("pointer"), kernels))
+        parts += [
+            ("NumberOfKernels", *self._type("size_t"), 1),
+            ("RequestSubscribed", *self._type("bool"), kernels * requests),
+        ]
+        if self.use_request_filters:
+            entry = struct_layout(
+                [
+                    (*self.request_filter(), self.handler_limit),
+                    (*self._type("size_t"), 1),
+                ]
+            )
+            parts.append(("RequestFilters", *entry, kernels * requests))
+        if self.use_request_limit:
+            entry = struct_layout([(*self._type("size_t"), 1)])
+            parts.append(("RequestRegisters", *entry, kernels * requests))
+        if self.use_rate_limit:
+            entry = struct_layout([(*self._type("uint32_t"), 2)])
+            parts.append(("RateBuckets", *entry, requests))
+        if self.use_statistics:
+            entry = struct_layout([(*self._type("uint32_t"), 3)])
+            parts.append(("MessageStatistics", *entry, (kernels + 1) * requests * kernels))
+        parts.append(("MessageQueues", *self.message_queue(), kernels))
+        if self.use_message_pool:
+            parts.append(("MessagePool", *self.message_pool(), 1))
+        if self.use_isr_send:
+            parts.append(("StagingRings", *self.staging_ring(), self.isr_sources))
+        return parts
+
+    def core(self) -> Tuple[int, int]:
+        return struct_layout([(size, alignment, count) for _, size, alignment, count in self.core_parts()])
+
+    def report(self) -> str:
+        text = f"Static RAM footprint (type model '{self.type_model.name}'):\n"
+        text += f"    Kernels: {self.number_of_kernels}, requests: {self.number_of_requests}, "
+        text += f"handler limit: {self.handler_limit}, queue length: {self.queue_length}\n"
+        text += f"    Message data size: {self.message_data_size} bytes\n"
+        text += f"    Required: kernels: {self.required_kernels}, "
+        text += f"handler limit: {self.required_handler_limit}, "
+        if len(self.args_sizes) > 0:
+            name, size = max(self.args_sizes.items(), key=lambda item: item[1])
+            text += f"message data size: {self.required_message_data_size} bytes (struct {name}_s)\n"
+        else:
+            text += "message data size: 0 bytes (no request or response parameters)\n"
+        text += f"    OE_Message_t: {self.message()[0]} bytes\n"
+        text += "module_OE_Core_t:\n"
+        offset = 0
+        for name, size, alignment, count in self.core_parts():
+            start = align(offset, alignment)
+            text += f"    {name}: {size * count} bytes"
+            if start != offset:
+                text += f" (+{start - offset} padding)"
+            text += "\n"
+            offset = start + size * count
+        core = self.core()[0]
+        if core != offset:
+            text += f"    (+{core - offset} padding)\n"
+        text += f"    Total: {core} bytes\n"
+        kernel = self.kernel()[0]
+        text += "OE_Kernel_t (including OE_RequestMap_t):\n"
+        text += f"    OE_RequestMap_t: {self.request_map()[0]} bytes\n"
+        text += f"    Per kernel: {kernel} bytes, {self.number_of_kernels} kernel(s): {kernel * self.number_of_kernels} bytes\n"
+        text += f"Total: {core + kernel * self.number_of_kernels} bytes"
+        return text
+
+
+def write_config(path_to_config_header: str, values: Dict[str, int]) -> int:
+    """
+    Replace the values of the given defines in oe_config.h. Everything else
+    in the file is left as it is. Returns the number of changed defines.
+    """
+    with open(path_to_config_header, "r") as file:
+        lines = file.read().split("\n")
+
+    changed = 0
+    for index, line in enumerate(lines):
+        match = config_header.DEFINE_PATTERN.match(line)
+        if match is None or match.group(1) not in values:
+            continue
+        value = str(values[match.group(1)])
+        if match.group(2).strip() == value:
+            continue
+        logging.info(
+            f"{match.group(1)}: {match.group(2).strip()} -> {utils.bcolors.OKGREEN}{value}{utils.bcolors.ENDC}"
+        )
+        start, end = match.span(2)
+        old = match.group(2)
+        # Keep trailing whitespace that belongs to the value group.
+        lines[index] = line[:start] + value + old[len(old.rstrip()) :] + line[end:]
+        changed += 1
+
+    if changed > 0:
+        with open(path_to_config_header, "w") as file:
+            file.write("\n".join(lines))
+    return changed
+
+
+def write_header(path_to_header: str, calculator: Footprint) -> None:
+    """
+    Write the calculated sizes as defines, e.g. to compare them with sizeof()
+    in a build of the project.
+    """
+    text = "/* Generated by 'openedos footprint'. */\n\n"
+    text += "#ifndef OE_FOOTPRINT_H\n#define OE_FOOTPRINT_H\n\n"
+    text += f"#define OE_FOOTPRINT_MESSAGE_SIZE {calculator.message()[0]}\n"
+    text += f"#define OE_FOOTPRINT_CORE_SIZE {calculator.core()[0]}\n"
+    text += f"#define OE_FOOTPRINT_REQUEST_MAP_SIZE {calculator.request_map()[0]}\n"
+    text += f"#define OE_FOOTPRINT_KERNEL_SIZE {calculator.kernel()[0]}\n"
+    text += "\n#endif // OE_FOOTPRINT_H\n"
+    with open(path_to_header, "w") as file:
+        file.write(text)
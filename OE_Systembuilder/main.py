@@ -13,6 +13,10 @@ from . import utils
 from . import config
 from . import firmware
 from . import project
+from . import traffic
+from . import placement
+from . import footprint
+from . import config_header
 
 __version__ = utils.OPENEDOS_VERSION
 version_message = "%(prog)s v%(version)s\n(c) 2022-2025 Samuel Ardaya-Lieb\nMIT license"
@@ -583,3 +587,368 @@ def update_core(path: str, debug: bool) -> None:
         return
 
     project.populate_core(path_to_core=path_to_core)
+
+
+@openedos.command(no_args_is_help=True)
+@click.argument("path", type=click.Path(resolve_path=True, file_okay=False))
+@click.option(
+    "-s",
+    "--statistics",
+    type=click.Path(resolve_path=True, dir_okay=False, exists=True),
+    required=True,
+    help="The CSV file with the exported message statistics.",
+)
+@click.option(
+    "-o",
+    "--output",
+    type=click.Path(resolve_path=True, dir_okay=False),
+    default=None,
+    help="The output file. Prints to stdout if not given.",
+)
+@click.option(
+    "-t",
+    "--format",
+    "output_format",
+    type=click.Choice(["dot", "json"]),
+    default="dot",
+    help="The output format.",
+)
+@click.option(
+    "-d", "--debug", is_flag=True, default=False, help="Print debug information."
+)
+def export_flow_graph(
+    path: str, statistics: str, output: str, output_format: str, debug: bool
+) -> None:
+    """
+    Export the message flow of a project located in PATH as weighted graph.
+    The message statistics counted by the core (OE_USE_MESSAGE_STATISTICS) are
+    merged with the module graph of the configs. The statistics are read as CSV
+    lines 'sender,request,receiver,requests,responses,bytes', as written by a
+    callback passed to OE_Core_exportMessageStatistics(). PATH is the top level
+    project directory with the directories 'Modules' and 'OE_Config'.
+    """
+    utils.set_logging(debug)
+
+    path_to_config_folder = os.path.join(path, "OE_Config")
+    if not os.path.isdir(path_to_config_folder):
+        logging.error("Could not find 'OE_Config' folder!")
+        return
+
+    path_to_modules_folder = os.path.join(path, "Modules")
+    if not os.path.isdir(path_to_modules_folder):
+        path_to_modules_folder = path
+
+    defines = config_header.read_defines(
+        os.path.join(path_to_config_folder, "oe_config.h")
+    )
+    request_ids = config_header.read_request_ids(
+        os.path.join(path_to_config_folder, "oe_requests.h"), defines
+    )
+    number_of_kernels = config_header.define_as_int(defines, "OE_NUMBER_OF_KERNELS", 1)
+
+    filelist = glob.glob(f"{path}/*_project.yaml")
+    path_to_project_config = filelist[0] if len(filelist) == 1 else None
+
+    fw, _ = firmware.parse_configs(
+        path_to_modules=path_to_modules_folder,
+        path_to_project_config=path_to_project_config,
+    )
+
+    records, _ = traffic.read_statistics(statistics, request_ids, number_of_kernels)
+
+    flow_graph = traffic.FlowGraph(fw)
+    flow_graph.add_records(records)
+
+    text = flow_graph.to_dot() if output_format == "dot" else flow_graph.to_json()
+
+    if output is None:
+        click.echo(text, nl=False)
+        return
+
+    with open(output, "w") as file:
+        file.write(text)
+
+    logging.info(
+        f"{utils.bcolors.OKGREEN}Flow graph written to {output}.{utils.bcolors.ENDC}"
+    )
+    logging.info(
+        f"{flow_graph.cross_kernel_messages():g} messages crossed kernel borders."
+    )
+
+
+@openedos.command(no_args_is_help=True)
+@click.argument("path", type=click.Path(resolve_path=True, file_okay=False))
+@click.option(
+    "-s",
+    "--statistics",
+    type=click.Path(resolve_path=True, dir_okay=False, exists=True),
+    required=True,
+    help="The CSV file with the exported message statistics.",
+)
+@click.option(
+    "-c",
+    "--costs",
+    type=click.Path(resolve_path=True, dir_okay=False, exists=True),
+    default=None,
+    help="A CSV file with the lines 'module,request,cost'. The default cost is 1.",
+)
+@click.option(
+    "-k",
+    "--kernels",
+    type=int,
+    default=None,
+    help="The number of kernels. Defaults to the current number of kernels.",
+)
+@click.option(
+    "-b",
+    "--balance",
+    type=float,
+    default=1.0,
+    help="The weight of the load balance compared to the cross kernel messages.",
+)
+@click.option(
+    "--pin",
+    multiple=True,
+    help="Keep a module on a kernel, e.g. --pin Display=0. OE_Core is always pinned.",
+)
+@click.option(
+    "-w",
+    "--write",
+    is_flag=True,
+    default=False,
+    help="Rewrite the 'kernel' key in the module configs.",
+)
+@click.option(
+    "-d", "--debug", is_flag=True, default=False, help="Print debug information."
+)
+def optimize_placement(
+    path: str,
+    statistics: str,
+    costs: str,
+    kernels: int,
+    balance: float,
+    pin: tuple,
+    write: bool,
+    debug: bool,
+) -> None:
+    """
+    Propose a module to kernel assignment for a project located in PATH.
+    The assignment is based on the message statistics counted by the core
+    (see export-flow-graph) and on the costs of the request handlers. It minimizes
+    the messages sent between kernels while balancing the load of the kernels.
+    PATH is the top level project directory with the directories 'Modules'
+    and 'OE_Config'.
+    """
+    utils.set_logging(debug)
+
+    path_to_config_folder = os.path.join(path, "OE_Config")
+    if not os.path.isdir(path_to_config_folder):
+        logging.error("Could not find 'OE_Config' folder!")
+        return
+
+    path_to_modules_folder = os.path.join(path, "Modules")
+    if not os.path.isdir(path_to_modules_folder):
+        path_to_modules_folder = path
+
+    defines = config_header.read_defines(
+        os.path.join(path_to_config_folder, "oe_config.h")
+    )
+    request_ids = config_header.read_request_ids(
+        os.path.join(path_to_config_folder, "oe_requests.h"), defines
+    )
+    number_of_kernels = config_header.define_as_int(defines, "OE_NUMBER_OF_KERNELS", 1)
+
+    fw, _ = firmware.parse_configs(
+        path_to_modules=path_to_modules_folder, path_to_project_config=None
+    )
+
+    records, _ = traffic.read_statistics(statistics, request_ids, number_of_kernels)
+    flow_graph = traffic.FlowGraph(fw)
+    flow_graph.add_records(records)
+
+    handler_costs = {}
+    if costs is not None:
+        handler_costs, _ = placement.read_costs(costs)
+
+    if kernels is None:
+        kernels = max(len(fw.kernels), 1)
+    elif kernels < 1:
+        logging.error(f"Invalid number of kernels: {kernels}!")
+        return
+
+    pinned = {"OE_Core": 0}
+    for entry in pin:
+        module, _, kernel = entry.partition("=")
+        if module not in flow_graph.module_kernels or not kernel.isdigit():
+            logging.error(f"Invalid pin '{entry}'! Expected <module>=<kernel>.")
+            return
+        if int(kernel) >= kernels:
+            logging.error(f"Invalid pin '{entry}': There are only {kernels} kernels!")
+            return
+        pinned[module] = int(kernel)
+
+    if len(flow_graph.module_kernels) < kernels:
+        logging.error(f"Cannot place {len(flow_graph.module_kernels)} modules on {kernels} kernels!")
+        return
+
+    try:
+        optimizer = placement.Placement(
+            flow_graph=flow_graph,
+            costs=handler_costs,
+            number_of_kernels=kernels,
+            pinned={module: kernel for module, kernel in pinned.items() if module in flow_graph.module_kernels},
+            balance=balance,
+        )
+    except ValueError as error:
+        logging.error(f"{error}")
+        return
+    assignment = optimizer.optimize()
+
+    logging.info(optimizer.report(assignment))
+
+    if not write:
+        return
+
+    placement.write_assignment(flow_graph, assignment)
+
+    if kernels != number_of_kernels:
+        logging.warning(
+            f"Please set OE_NUMBER_OF_KERNELS to {kernels} in oe_config.h and rerun update-project!"
+        )
+    else:
+        logging.info("Please rerun update-project to regenerate main.c.")
+
+
+@openedos.command("footprint", no_args_is_help=True)
+@click.argument("path", type=click.Path(resolve_path=True, file_okay=False))
+@click.option(
+    "-m",
+    "--model",
+    type=click.Choice(list(footprint.TYPE_MODELS.keys())),
+    default=footprint.DEFAULT_MODEL,
+    help="The type sizes and alignments of the target.",
+)
+@click.option(
+    "--short-enums",
+    is_flag=True,
+    default=False,
+    help="The target is compiled with -fshort-enums.",
+)
+@click.option(
+    "-t",
+    "--type",
+    "types",
+    multiple=True,
+    help="Size and alignment of a type that is not known, e.g. -t Point_t=8:4.",
+)
+@click.option(
+    "-w",
+    "--write",
+    is_flag=True,
+    default=False,
+    help="Write the number of kernels, the handler limit and the message data size to oe_config.h.",
+)
+@click.option(
+    "--header",
+    type=click.Path(resolve_path=True, dir_okay=False),
+    default=None,
+    help="Write the calculated sizes as defines to this header.",
+)
+@click.option(
+    "-d", "--debug", is_flag=True, default=False, help="Print debug information."
+)
+def calculate_footprint(
+    path: str,
+    model: str,
+    short_enums: bool,
+    types: tuple,
+    write: bool,
+    header: str,
+    debug: bool,
+) -> None:
+    """
+    Calculate the static RAM footprint of a project located in PATH.
+    The RAM used by the core (message queues, request subscriptions, request
+    registers) and by the request maps of the kernels is reported for the sizes
+    in oe_config.h. The sizes the firmware requires are reported as well, the
+    message data size is determined from the largest request or response
+    parameter struct. PATH is the top level project directory with the
+    directories 'Modules' and 'OE_Config'.
+    """
+    utils.set_logging(debug)
+
+    path_to_config_folder = os.path.join(path, "OE_Config")
+    if not os.path.isdir(path_to_config_folder):
+        logging.error("Could not find 'OE_Config' folder!")
+        return
+
+    path_to_modules_folder = os.path.join(path, "Modules")
+    if not os.path.isdir(path_to_modules_folder):
+        path_to_modules_folder = path
+
+    path_to_config_header = os.path.join(path_to_config_folder, "oe_config.h")
+    defines = config_header.read_defines(path_to_config_header)
+    request_ids = config_header.read_request_ids(
+        os.path.join(path_to_config_folder, "oe_requests.h"), defines
+    )
+
+    fw, ret = firmware.parse_configs(
+        path_to_modules=path_to_modules_folder, path_to_project_config=None
+    )
+
+    missing = [name for name, request in fw.requests.items() if request.RID not in request_ids]
+    if len(missing) > 0:
+        logging.warning(
+            f"oe_requests.h does not list {', '.join(missing)}. Please rerun update-project!"
+        )
+
+    type_model = footprint.TypeModel(
+        model,
+        config_header.define_as_int(defines, "OE_NUMBER_OF_KERNELS", max(len(fw.kernels), 1)),
+        short_enums,
+    )
+    for entry in types:
+        name, _, layout = entry.partition("=")
+        size, _, alignment = layout.partition(":")
+        if name.strip() == "" or not size.isdigit() or not (alignment == "" or alignment.isdigit()):
+            logging.error(f"Invalid type '{entry}'! Expected <type>=<size>[:<alignment>].")
+            return
+        type_model.add_type(name.strip(), int(size), int(alignment) if alignment else int(size))
+
+    calculator = footprint.Footprint(
+        fw=fw,
+        defines=defines,
+        number_of_requests=len(request_ids) + len(missing),
+        type_model=type_model,
+    )
+
+    logging.info(calculator.report())
+
+    if len(calculator.unknown_types) > 0:
+        logging.error(
+            f"Unknown types: {', '.join(calculator.unknown_types)}. Please add them with --type!"
+        )
+        return
+
+    if header is not None:
+        footprint.write_header(header, calculator)
+
+    if not write:
+        return
+
+    if ret > 0:
+        logging.error("oe_config.h is not written due to config errors!")
+        return
+
+    values = {
+        "OE_NUMBER_OF_KERNELS": calculator.required_kernels,
+        "OE_REQUEST_HANDLER_LIMIT": calculator.required_handler_limit,
+        "OE_MESSAGE_DATA_SIZE": calculator.required_message_data_size,
+    }
+    changed = footprint.write_config(path_to_config_header, values)
+    if changed == 0:
+        logging.info("oe_config.h is already tight.")
+    else:
+        logging.info(
+            f"{utils.bcolors.OKGREEN}Updated {changed} define(s) in oe_config.h.{utils.bcolors.ENDC}"
+        )
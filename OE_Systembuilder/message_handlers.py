@@ -10,11 +10,71 @@ from .user_code import UserCode
 from . import utils
 
 
+# The overload policies of the config and their names in oe_defines.h.
+OVERLOAD_POLICIES = {
+    "reject": "OE_OVERLOAD_REJECT",
+    "drop oldest": "OE_OVERLOAD_DROP_OLDEST",
+    "coalesce latest": "OE_OVERLOAD_COALESCE_LATEST",
+    "block": "OE_OVERLOAD_BLOCK",
+}
+
+# The types that have a fixed width in the wire format and whether they are signed.
+WIRE_INTEGER_TYPES = {
+    "bool": (1, False),
+    "char": (1, False),
+    "uint8_t": (1, False),
+    "int8_t": (1, True),
+    "uint16_t": (2, False),
+    "int16_t": (2, True),
+    "uint32_t": (4, False),
+    "int32_t": (4, True),
+    "uint64_t": (8, False),
+    "int64_t": (8, True),
+    # The plain C integer types have a width that depends on the platform. They
+    # are written with the largest width they have on the supported platforms,
+    # so that both ends of the wire agree on the layout.
+    "signed char": (1, True),
+    "unsigned char": (1, False),
+    "short": (2, True),
+    "unsigned short": (2, False),
+    "int": (4, True),
+    "unsigned": (4, False),
+    "unsigned int": (4, False),
+    "long": (8, True),
+    "unsigned long": (8, False),
+    "long long": (8, True),
+    "unsigned long long": (8, False),
+    "size_t": (8, False),
+}
+
+# Floating point types are written as their bit patterns.
+WIRE_FLOAT_TYPES = {
+    "float": (4, "OE_Wire_fromFloat", "OE_Wire_toFloat"),
+    "double": (8, "OE_Wire_fromDouble", "OE_Wire_toDouble"),
+}
+
+# The encodings of parameters in the wire format.
+WIRE_ENCODINGS = ["fixed", "varint"]
+
+
 class Parameter:
-    def __init__(self, name: str, type: str, description: str) -> None:
+    def __init__(
+        self, name: str, type: str, description: str, encoding: str = "fixed"
+    ) -> None:
         self.name = name
         self.type = type
+        # The type as it is looked up in the wire tables, e.g. "unsigned  int" -> "unsigned int".
+        self.wire_type = " ".join(type.split())
         self.description = description
+        # Only integers of 16 bit or more can be varints, see oe_wire.h.
+        self.encoding = encoding
+
+    @property
+    def can_be_varint(self) -> bool:
+        return (
+            self.wire_type in WIRE_INTEGER_TYPES
+            and WIRE_INTEGER_TYPES[self.wire_type][0] > 1
+        )
 
     def get_comment_text(self) -> str:
         return f"@param {self.name} {self.description}"
@@ -26,6 +86,42 @@ class Parameter:
             text = f"\t{self.type} {self.name}"
         return text
 
+    def get_encode_text(self) -> str:
+        if self.encoding == "varint":
+            value = f"(uint64_t)Args->{self.name}"
+            if WIRE_INTEGER_TYPES[self.wire_type][1]:
+                value = f"OE_Wire_zigzag((int64_t)Args->{self.name})"
+            return f"\tOE_Wire_writeVarint(Buffer, &Length, {value});\n"
+        if self.wire_type in WIRE_INTEGER_TYPES:
+            width = WIRE_INTEGER_TYPES[self.wire_type][0]
+            return f"\tOE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->{self.name}, {width});\n"
+        if self.wire_type in WIRE_FLOAT_TYPES:
+            width, convert, _ = WIRE_FLOAT_TYPES[self.wire_type]
+            return f"\tOE_Wire_writeFixed(Buffer, &Length, {convert}(Args->{self.name}), {width});\n"
+        # Other types are copied as they are.
+        return f"\tOE_Wire_writeBytes(Buffer, &Length, &(Args->{self.name}), sizeof({self.type}));\n"
+
+    def get_decode_text(self) -> str:
+        if self.encoding == "varint":
+            width, signed = WIRE_INTEGER_TYPES[self.wire_type]
+            read = f"OE_Wire_readVarint(Buffer, Size, &Length, {width}, &Value)"
+            value = f"({self.type})OE_Wire_unzigzag(Value)" if signed else f"({self.type})Value"
+        elif self.wire_type in WIRE_INTEGER_TYPES:
+            width = WIRE_INTEGER_TYPES[self.wire_type][0]
+            read = f"OE_Wire_readFixed(Buffer, Size, &Length, {width}, &Value)"
+            value = f"({self.type})Value"
+        elif self.wire_type in WIRE_FLOAT_TYPES:
+            width, _, convert = WIRE_FLOAT_TYPES[self.wire_type]
+            read = f"OE_Wire_readFixed(Buffer, Size, &Length, {width}, &Value)"
+            value = f"{convert}(Value)"
+        else:
+            read = f"OE_Wire_readBytes(Buffer, Size, &Length, sizeof({self.type}), &(Args->{self.name}))"
+            value = None
+        text = f"\tif (!{read})\n\t{'{'}\n\t\treturn 0;\n\t{'}'}\n"
+        if value is not None:
+            text += f"\tArgs->{self.name} = {value};\n"
+        return text
+
 
 class Sender:
     def __init__(
@@ -92,16 +188,70 @@ class Sender:
     def _body(self) -> str:
         return ""
 
+    def _codec_names(self) -> List[str]:
+        type = self.type.capitalize()
+        return [f"encode{type}_{self.name}", f"decode{type}_{self.name}"]
+
+    def _codec_prototypes(self) -> str:
+        if len(self.args) == 0:
+            return ""
+        encode, decode = self._codec_names()
+        struct = f"struct {self.type}Args_{self.name}_s"
+        text = "#if OE_USE_WIRE_FORMAT\n"
+        comment = f"@brief Encode the parameters of the {self.type}: {self.name}.\n\n"
+        comment += "@param Args Pointer to the parameters.\n"
+        comment += "@param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.\n"
+        comment += "@return size_t The number of written bytes is returned.\n"
+        text += utils.text_to_comment(comment)
+        text += f"size_t {encode}(\n\tconst {struct} *Args,\n\tuint8_t *Buffer);\n\n"
+        comment = f"@brief Decode the parameters of the {self.type}: {self.name}.\n\n"
+        comment += "@param Args Pointer to the parameters.\n"
+        comment += "@param Buffer Pointer to the encoded parameters.\n"
+        comment += "@param Size The number of bytes in the buffer.\n"
+        comment += "@return size_t The number of read bytes is returned.\n"
+        comment += "0 is returned if the buffer is too short or a value does not fit its type.\n"
+        text += utils.text_to_comment(comment)
+        text += f"size_t {decode}(\n\t{struct} *Args,\n\tconst uint8_t *Buffer,\n\tsize_t Size);\n"
+        text += "#endif // OE_USE_WIRE_FORMAT\n\n"
+        return text
+
+    def _codec_bodies(self) -> str:
+        if len(self.args) == 0:
+            return ""
+        encode, decode = self._codec_names()
+        struct = f"struct {self.type}Args_{self.name}_s"
+        text = "#if OE_USE_WIRE_FORMAT\n"
+        text += f"size_t {encode}(\n\tconst {struct} *Args,\n\tuint8_t *Buffer)\n{'{'}\n"
+        text += "\tsize_t Length = 0;\n\n"
+        for arg in self.args.values():
+            text += arg.get_encode_text()
+        text += "\n\treturn Length;\n}\n\n"
+        text += f"size_t {decode}(\n\t{struct} *Args,\n\tconst uint8_t *Buffer,\n\tsize_t Size)\n{'{'}\n"
+        text += "\tsize_t Length = 0;\n"
+        # Types that are copied as they are do not need a value.
+        if any(
+            arg.type in WIRE_INTEGER_TYPES or arg.type in WIRE_FLOAT_TYPES
+            for arg in self.args.values()
+        ):
+            text += "\tuint64_t Value;\n"
+        for arg in self.args.values():
+            text += f"\n{arg.get_decode_text()}"
+        text += "\n\treturn Length;\n}\n"
+        text += "#endif // OE_USE_WIRE_FORMAT\n\n"
+        return text
+
     def get_name_as_comment(self) -> str:
         return f"/* {self.name} */\n\n"
 
     def get_header_text(self) -> str:
         text = self._prototype()
         text += self._struct()
+        text += self._codec_prototypes()
         return text
 
     def get_source_text(self) -> str:
         text = self._body()
+        text += self._codec_bodies()
         return text
 
 
@@ -168,6 +318,41 @@ class RequestSender(Sender):
         return text
 
 
+class UnicastRequestSender(RequestSender):
+    def __init__(
+        self,
+        name: str,
+        response: bool,
+        description: str = "",
+        args: Dict[str, Parameter] = {},
+    ) -> None:
+        super().__init__(name, response, description, args)
+        self.func_name = f"req_{name}_to"
+        self.brief = f"@brief Send a message to request: {name} to one kernel.\n"
+        receiver_id = Parameter(
+            name="ReceiverID",
+            type="OE_KernelID_t",
+            description="The ID of the kernel\n"
+            "that receives this request.",
+        )
+        # The receiving kernel comes first.
+        self.parameters = {"ReceiverID": receiver_id, **self.parameters}
+
+    def _body(self) -> str:
+        text = super()._body()
+        return text.replace(
+            "\treturn OE_Core_sendRequest(\n",
+            "\treturn OE_Core_sendRequestTo(\n\t\tReceiverID,\n",
+        )
+
+    def get_header_text(self) -> str:
+        # The argument struct and its codec are declared by the broadcast sender.
+        return self._prototype()
+
+    def get_source_text(self) -> str:
+        return self._body()
+
+
 class ResponseSender(Sender):
     def __init__(
         self,
@@ -215,9 +400,34 @@ class Request:
         has_response: bool = False,
         response_description: str = "",
         response_args: Dict[str, Parameter] = {},
+        request_limit: int = 0,
+        rate_limit: int = 0,
+        rate_period: int = 0,
+        rate_burst: int = 0,
+        overload_policy: str = "reject",
+        block_timeout: int = 0,
+        coalesce: bool = False,
+        coalesce_key: Parameter = None,
+        unicast: bool = False,
+        shard_key: Parameter = None,
+        persistent: bool = False,
     ) -> None:
         self.name = name
         self.request_description = request_description
+        # 0 selects the global OE_REQUEST_LIMIT or disables the rate limit.
+        self.request_limit = request_limit
+        self.rate_limit = rate_limit
+        self.rate_period = rate_period
+        self.rate_burst = rate_burst
+        self.overload_policy = overload_policy
+        self.block_timeout = block_timeout
+        # Without a key, every queued request of this type is coalesced.
+        self.coalesce = coalesce
+        self.coalesce_key = coalesce_key
+        # The hash of the shard key selects one subscribing kernel.
+        self.shard_key = shard_key
+        # Persistent requests are appended to the journal.
+        self.persistent = persistent
         self.response_description = response_description
         self.has_response = has_response
         self.has_request_args = True if len(request_args) > 0 else False
@@ -228,6 +438,14 @@ class Request:
             description=request_description,
             args=request_args,
         )
+        self.unicast = unicast
+        if unicast:
+            self.unicast_sender = UnicastRequestSender(
+                name=name,
+                response=has_response,
+                description=request_description,
+                args=request_args,
+            )
         if has_response:
             self.response_sender = ResponseSender(
                 name=name, description=response_description, args=response_args
@@ -238,14 +456,62 @@ class Request:
         self.used_by: Set[str] = set()
         self.interface = None
 
+    @property
+    def has_attributes(self) -> bool:
+        return (
+            self.request_limit > 0
+            or self.rate_limit > 0
+            or self.overload_policy != "reject"
+            or self.coalesce
+            or self.shard_key is not None
+        )
+
+    def get_attributes_text(self) -> str:
+        text = f"[{self.RID}] = {'{'}"
+        text += f".RequestLimit = {self.request_limit}, "
+        text += f".RateLimit = {self.rate_limit}, "
+        text += f".RatePeriod = {self.rate_period}, "
+        text += f".RateBurst = {self.rate_burst}, "
+        text += f".OverloadPolicy = {OVERLOAD_POLICIES[self.overload_policy]}, "
+        text += f".BlockTimeout = {self.block_timeout}, "
+        text += f".Coalesce = {'true' if self.coalesce else 'false'}, "
+        key_size = f"sizeof({self.coalesce_key.type})" if self.coalesce_key is not None else "0"
+        text += f".CoalesceKeySize = {key_size}, "
+        key_size = f"sizeof({self.shard_key.type})" if self.shard_key is not None else "0"
+        text += f".ShardKeySize = {key_size}{'}'}"
+        return text
+
+    @property
+    def has_codec(self) -> bool:
+        return self.has_request_args or self.has_response_args
+
+    def get_codec_text(self) -> str:
+        text = f"[{self.RID}] = {'{'}"
+        if self.has_request_args:
+            encode, decode = self.request_sender._codec_names()
+            text += f".EncodeRequest = (OE_WireEncoder_t){encode}, "
+            text += f".DecodeRequest = (OE_WireDecoder_t){decode}"
+        if self.has_request_args and self.has_response_args:
+            text += ", "
+        if self.has_response_args:
+            encode, decode = self.response_sender._codec_names()
+            text += f".EncodeResponse = (OE_WireEncoder_t){encode}, "
+            text += f".DecodeResponse = (OE_WireDecoder_t){decode}"
+        text += "}"
+        return text
+
     def get_header_text(self):
         text = self.request_sender.get_header_text()
+        if self.unicast:
+            text += self.unicast_sender.get_header_text()
         if self.has_response:
             text += self.response_sender.get_header_text()
         return text
 
     def get_source_text(self):
         text = self.request_sender.get_source_text()
+        if self.unicast:
+            text += self.unicast_sender.get_source_text()
         if self.has_response:
             text += self.response_sender.get_source_text()
         return text
@@ -332,15 +598,18 @@ class RequestHandler(Handler):
         description: str = "",
         user_codes: Dict[str, UserCode] = {},
         module_name: str = "",
+        is_async: bool = False,
     ) -> None:
         self.request = request
         self.RID = request.RID
+        self.is_async = is_async
         name = request.name
         func_name = f"handleRequest_{name}"
         brief = f"@brief Handle the request: {name}.\n"
         type = "request"
         has_args = True if request.has_request_args else False
-        has_message_header = request.has_response
+        # A coroutine keeps the header to respond after an await.
+        has_message_header = request.has_response or is_async
 
         super().__init__(
             name=name,
@@ -354,6 +623,98 @@ class RequestHandler(Handler):
             module_name=module_name,
         )
 
+        if self.is_async:
+            self.brief += "\nThe handler is a coroutine (see oe_coroutine.h).\n"
+            self.user_code_locals = self._async_user_code(user_codes, "LOCALS")
+            self.user_code_busy = self._async_user_code(user_codes, "BUSY")
+            self.user_code_busy.indents = 2
+
+    def _async_user_code(self, user_codes: Dict[str, UserCode], section: str) -> UserCode:
+        id = f"ASYNC {utils.name_to_filename(name=self.name).replace('_', ' ').upper()} {section}"
+        user_code = user_codes[id] if id in user_codes else UserCode(identifier=id)
+        user_code.indents = 1
+        return user_code
+
+    def _async_state(self) -> str:
+        text = f"/* The state of the handler of the request: {self.name}. */\n"
+        text += f"static struct async_{self.name}_s {{\n"
+        text += "\t/* The coroutine of the handler. */\n"
+        text += "\tOE_Coroutine_t Coroutine;\n\n"
+        text += "\t/* A copy of the request. */\n"
+        text += "\tOE_MessageHeader_t Header;\n"
+        if self.has_args:
+            text += f"\tstruct requestArgs_{self.name}_s Args;\n"
+        text += "\n\t/* Locals that are kept across awaits. */\n"
+        text += self.user_code_locals.get_text()
+        text += f"}} async_{self.name};\n\n"
+        return text
+
+    def _async_prototypes(self) -> str:
+        text = utils.text_to_comment(
+            f"@brief Run the handler of the request: {self.name} until it awaits a response or ends.\n"
+        )
+        text += f"static void stepAsync_{self.name}(void);\n\n"
+        comment = f"@brief Resume the handler of the request: {self.name} with a response.\n\n"
+        comment += "Pass this function as response handler of the awaited requests.\n\n"
+        comment += "@param Header Pointer to the header of the response message.\n"
+        comment += "@param Args Pointer to the response parameters.\n"
+        text += utils.text_to_comment(comment)
+        text += f"static void resumeAsync_{self.name}(\n"
+        text += "\tOE_MessageHeader_t *Header,\n"
+        text += "\tvoid *Args);\n\n"
+        text += "/* Send a request with the ID RequestID and await its response. */\n"
+        text += f"#define AWAIT_{self.name}(RequestID, Send) \\\n"
+        text += f"\tOE_COROUTINE_AWAIT(&(async_{self.name}.Coroutine), {self.module_name}->Kernel->KernelID, RequestID, Send)\n\n"
+        return text
+
+    def get_prototype(self):
+        text = super().get_prototype()
+        if self.is_async:
+            text += self._async_state()
+            text += self._async_prototypes()
+        return text
+
+    def get_body(self):
+        if not self.is_async:
+            return super().get_body()
+        state = f"async_{self.name}"
+        text = f"void {self.func_name}(\n\tOE_MessageHeader_t *Header"
+        if self.has_args:
+            text += f",\n\tstruct requestArgs_{self.name}_s *Args"
+        text += ")\n{\n"
+        text += "\t/* The handler still awaits a response to an earlier request. */\n"
+        text += f"\tif (OE_COROUTINE_IS_RUNNING(&({state}.Coroutine)))\n"
+        text += "\t{\n"
+        text += self.user_code_busy.get_text()
+        text += "\t\treturn;\n"
+        text += "\t}\n\n"
+        text += f"\t{state}.Header = *Header;\n"
+        if self.has_args:
+            text += f"\t{state}.Args = *Args;\n"
+        text += f"\tstepAsync_{self.name}();\n"
+        text += "}\n\n"
+        text += f"void resumeAsync_{self.name}(\n"
+        text += "\tOE_MessageHeader_t *Header,\n"
+        text += "\tvoid *Args)\n{\n"
+        text += f"\tif (OE_Coroutine_resume(&({state}.Coroutine), Header, Args))\n"
+        text += "\t{\n"
+        text += f"\t\tstepAsync_{self.name}();\n"
+        text += "\t}\n"
+        text += "}\n\n"
+        text += f"void stepAsync_{self.name}(void)\n{{\n"
+        text += f"\tOE_MessageHeader_t *Header = &({state}.Header);\n"
+        if self.has_args:
+            text += f"\tstruct requestArgs_{self.name}_s *Args = &({state}.Args);\n"
+        text += "\n\t/* Avoid unused warning. */\n"
+        text += "\t(void)Header;\n"
+        if self.has_args:
+            text += "\t(void)Args;\n"
+        text += f"\n\tOE_COROUTINE_BEGIN(&({state}.Coroutine));\n"
+        text += self.user_code.get_text()
+        text += f"\tOE_COROUTINE_END(&({state}.Coroutine));\n"
+        text += "}\n\n"
+        return text
+
 
 class ResponseHandler(Handler):
     def __init__(
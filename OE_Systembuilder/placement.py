@@ -0,0 +1,266 @@
+"""
+OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT license
+
+https://github.com/SamuelArdayaLieb/OpenEDOS
+"""
+
+import os
+import csv
+import yaml
+import logging
+from typing import Dict, List, Tuple
+
+from .traffic import FlowGraph
+from . import config
+from . import utils
+
+ALL_REQUESTS = "*"
+
+
+def read_costs(path_to_costs: str) -> Tuple[Dict[Tuple[str, str], float], int]:
+    """
+    Read the handler costs from a CSV file with the lines 'module,request,cost'.
+    The cost is the CPU time (in any unit) one handler call takes. The request
+    may be given with or without the prefix 'RID_'. A request '*' sets the cost
+    for all handlers of a module.
+    """
+    costs: Dict[Tuple[str, str], float] = {}
+    error_count = 0
+
+    with open(path_to_costs, "r", newline="") as file:
+        for line_number, row in enumerate(csv.reader(file), start=1):
+            if len(row) != 3:
+                continue
+            module, request, cost = (field.strip() for field in row)
+            try:
+                value = float(cost)
+            except ValueError:
+                # This also skips a header line.
+                continue
+            if value < 0:
+                error_count += 1
+                logging.warning(
+                    f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Line {line_number}: Negative cost for '{module}'!"
+                )
+                continue
+            if request.startswith("RID_"):
+                request = request[4:]
+            costs[(module, request)] = value
+
+    return costs, error_count
+
+
+class Placement:
+    """
+    The placement assigns modules to kernels. It minimizes the messages that
+    cross kernel borders and keeps the handler load of the kernels balanced.
+
+    The cost of an assignment is
+
+        cross kernel messages / all messages + balance * (max load / mean load - 1)
+
+    Both terms are relative, so the balance factor weighs them independently of
+    the absolute numbers. The search starts from the current assignment and from
+    a greedy assignment and improves both by moving and swapping single modules
+    until no step lowers the cost. Every kernel keeps at least one module, so the
+    kernels stay enumerated consecutively.
+    """
+
+    def __init__(
+        self,
+        flow_graph: FlowGraph,
+        costs: Dict[Tuple[str, str], float],
+        number_of_kernels: int,
+        pinned: Dict[str, int],
+        balance: float = 1.0,
+    ) -> None:
+        self.flow_graph = flow_graph
+        self.number_of_kernels = number_of_kernels
+        self.balance = balance
+        self.current: Dict[str, int] = dict(flow_graph.module_kernels)
+        self.pinned = pinned
+        self.modules = sorted(self.current.keys())
+        self.movable = [module for module in self.modules if module not in pinned]
+
+        # Traffic between modules and between modules and fixed nodes.
+        self.weights: Dict[str, Dict[str, float]] = {module: {} for module in self.modules}
+        self.fixed: Dict[str, Dict[int, float]] = {module: {} for module in self.modules}
+        self.total_messages = 0.0
+        for (a, b), weight in flow_graph.module_weights().items():
+            self.total_messages += weight
+            if a in self.current and b in self.current:
+                self.weights[a][b] = self.weights[a].get(b, 0.0) + weight
+                self.weights[b][a] = self.weights[b].get(a, 0.0) + weight
+            elif a in self.current or b in self.current:
+                module, other = (a, b) if a in self.current else (b, a)
+                kernel = flow_graph.kernel_of(other)
+                if kernel is not None:
+                    self.fixed[module][kernel] = self.fixed[module].get(kernel, 0.0) + weight
+
+        # The load of a module is the cost of all messages it handles.
+        self.loads: Dict[str, float] = dict.fromkeys(self.modules, 0.0)
+        for edge in flow_graph.edges.values():
+            if edge.destination not in self.loads:
+                continue
+            cost = costs.get(
+                (edge.destination, edge.request),
+                costs.get((edge.destination, ALL_REQUESTS), 1.0),
+            )
+            self.loads[edge.destination] += edge.messages * cost
+
+        for module, kernel in pinned.items():
+            if kernel < 0 or kernel >= number_of_kernels:
+                raise ValueError(
+                    f"Cannot pin '{module}' to kernel {kernel}: There are only {number_of_kernels} kernels!"
+                )
+
+    def kernel_loads(self, assignment: Dict[str, int]) -> List[float]:
+        # The current assignment may use more kernels than the proposed one.
+        loads = [0.0] * max([self.number_of_kernels] + [kernel + 1 for kernel in assignment.values()])
+        for module, kernel in assignment.items():
+            loads[kernel] += self.loads[module]
+        return loads
+
+    def cross_kernel_messages(self, assignment: Dict[str, int]) -> float:
+        count = 0.0
+        for module in self.modules:
+            for other, weight in self.weights[module].items():
+                # Each pair is listed twice.
+                if module < other and assignment[module] != assignment[other]:
+                    count += weight
+            for kernel, weight in self.fixed[module].items():
+                if assignment[module] != kernel:
+                    count += weight
+        return count
+
+    def cost(self, assignment: Dict[str, int]) -> float:
+        cut = self.cross_kernel_messages(assignment)
+        cost = cut / self.total_messages if self.total_messages > 0 else 0.0
+        loads = self.kernel_loads(assignment)
+        mean = sum(loads) / len(loads)
+        if mean > 0:
+            cost += self.balance * (max(loads) / mean - 1.0)
+        return cost
+
+    def _valid(self, assignment: Dict[str, int]) -> bool:
+        return len(set(assignment.values())) == self.number_of_kernels
+
+    def _pin(self, assignment: Dict[str, int]) -> Dict[str, int]:
+        # The pins only apply to the candidates, the current assignment stays as configured.
+        pinned = dict(assignment)
+        for module, kernel in self.pinned.items():
+            if module in pinned:
+                pinned[module] = kernel
+        return pinned
+
+    def _greedy(self) -> Dict[str, int]:
+        assignment = {module: kernel for module, kernel in self.pinned.items() if module in self.current}
+        loads = [0.0] * self.number_of_kernels
+        for module, kernel in assignment.items():
+            loads[kernel] += self.loads[module]
+        mean = sum(self.loads.values()) / self.number_of_kernels
+
+        # Place the busiest modules first.
+        order = sorted(
+            self.movable,
+            key=lambda module: -(self.loads[module] + sum(self.weights[module].values())),
+        )
+        for module in order:
+            best_kernel, best_score = 0, None
+            for kernel in range(self.number_of_kernels):
+                affinity = self.fixed[module].get(kernel, 0.0)
+                affinity += sum(
+                    weight
+                    for other, weight in self.weights[module].items()
+                    if assignment.get(other) == kernel
+                )
+                score = affinity / self.total_messages if self.total_messages > 0 else 0.0
+                if mean > 0:
+                    score -= self.balance * (loads[kernel] + self.loads[module]) / mean
+                # Empty kernels have to be filled.
+                if not any(value == kernel for value in assignment.values()):
+                    score += 1e9
+                if best_score is None or score > best_score:
+                    best_kernel, best_score = kernel, score
+            assignment[module] = best_kernel
+            loads[best_kernel] += self.loads[module]
+        return assignment
+
+    def _improve(self, assignment: Dict[str, int]) -> Dict[str, int]:
+        assignment = dict(assignment)
+        best = self.cost(assignment)
+        improved = True
+        while improved:
+            improved = False
+            # Move single modules.
+            for module in self.movable:
+                origin = assignment[module]
+                for kernel in range(self.number_of_kernels):
+                    if kernel == origin:
+                        continue
+                    assignment[module] = kernel
+                    if self._valid(assignment):
+                        cost = self.cost(assignment)
+                        if cost < best - 1e-12:
+                            best, origin, improved = cost, kernel, True
+                    assignment[module] = origin
+            # Swap pairs of modules.
+            for i, a in enumerate(self.movable):
+                for b in self.movable[i + 1 :]:
+                    if assignment[a] == assignment[b]:
+                        continue
+                    assignment[a], assignment[b] = assignment[b], assignment[a]
+                    cost = self.cost(assignment)
+                    if cost < best - 1e-12:
+                        best, improved = cost, True
+                    else:
+                        assignment[a], assignment[b] = assignment[b], assignment[a]
+        return assignment
+
+    def optimize(self) -> Dict[str, int]:
+        candidates = [self._greedy()]
+        current = self._pin(self.current)
+        if self._valid(current) and max(current.values()) < self.number_of_kernels:
+            candidates.append(current)
+        results = [self._improve(candidate) for candidate in candidates]
+        return min(results, key=self.cost)
+
+    def report(self, assignment: Dict[str, int]) -> str:
+        text = "Proposed module placement:\n"
+        for module in self.modules:
+            marker = " (pinned)" if module in self.pinned else ""
+            change = "" if self.current[module] == assignment[module] else " <- moved"
+            text += f"    {module}: kernel {self.current[module]} -> {assignment[module]}{marker}{change}\n"
+        text += f"Cross kernel messages: {self.cross_kernel_messages(self.current):g}"
+        text += f" -> {self.cross_kernel_messages(assignment):g}"
+        text += f" (of {self.total_messages:g})\n"
+        before = ", ".join(f"{load:g}" for load in self.kernel_loads(self.current))
+        after = ", ".join(f"{load:g}" for load in self.kernel_loads(assignment))
+        text += f"Kernel loads: [{before}] -> [{after}]\n"
+        text += f"Cost: {self.cost(self.current):.4f} -> {self.cost(assignment):.4f}"
+        return text
+
+
+def write_assignment(flow_graph: FlowGraph, assignment: Dict[str, int]) -> None:
+    """
+    Rewrite the 'kernel' key in the module configs whose kernel changed.
+    """
+    for config_parser in flow_graph.fw.config_parsers.values():
+        if config_parser.name not in assignment:
+            continue
+        kernel = assignment[config_parser.name]
+        if config_parser.module_config["kernel"] == kernel:
+            continue
+        # Reload the config to keep the file as it was written.
+        with open(config_parser.path_to_config, "r") as config_file:
+            module_config = yaml.load(config_file, Loader=yaml.FullLoader)
+        if "module" not in module_config or module_config["module"] is None:
+            module_config["module"] = {}
+        module_config["module"]["kernel"] = kernel
+        logging.info(f"Config '{config_parser.name}': Moving module to kernel {kernel}.")
+        config.save_config(
+            path_to_folder=os.path.dirname(config_parser.path_to_config),
+            file_name=config_parser.config_filename,
+            config=module_config,
+            override=True,
+        )
@@ -36,6 +36,9 @@ def create_project_config(path_to_folder: str, project_name: str) -> None:
 
 def create_requests_header(fw: firmware.Firmware, path_to_config_folder: str) -> None:
     request_ids: Dict[str, list] = {}
+    request_attributes: list = []
+    request_codecs: list = []
+    persistent_requests: list = []
     filename = "oe_requests.h"
     path_to_file = os.path.join(path_to_config_folder, filename)
     authors: Set = set()
@@ -47,6 +50,13 @@ def create_requests_header(fw: firmware.Firmware, path_to_config_folder: str) ->
             request_ids[config_parser.name] = []
             for request in config_parser.requests.values():
                 request_ids[config_parser.name].append(request.RID)
+                # System requests may be disabled, see OE_USE_SYSTEM_REQUESTS.
+                if request.has_attributes and config_parser.name != "OE_Core":
+                    request_attributes.append(request.get_attributes_text())
+                if request.has_codec and config_parser.name != "OE_Core":
+                    request_codecs.append(request.get_codec_text())
+                if request.persistent and config_parser.name != "OE_Core":
+                    persistent_requests.append(request.RID)
 
     if os.path.isfile(path_to_file):
         logging.debug(f"Creating oe_requests.h: Found existing file  @\n{path_to_file}")
@@ -66,6 +76,9 @@ def create_requests_header(fw: firmware.Firmware, path_to_config_folder: str) ->
         version=fw.project_config["version"],
         copyright_notice=fw.project_config["copyright notice"],
         request_ids=request_ids,
+        request_attributes=request_attributes,
+        request_codecs=request_codecs,
+        persistent_requests=persistent_requests,
         user_codes=user_codes,
     )
 
@@ -170,6 +183,8 @@ def populate_core(path_to_core: str) -> None:
         "oe_kernel.h",
         "oe_message_queue.c",
         "oe_message_queue.h",
+        "oe_message_pool.c",
+        "oe_message_pool.h",
         "oe_request_map.c",
         "oe_request_map.h",
     ]:
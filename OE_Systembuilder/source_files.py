@@ -161,6 +161,9 @@ class InterfaceSource(File):
 
         header_name = utils.name_to_filename(f"{name}_intf.h")
         self.includes = [f'"{header_name}"', '"oe_core_mod.h"']
+        # The codecs of the parameter structs use the wire format.
+        if any(request.has_codec for request in requests.values()):
+            self.includes.append('"oe_wire.h"')
         id = "INTERFACE GLOBALS"
         self.user_code_globals = (
             user_codes[id] if id in user_codes else UserCode(identifier=id)
@@ -333,6 +336,8 @@ class ModuleSource(File):
 
         headername = utils.name_to_filename(f"{name}_mod.h")
         self.includes = [f'"{headername}"', '"oe_kernel.h"']
+        if any(handler.is_async for handler in request_handlers.values()):
+            self.includes.append('"oe_coroutine.h"')
 
     def _user_includes(self) -> str:
         text = "/* Includes, prototypes, globals, etc. */\n"
@@ -402,7 +407,7 @@ OE_Error_t initModule_{self.name}(
     /* Setup the module connections. */
     {self.name} = p{self.name};
     {self.name}->Kernel = Kernel;
-
+{self._async_reset()}
     /* Register the request handlers. */
     Error = OE_Kernel_registerHandlers(
         Kernel,
@@ -437,6 +442,15 @@ OE_Error_t initModule_{self.name}(
 {'}'}\n\n"""
         return text
 
+    def _async_reset(self) -> str:
+        handlers = [h for h in self.request_handlers.values() if h.is_async]
+        if len(handlers) == 0:
+            return ""
+        text = "\n    /* No coroutine awaits a response yet. */\n"
+        for handler in handlers:
+            text += f"    async_{handler.name}.Coroutine = (OE_Coroutine_t){{0}};\n"
+        return text
+
     def _custom_init(self) -> str:
         text = "//~~~~~~~~~~~~~~~~~~~~~~~~~ Custom init function ~~~~~~~~~~~~~~~~~~~~~~~~//\n\n"
         text += f"OE_Error_t init_{self.name}(void *Args)\n"
@@ -498,6 +512,9 @@ class RequestsHeader(File):
         version: str,
         copyright_notice: str,
         request_ids: Dict[str, List[str]] = {},
+        request_attributes: List[str] = [],
+        request_codecs: List[str] = [],
+        persistent_requests: List[str] = [],
         user_codes: Dict[str, UserCode] = {},
     ) -> None:
         filename = "oe_requests.h"
@@ -511,6 +528,9 @@ class RequestsHeader(File):
         )
 
         self.request_ids = request_ids
+        self.request_attributes = request_attributes
+        self.request_codecs = request_codecs
+        self.persistent_requests = persistent_requests
 
         self.includes = ['"oe_config.h"']
 
@@ -546,6 +566,48 @@ typedef enum OE_RequestID_e
 {'}'} OE_RequestID_t;\n\n"""
         return text
 
+    def _request_attributes(self) -> str:
+        if len(self.request_attributes) == 0:
+            return ""
+        text = """/**
+ * The request attributes set the request limit, the rate limit, the overload policy, the
+ * coalescing and the sharding of single requests. Requests that are not listed use
+ * OE_REQUEST_LIMIT, are not rate limited, are rejected on overload and are never
+ * coalesced or sharded.
+ */
+#define OE_REQUEST_ATTRIBUTES { \\\n"""
+        for attributes in self.request_attributes:
+            text += f"\t{attributes}, \\\n"
+        text += "}\n\n"
+        return text
+
+    def _request_codecs(self) -> str:
+        if len(self.request_codecs) == 0:
+            return ""
+        text = """/**
+ * The request codecs list the generated functions that encode the request and response
+ * parameters in the wire format (see oe_wire.h). The functions are declared in the
+ * interface headers, so the list can only be used where all of them are included.
+ */
+#define OE_REQUEST_CODECS { \\\n"""
+        for codec in self.request_codecs:
+            text += f"\t{codec}, \\\n"
+        text += "}\n\n"
+        return text
+
+    def _persistent_requests(self) -> str:
+        if len(self.persistent_requests) == 0:
+            return ""
+        text = """/**
+ * The persistent requests are appended to the journal and sent again on startup
+ * (see oe_journal.h).
+ */
+#define OE_PERSISTENT_REQUESTS { \\\n"""
+        for request_id in self.persistent_requests:
+            text += f"\t{request_id}, \\\n"
+        text += "}\n\n"
+        return text
+
     def _guard_bot(self) -> str:
         text = f"#endif // {self.filename.replace('.', '_').upper()}"
         return text
@@ -554,6 +616,9 @@ typedef enum OE_RequestID_e
         self.sections.append(self._guard_top())
         self.sections.append(self._file_description())
         self.sections.append(self._request_ids())
+        self.sections.append(self._request_attributes())
+        self.sections.append(self._request_codecs())
+        self.sections.append(self._persistent_requests())
         self.sections.append(self._guard_bot())
         return super().get_text()
 
@@ -611,7 +676,8 @@ class KernelThread:
         elif (id in user_codes and user_codes[id].code == "\n") or id not in user_codes:
             code = "\tOE_Error_t Error;\n"
             code += "\tvoid *ModuleArgs;\n"
-            code += f"\tOE_Kernel_t Kernel_{self.kernel_id};\n\n"
+            code += "\t/* The kernel is static, so it is zero at startup (see OE_USE_FAST_BOOT). */\n"
+            code += f"\tstatic OE_Kernel_t Kernel_{self.kernel_id};\n\n"
             for module_name in self.module_names:
                 code += f"\tmodule_{module_name}_t {module_name};\n"
             code += "\n\t/* Avoid unused warning. */\n\t(void)Args;\n\n"
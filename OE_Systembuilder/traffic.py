@@ -0,0 +1,334 @@
+"""
+OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT license
+
+https://github.com/SamuelArdayaLieb/OpenEDOS
+"""
+
+import csv
+import json
+import logging
+from typing import Dict, List, Tuple
+
+from .firmware import Firmware
+from . import utils
+
+EXTERNAL = "External"
+
+
+class Record:
+    """
+    One line of exported message statistics, see OE_Core_exportMessageStatistics().
+    A sender of None means that the sending kernel is unknown.
+    """
+
+    def __init__(
+        self,
+        sender: int,
+        request: str,
+        receiver: int,
+        requests: int,
+        responses: int,
+        bytes: int,
+    ) -> None:
+        self.sender = sender
+        self.request = request
+        self.receiver = receiver
+        self.requests = requests
+        self.responses = responses
+        self.bytes = bytes
+
+
+class Edge:
+    def __init__(self, source: str, destination: str, request: str) -> None:
+        self.source = source
+        self.destination = destination
+        self.request = request
+        self.requests = 0.0
+        self.responses = 0.0
+        self.bytes = 0.0
+
+    @property
+    def messages(self) -> float:
+        return self.requests + self.responses
+
+
+def read_statistics(
+    path_to_statistics: str, request_ids: List[str], number_of_kernels: int
+) -> Tuple[List[Record], int]:
+    """
+    Read message statistics from a CSV file with the lines
+    'sender,request,receiver,requests,responses,bytes'. The request is either
+    the numeric request ID or its name (e.g. RID_Kernel_Start). Lines that
+    cannot be parsed, e.g. other log output, are skipped.
+    """
+    records: List[Record] = []
+    error_count = 0
+
+    with open(path_to_statistics, "r", newline="") as file:
+        for line_number, row in enumerate(csv.reader(file), start=1):
+            if len(row) != 6:
+                continue
+            row = [field.strip() for field in row]
+            try:
+                sender = int(row[0], 0)
+                receiver = int(row[2], 0)
+                requests, responses, bytes = (int(field, 0) for field in row[3:])
+            except ValueError:
+                # This also skips a header line.
+                continue
+
+            request = row[1]
+            if request.lstrip("-").isdigit():
+                index = int(request)
+                if index < 0 or index >= len(request_ids):
+                    error_count += 1
+                    logging.warning(
+                        f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Line {line_number}: Request ID {index} is not listed in oe_requests.h!"
+                    )
+                    continue
+                request = request_ids[index]
+            elif request not in request_ids:
+                error_count += 1
+                logging.warning(
+                    f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Line {line_number}: Request '{request}' is not listed in oe_requests.h!"
+                )
+                continue
+
+            if receiver < 0 or receiver >= number_of_kernels:
+                error_count += 1
+                logging.warning(
+                    f"{utils.bcolors.FAIL}{error_count}{utils.bcolors.ENDC}: Line {line_number}: Invalid receiving kernel {receiver}!"
+                )
+                continue
+
+            # OE_NO_KERNEL and any other invalid ID mark an unknown sender.
+            if sender < 0 or sender >= number_of_kernels:
+                sender = None
+
+            records.append(
+                Record(sender, request, receiver, requests, responses, bytes)
+            )
+
+    logging.debug(f"Read {len(records)} statistic records.")
+    return records, error_count
+
+
+class FlowGraph:
+    """
+    The flow graph merges the static module graph of the configs with the
+    message statistics counted by the core. Nodes are modules, edges point
+    from the module that sends a message to the module that handles it.
+
+    The core only counts messages per kernel. Traffic between two kernels is
+    therefore assigned to the modules that use or subscribe the request in
+    these kernels. If several modules in the sending kernel use the same
+    request, the traffic is split evenly between them.
+    """
+
+    def __init__(self, fw: Firmware) -> None:
+        self.fw = fw
+        self.module_kernels: Dict[str, int] = {}
+        self.edges: Dict[Tuple[str, str, str], Edge] = {}
+        self.unassigned = 0
+
+        for kernel in fw.kernels.values():
+            for module in kernel.modules.values():
+                self.module_kernels[module.name] = kernel.kernel_number
+
+        self._add_static_edges()
+
+    def _edge(self, source: str, destination: str, request: str) -> Edge:
+        key = (source, destination, request)
+        if key not in self.edges:
+            self.edges[key] = Edge(source, destination, request)
+        return self.edges[key]
+
+    def _users(self, request_name: str, kernel: int = None) -> List[str]:
+        request = self.fw.requests.get(request_name)
+        if request is None:
+            return []
+        return sorted(
+            name
+            for name in request.used_by
+            if name in self.module_kernels
+            and (kernel is None or self.module_kernels[name] == kernel)
+        )
+
+    def _subscribers(self, request_name: str, kernel: int = None) -> List[str]:
+        request = self.fw.requests.get(request_name)
+        if request is None:
+            return []
+        return sorted(
+            handler.module_name
+            for handler in request.request_handlers
+            if handler.module_name in self.module_kernels
+            and (kernel is None or self.module_kernels[handler.module_name] == kernel)
+        )
+
+    def _add_static_edges(self) -> None:
+        for name in self.fw.requests:
+            for user in self._users(name):
+                for subscriber in self._subscribers(name):
+                    self._edge(user, subscriber, name)
+
+    def _senders(self, request_name: str, kernel: int) -> List[str]:
+        if kernel is None:
+            return [EXTERNAL]
+        users = self._users(request_name, kernel)
+        if len(users) == 0:
+            # Someone outside of the configured modules sent the message.
+            return [f"Kernel {kernel}"]
+        return users
+
+    def add_record(self, record: Record) -> None:
+        name = record.request[4:] if record.request.startswith("RID_") else record.request
+        total = record.requests + record.responses
+        if total == 0:
+            return
+
+        # The statistics do not tell request bytes and response bytes apart.
+        request_bytes = record.bytes * record.requests / total
+        response_bytes = record.bytes - request_bytes
+
+        if record.requests > 0:
+            senders = self._senders(name, record.sender)
+            receivers = self._subscribers(name, record.receiver)
+            if len(receivers) == 0:
+                receivers = [f"Kernel {record.receiver}"]
+                self.unassigned += record.requests
+            for sender in senders:
+                # Each subscribing module of the receiving kernel handles the same message.
+                for receiver in receivers:
+                    edge = self._edge(sender, receiver, name)
+                    edge.requests += record.requests / len(senders)
+                    edge.bytes += request_bytes / len(senders)
+
+        if record.responses > 0:
+            if record.sender is None:
+                responders = [EXTERNAL]
+            else:
+                responders = self._subscribers(name, record.sender)
+                if len(responders) == 0:
+                    responders = [f"Kernel {record.sender}"]
+            requesters = self._users(name, record.receiver)
+            if len(requesters) == 0:
+                requesters = [f"Kernel {record.receiver}"]
+                self.unassigned += record.responses
+            share = len(responders) * len(requesters)
+            for responder in responders:
+                for requester in requesters:
+                    edge = self._edge(responder, requester, name)
+                    edge.responses += record.responses / share
+                    edge.bytes += response_bytes / share
+
+    def add_records(self, records: List[Record]) -> None:
+        for record in records:
+            self.add_record(record)
+        if self.unassigned > 0:
+            logging.warning(
+                f"{self.unassigned} messages could not be assigned to a configured module."
+            )
+
+    def kernel_of(self, node: str) -> int:
+        if node in self.module_kernels:
+            return self.module_kernels[node]
+        if node.startswith("Kernel "):
+            return int(node[len("Kernel ") :])
+        return None
+
+    def nodes(self) -> List[str]:
+        names = set(self.module_kernels.keys())
+        for edge in self.edges.values():
+            names.add(edge.source)
+            names.add(edge.destination)
+        return sorted(names)
+
+    def module_weights(self) -> Dict[Tuple[str, str], float]:
+        """
+        Return the undirected traffic between each pair of modules, summed
+        over all requests. Self loops are left out.
+        """
+        weights: Dict[Tuple[str, str], float] = {}
+        for edge in self.edges.values():
+            if edge.source == edge.destination or edge.messages == 0:
+                continue
+            key = tuple(sorted((edge.source, edge.destination)))
+            weights[key] = weights.get(key, 0.0) + edge.messages
+        return weights
+
+    def cross_kernel_messages(self) -> float:
+        count = 0.0
+        for edge in self.edges.values():
+            if self.kernel_of(edge.source) != self.kernel_of(edge.destination):
+                count += edge.messages
+        return count
+
+    def to_json(self) -> str:
+        graph = {
+            "nodes": [
+                {"name": node, "kernel": self.kernel_of(node)} for node in self.nodes()
+            ],
+            "edges": [
+                {
+                    "source": edge.source,
+                    "destination": edge.destination,
+                    "request": edge.request,
+                    "requests": round(edge.requests, 3),
+                    "responses": round(edge.responses, 3),
+                    "bytes": round(edge.bytes, 3),
+                    "cross kernel": self.kernel_of(edge.source)
+                    != self.kernel_of(edge.destination),
+                }
+                for edge in sorted(
+                    self.edges.values(), key=lambda edge: -edge.messages
+                )
+            ],
+        }
+        return json.dumps(graph, indent=2)
+
+    def to_dot(self) -> str:
+        max_messages = max(
+            [edge.messages for edge in self.edges.values()] + [1.0]
+        )
+        kernels: Dict[int, List[str]] = {}
+        others: List[str] = []
+        for node in self.nodes():
+            kernel = self.kernel_of(node)
+            if kernel is None:
+                others.append(node)
+            else:
+                kernels.setdefault(kernel, []).append(node)
+
+        text = f'digraph "{self.fw.project_name}" {"{"}\n'
+        text += "\trankdir=LR;\n"
+        text += "\tnode [shape=box, style=rounded];\n\n"
+        for kernel in sorted(kernels):
+            text += f"\tsubgraph cluster_kernel_{kernel} {'{'}\n"
+            text += f'\t\tlabel="Kernel {kernel}";\n'
+            for node in kernels[kernel]:
+                text += f'\t\t"{node}";\n'
+            text += "\t}\n\n"
+        for node in others:
+            text += f'\t"{node}" [shape=ellipse, style=dashed];\n'
+
+        for edge in sorted(self.edges.values(), key=lambda edge: edge.request):
+            label = edge.request
+            attributes = {"color": "black"}
+            if edge.messages > 0:
+                label += f"\\n{edge.requests:g} req"
+                if edge.responses > 0:
+                    label += f" / {edge.responses:g} res"
+                label += f"\\n{edge.bytes:g} B"
+                attributes["penwidth"] = f"{1.0 + 7.0 * edge.messages / max_messages:.2f}"
+            else:
+                # Configured, but no traffic was counted.
+                attributes["style"] = "dashed"
+                attributes["color"] = "gray"
+            if self.kernel_of(edge.source) != self.kernel_of(edge.destination):
+                attributes["color"] = "red"
+            text += f'\t"{edge.source}" -> "{edge.destination}" [label="{label}"'
+            for key, value in attributes.items():
+                text += f", {key}={value}"
+            text += "];\n"
+        text += "}\n"
+        return text
@@ -0,0 +1,717 @@
+/**
+ * @note This file was autogenerated with OpenEDOS v2.2.
+ * Sections inside USER CODE BEGIN and USER CODE END will be left untouched 
+ * when rerunning the code generation. Happy coding!
+ * 
+ * @file async_io_intf.c
+ * @author Samuel Ardaya-Lieb
+ */
+
+/* USER CODE COPYRIGHT NOTICE BEGIN */
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+/* USER CODE COPYRIGHT NOTICE END */
+
+/* USER CODE FILE INTRODUCTION BEGIN */
+/* USER CODE FILE INTRODUCTION END */
+
+#include "async_io_intf.h"
+#include "oe_core_mod.h"
+#include "oe_wire.h"
+
+/* Includes, typedefs, globals, etc. */
+/* USER CODE INTERFACE GLOBALS BEGIN */
+/* USER CODE INTERFACE GLOBALS END */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Requests ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+OE_Error_t req_AsyncIO_Read(
+	int File,
+	uint32_t Length,
+	uint8_t * Buffer,
+	int64_t Offset,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_AsyncIO_Read,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_AsyncIO_Read_s){
+			File,
+			Length,
+			Buffer,
+			Offset,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_AsyncIO_Read(
+	const struct requestArgs_AsyncIO_Read_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->File, 4);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Length, 4);
+	OE_Wire_writeBytes(Buffer, &Length, &(Args->Buffer), sizeof(uint8_t *));
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Offset, 8);
+
+	return Length;
+}
+
+size_t decodeRequest_AsyncIO_Read(
+	struct requestArgs_AsyncIO_Read_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->File = (int)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Length = (uint32_t)Value;
+
+	if (!OE_Wire_readBytes(Buffer, Size, &Length, sizeof(uint8_t *), &(Args->Buffer)))
+	{
+		return 0;
+	}
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 8, &Value))
+	{
+		return 0;
+	}
+	Args->Offset = (int64_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t res_AsyncIO_Read(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader)
+{
+	return OE_Core_sendResponse(
+		RequestHeader,
+		&(struct responseArgs_AsyncIO_Read_s){
+			Result,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_AsyncIO_Read(
+	const struct responseArgs_AsyncIO_Read_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Result, 4);
+
+	return Length;
+}
+
+size_t decodeResponse_AsyncIO_Read(
+	struct responseArgs_AsyncIO_Read_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Result = (int32_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_AsyncIO_Write(
+	int File,
+	uint32_t Length,
+	const uint8_t * Buffer,
+	int64_t Offset,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_AsyncIO_Write,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_AsyncIO_Write_s){
+			File,
+			Length,
+			Buffer,
+			Offset,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_AsyncIO_Write(
+	const struct requestArgs_AsyncIO_Write_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->File, 4);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Length, 4);
+	OE_Wire_writeBytes(Buffer, &Length, &(Args->Buffer), sizeof(const uint8_t *));
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Offset, 8);
+
+	return Length;
+}
+
+size_t decodeRequest_AsyncIO_Write(
+	struct requestArgs_AsyncIO_Write_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->File = (int)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Length = (uint32_t)Value;
+
+	if (!OE_Wire_readBytes(Buffer, Size, &Length, sizeof(const uint8_t *), &(Args->Buffer)))
+	{
+		return 0;
+	}
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 8, &Value))
+	{
+		return 0;
+	}
+	Args->Offset = (int64_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t res_AsyncIO_Write(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader)
+{
+	return OE_Core_sendResponse(
+		RequestHeader,
+		&(struct responseArgs_AsyncIO_Write_s){
+			Result,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_AsyncIO_Write(
+	const struct responseArgs_AsyncIO_Write_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Result, 4);
+
+	return Length;
+}
+
+size_t decodeResponse_AsyncIO_Write(
+	struct responseArgs_AsyncIO_Write_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Result = (int32_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_AsyncIO_Fsync(
+	int File,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_AsyncIO_Fsync,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_AsyncIO_Fsync_s){
+			File,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_AsyncIO_Fsync(
+	const struct requestArgs_AsyncIO_Fsync_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->File, 4);
+
+	return Length;
+}
+
+size_t decodeRequest_AsyncIO_Fsync(
+	struct requestArgs_AsyncIO_Fsync_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->File = (int)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t res_AsyncIO_Fsync(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader)
+{
+	return OE_Core_sendResponse(
+		RequestHeader,
+		&(struct responseArgs_AsyncIO_Fsync_s){
+			Result,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_AsyncIO_Fsync(
+	const struct responseArgs_AsyncIO_Fsync_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Result, 4);
+
+	return Length;
+}
+
+size_t decodeResponse_AsyncIO_Fsync(
+	struct responseArgs_AsyncIO_Fsync_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Result = (int32_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_AsyncIO_Accept(
+	int File,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_AsyncIO_Accept,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_AsyncIO_Accept_s){
+			File,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_AsyncIO_Accept(
+	const struct requestArgs_AsyncIO_Accept_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->File, 4);
+
+	return Length;
+}
+
+size_t decodeRequest_AsyncIO_Accept(
+	struct requestArgs_AsyncIO_Accept_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->File = (int)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t res_AsyncIO_Accept(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader)
+{
+	return OE_Core_sendResponse(
+		RequestHeader,
+		&(struct responseArgs_AsyncIO_Accept_s){
+			Result,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_AsyncIO_Accept(
+	const struct responseArgs_AsyncIO_Accept_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Result, 4);
+
+	return Length;
+}
+
+size_t decodeResponse_AsyncIO_Accept(
+	struct responseArgs_AsyncIO_Accept_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Result = (int32_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_AsyncIO_Recv(
+	int File,
+	uint32_t Length,
+	uint8_t * Buffer,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_AsyncIO_Recv,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_AsyncIO_Recv_s){
+			File,
+			Length,
+			Buffer,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_AsyncIO_Recv(
+	const struct requestArgs_AsyncIO_Recv_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->File, 4);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Length, 4);
+	OE_Wire_writeBytes(Buffer, &Length, &(Args->Buffer), sizeof(uint8_t *));
+
+	return Length;
+}
+
+size_t decodeRequest_AsyncIO_Recv(
+	struct requestArgs_AsyncIO_Recv_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->File = (int)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Length = (uint32_t)Value;
+
+	if (!OE_Wire_readBytes(Buffer, Size, &Length, sizeof(uint8_t *), &(Args->Buffer)))
+	{
+		return 0;
+	}
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t res_AsyncIO_Recv(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader)
+{
+	return OE_Core_sendResponse(
+		RequestHeader,
+		&(struct responseArgs_AsyncIO_Recv_s){
+			Result,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_AsyncIO_Recv(
+	const struct responseArgs_AsyncIO_Recv_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Result, 4);
+
+	return Length;
+}
+
+size_t decodeResponse_AsyncIO_Recv(
+	struct responseArgs_AsyncIO_Recv_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Result = (int32_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_AsyncIO_Send(
+	int File,
+	uint32_t Length,
+	const uint8_t * Buffer,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_AsyncIO_Send,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_AsyncIO_Send_s){
+			File,
+			Length,
+			Buffer,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_AsyncIO_Send(
+	const struct requestArgs_AsyncIO_Send_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->File, 4);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Length, 4);
+	OE_Wire_writeBytes(Buffer, &Length, &(Args->Buffer), sizeof(const uint8_t *));
+
+	return Length;
+}
+
+size_t decodeRequest_AsyncIO_Send(
+	struct requestArgs_AsyncIO_Send_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->File = (int)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Length = (uint32_t)Value;
+
+	if (!OE_Wire_readBytes(Buffer, Size, &Length, sizeof(const uint8_t *), &(Args->Buffer)))
+	{
+		return 0;
+	}
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t res_AsyncIO_Send(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader)
+{
+	return OE_Core_sendResponse(
+		RequestHeader,
+		&(struct responseArgs_AsyncIO_Send_s){
+			Result,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_AsyncIO_Send(
+	const struct responseArgs_AsyncIO_Send_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Result, 4);
+
+	return Length;
+}
+
+size_t decodeResponse_AsyncIO_Send(
+	struct responseArgs_AsyncIO_Send_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Result = (int32_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_AsyncIO_Flush(void)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_AsyncIO_Flush,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		NULL);
+}
+
+OE_Error_t req_AsyncIO_Complete(
+	int File,
+	uint32_t Events)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_AsyncIO_Complete,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_AsyncIO_Complete_s){
+			File,
+			Events,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_AsyncIO_Complete(
+	const struct requestArgs_AsyncIO_Complete_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->File, 4);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Events, 4);
+
+	return Length;
+}
+
+size_t decodeRequest_AsyncIO_Complete(
+	struct requestArgs_AsyncIO_Complete_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->File = (int)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Events = (uint32_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+/* Something else...? */
+/* USER CODE INTERFACE SOURCE BEGIN */
+/* USER CODE INTERFACE SOURCE END */
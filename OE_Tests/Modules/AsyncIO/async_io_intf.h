@@ -0,0 +1,710 @@
+/**
+ * @note This file was autogenerated with OpenEDOS v2.2.
+ * Sections inside USER CODE BEGIN and USER CODE END will be left untouched 
+ * when rerunning the code generation. Happy coding!
+ * 
+ * @file async_io_intf.h
+ * @author Samuel Ardaya-Lieb
+ */
+
+/* USER CODE COPYRIGHT NOTICE BEGIN */
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+/* USER CODE COPYRIGHT NOTICE END */
+
+/* USER CODE FILE INTRODUCTION BEGIN */
+/* USER CODE FILE INTRODUCTION END */
+
+#ifndef ASYNC_IO_INTF_H
+#define ASYNC_IO_INTF_H
+
+#include "oe_defines.h"
+
+/* Includes, defines, typedefs, etc. */
+/* USER CODE INTERFACE HEADER BEGIN */
+/* USER CODE INTERFACE HEADER END */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Requests ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/**
+ * @brief Send a message to request: AsyncIO_Read.
+ * 
+ * Read from a file without blocking the kernel.
+ * Response: Yes
+ * 
+ * @param File The file descriptor.
+ * @param Length The number of bytes to read.
+ * @param Buffer The buffer. It has to stay valid until the response is handled.
+ * @param Offset The file offset. -1 reads at the file position.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_AsyncIO_Read(
+	int File,
+	uint32_t Length,
+	uint8_t * Buffer,
+	int64_t Offset,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
+struct requestArgs_AsyncIO_Read_s {
+	int File;
+	uint32_t Length;
+	uint8_t * Buffer;
+	int64_t Offset;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: AsyncIO_Read.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_AsyncIO_Read(
+	const struct requestArgs_AsyncIO_Read_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: AsyncIO_Read.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_AsyncIO_Read(
+	struct requestArgs_AsyncIO_Read_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a response to the request: AsyncIO_Read.
+ * 
+ * The read is complete.
+ * 
+ * @param Result The number of bytes read, or a negative errno.
+ * @param RequestHeader A pointer to the header of
+ * the request message to which this response is sent.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t res_AsyncIO_Read(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader);
+
+struct responseArgs_AsyncIO_Read_s {
+	int32_t Result;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: AsyncIO_Read.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_AsyncIO_Read(
+	const struct responseArgs_AsyncIO_Read_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: AsyncIO_Read.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_AsyncIO_Read(
+	struct responseArgs_AsyncIO_Read_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: AsyncIO_Write.
+ * 
+ * Write to a file without blocking the kernel.
+ * Response: Yes
+ * 
+ * @param File The file descriptor.
+ * @param Length The number of bytes to write.
+ * @param Buffer The buffer. It has to stay valid until the response is handled.
+ * @param Offset The file offset. -1 writes at the file position.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_AsyncIO_Write(
+	int File,
+	uint32_t Length,
+	const uint8_t * Buffer,
+	int64_t Offset,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
+struct requestArgs_AsyncIO_Write_s {
+	int File;
+	uint32_t Length;
+	const uint8_t * Buffer;
+	int64_t Offset;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: AsyncIO_Write.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_AsyncIO_Write(
+	const struct requestArgs_AsyncIO_Write_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: AsyncIO_Write.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_AsyncIO_Write(
+	struct requestArgs_AsyncIO_Write_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a response to the request: AsyncIO_Write.
+ * 
+ * The write is complete.
+ * 
+ * @param Result The number of bytes written, or a negative errno.
+ * @param RequestHeader A pointer to the header of
+ * the request message to which this response is sent.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t res_AsyncIO_Write(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader);
+
+struct responseArgs_AsyncIO_Write_s {
+	int32_t Result;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: AsyncIO_Write.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_AsyncIO_Write(
+	const struct responseArgs_AsyncIO_Write_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: AsyncIO_Write.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_AsyncIO_Write(
+	struct responseArgs_AsyncIO_Write_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: AsyncIO_Fsync.
+ * 
+ * Flush a file to its storage without blocking the kernel.
+ * Response: Yes
+ * 
+ * @param File The file descriptor.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_AsyncIO_Fsync(
+	int File,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
+struct requestArgs_AsyncIO_Fsync_s {
+	int File;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: AsyncIO_Fsync.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_AsyncIO_Fsync(
+	const struct requestArgs_AsyncIO_Fsync_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: AsyncIO_Fsync.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_AsyncIO_Fsync(
+	struct requestArgs_AsyncIO_Fsync_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a response to the request: AsyncIO_Fsync.
+ * 
+ * The file is flushed.
+ * 
+ * @param Result 0, or a negative errno.
+ * @param RequestHeader A pointer to the header of
+ * the request message to which this response is sent.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t res_AsyncIO_Fsync(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader);
+
+struct responseArgs_AsyncIO_Fsync_s {
+	int32_t Result;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: AsyncIO_Fsync.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_AsyncIO_Fsync(
+	const struct responseArgs_AsyncIO_Fsync_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: AsyncIO_Fsync.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_AsyncIO_Fsync(
+	struct responseArgs_AsyncIO_Fsync_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: AsyncIO_Accept.
+ * 
+ * Accept a connection without blocking the kernel.
+ * Response: Yes
+ * 
+ * @param File The listening socket.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_AsyncIO_Accept(
+	int File,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
+struct requestArgs_AsyncIO_Accept_s {
+	int File;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: AsyncIO_Accept.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_AsyncIO_Accept(
+	const struct requestArgs_AsyncIO_Accept_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: AsyncIO_Accept.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_AsyncIO_Accept(
+	struct requestArgs_AsyncIO_Accept_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a response to the request: AsyncIO_Accept.
+ * 
+ * A connection is accepted.
+ * 
+ * @param Result The socket of the connection, or a negative errno.
+ * @param RequestHeader A pointer to the header of
+ * the request message to which this response is sent.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t res_AsyncIO_Accept(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader);
+
+struct responseArgs_AsyncIO_Accept_s {
+	int32_t Result;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: AsyncIO_Accept.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_AsyncIO_Accept(
+	const struct responseArgs_AsyncIO_Accept_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: AsyncIO_Accept.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_AsyncIO_Accept(
+	struct responseArgs_AsyncIO_Accept_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: AsyncIO_Recv.
+ * 
+ * Receive from a socket without blocking the kernel.
+ * Response: Yes
+ * 
+ * @param File The socket.
+ * @param Length The size of the buffer.
+ * @param Buffer The buffer. It has to stay valid until the response is handled.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_AsyncIO_Recv(
+	int File,
+	uint32_t Length,
+	uint8_t * Buffer,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
+struct requestArgs_AsyncIO_Recv_s {
+	int File;
+	uint32_t Length;
+	uint8_t * Buffer;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: AsyncIO_Recv.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_AsyncIO_Recv(
+	const struct requestArgs_AsyncIO_Recv_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: AsyncIO_Recv.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_AsyncIO_Recv(
+	struct requestArgs_AsyncIO_Recv_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a response to the request: AsyncIO_Recv.
+ * 
+ * Data is received.
+ * 
+ * @param Result The number of bytes received, or a negative errno.
+ * @param RequestHeader A pointer to the header of
+ * the request message to which this response is sent.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t res_AsyncIO_Recv(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader);
+
+struct responseArgs_AsyncIO_Recv_s {
+	int32_t Result;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: AsyncIO_Recv.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_AsyncIO_Recv(
+	const struct responseArgs_AsyncIO_Recv_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: AsyncIO_Recv.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_AsyncIO_Recv(
+	struct responseArgs_AsyncIO_Recv_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: AsyncIO_Send.
+ * 
+ * Send to a socket without blocking the kernel.
+ * Response: Yes
+ * 
+ * @param File The socket.
+ * @param Length The number of bytes to send.
+ * @param Buffer The buffer. It has to stay valid until the response is handled.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_AsyncIO_Send(
+	int File,
+	uint32_t Length,
+	const uint8_t * Buffer,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
+struct requestArgs_AsyncIO_Send_s {
+	int File;
+	uint32_t Length;
+	const uint8_t * Buffer;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: AsyncIO_Send.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_AsyncIO_Send(
+	const struct requestArgs_AsyncIO_Send_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: AsyncIO_Send.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_AsyncIO_Send(
+	struct requestArgs_AsyncIO_Send_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a response to the request: AsyncIO_Send.
+ * 
+ * The data is sent.
+ * 
+ * @param Result The number of bytes sent, or a negative errno.
+ * @param RequestHeader A pointer to the header of
+ * the request message to which this response is sent.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t res_AsyncIO_Send(
+	int32_t Result,
+	OE_MessageHeader_t* RequestHeader);
+
+struct responseArgs_AsyncIO_Send_s {
+	int32_t Result;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: AsyncIO_Send.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_AsyncIO_Send(
+	const struct responseArgs_AsyncIO_Send_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: AsyncIO_Send.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_AsyncIO_Send(
+	struct responseArgs_AsyncIO_Send_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: AsyncIO_Flush.
+ * 
+ * Start the submitted operations. The I/O module sends this request to itself, so that the operations of all queued requests are started at once.
+ * Response: No
+ * 
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_AsyncIO_Flush(void);
+
+/**
+ * @brief Send a message to request: AsyncIO_Complete.
+ * 
+ * This request is sent when operations are complete.
+ * Response: No
+ * 
+ * @param File The eventfd of the io_uring instance.
+ * @param Events The ready events.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_AsyncIO_Complete(
+	int File,
+	uint32_t Events);
+
+struct requestArgs_AsyncIO_Complete_s {
+	int File;
+	uint32_t Events;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: AsyncIO_Complete.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_AsyncIO_Complete(
+	const struct requestArgs_AsyncIO_Complete_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: AsyncIO_Complete.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_AsyncIO_Complete(
+	struct requestArgs_AsyncIO_Complete_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+#endif // ASYNC_IO_INTF_H
\ No newline at end of file
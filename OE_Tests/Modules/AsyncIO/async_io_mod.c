@@ -0,0 +1,393 @@
+/**
+ * @note This file was autogenerated with OpenEDOS v2.2.
+ * Sections inside USER CODE BEGIN and USER CODE END will be left untouched 
+ * when rerunning the code generation. Happy coding!
+ * 
+ * @file async_io_mod.c
+ * @author Samuel Ardaya-Lieb
+ */
+
+/* USER CODE COPYRIGHT NOTICE BEGIN */
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+/* USER CODE COPYRIGHT NOTICE END */
+
+/* USER CODE FILE INTRODUCTION BEGIN */
+/* USER CODE FILE INTRODUCTION END */
+
+#include "async_io_mod.h"
+#include "oe_kernel.h"
+
+/* Includes, prototypes, globals, etc. */
+/* USER CODE MODULE GLOBALS BEGIN */
+#include "oe_core_mod.h"
+#include "oe_epoll.h"
+
+#include <errno.h>
+
+/**
+ * @brief Submit an operation and make sure that it is flushed.
+ *
+ * @param Header Pointer to the header of the request message.
+ * @param Operation Pointer to the operation.
+ */
+static void submit(
+    OE_MessageHeader_t *Header,
+    const OE_AsyncIOOperation_t *Operation);
+/* USER CODE MODULE GLOBALS END */
+
+/* Global pointer to the module. */
+static module_AsyncIO_t *AsyncIO;
+
+//~~~~~~~~~~~~~~~~~~~~~~~~ Custom init prototype ~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/**
+ * @brief Custom initializer for the module: AsyncIO.
+ * 
+ * @param Args A pointer to the init params for the module.
+ * @return OE_Error_t An error is returned if
+ * - initializing the module results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static inline OE_Error_t init_AsyncIO(void *Args);
+
+//~~~~~~~~~~~~~~~~~~~~~~ Request handler prototypes ~~~~~~~~~~~~~~~~~~~~~//
+
+/**
+ * @brief Handle the request: AsyncIO_Read.
+ * 
+ * Submit the read.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_AsyncIO_Read(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Read_s *Args);
+
+/**
+ * @brief Handle the request: AsyncIO_Write.
+ * 
+ * Submit the write.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_AsyncIO_Write(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Write_s *Args);
+
+/**
+ * @brief Handle the request: AsyncIO_Fsync.
+ * 
+ * Submit the fsync.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_AsyncIO_Fsync(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Fsync_s *Args);
+
+/**
+ * @brief Handle the request: AsyncIO_Accept.
+ * 
+ * Submit the accept.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_AsyncIO_Accept(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Accept_s *Args);
+
+/**
+ * @brief Handle the request: AsyncIO_Recv.
+ * 
+ * Submit the recv.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_AsyncIO_Recv(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Recv_s *Args);
+
+/**
+ * @brief Handle the request: AsyncIO_Send.
+ * 
+ * Submit the send.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_AsyncIO_Send(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Send_s *Args);
+
+/**
+ * @brief Handle the request: AsyncIO_Flush.
+ * 
+ * Start the submitted operations.
+ */
+static void handleRequest_AsyncIO_Flush(void);
+
+/**
+ * @brief Handle the request: AsyncIO_Complete.
+ * 
+ * Respond to the completed operations.
+ * 
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_AsyncIO_Complete(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Complete_s *Args);
+
+//~~~~~~~~~~~~~~~~~~~~~ Response handler prototypes ~~~~~~~~~~~~~~~~~~~~~//
+
+/* This module does not implement any response handlers. */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~ Module initialization ~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/* Initialize the module and register handlers. */
+OE_Error_t initModule_AsyncIO(
+    module_AsyncIO_t *pAsyncIO,
+    void *Args,
+    OE_Kernel_t *Kernel)
+{
+    OE_Error_t Error;
+    
+    /* List the requests this module will handle. */
+    OE_RequestID_t RequestIDs[] = {
+		RID_AsyncIO_Read,
+		RID_AsyncIO_Write,
+		RID_AsyncIO_Fsync,
+		RID_AsyncIO_Accept,
+		RID_AsyncIO_Recv,
+		RID_AsyncIO_Send,
+		RID_AsyncIO_Flush,
+		RID_AsyncIO_Complete,
+	};
+
+    /* List the request handlers accordingly. */
+    OE_MessageHandler_t RequestHandlers[] = {
+		(OE_MessageHandler_t)handleRequest_AsyncIO_Read,
+		(OE_MessageHandler_t)handleRequest_AsyncIO_Write,
+		(OE_MessageHandler_t)handleRequest_AsyncIO_Fsync,
+		(OE_MessageHandler_t)handleRequest_AsyncIO_Accept,
+		(OE_MessageHandler_t)handleRequest_AsyncIO_Recv,
+		(OE_MessageHandler_t)handleRequest_AsyncIO_Send,
+		(OE_MessageHandler_t)handleRequest_AsyncIO_Flush,
+		(OE_MessageHandler_t)handleRequest_AsyncIO_Complete,
+	};
+
+    /* Setup the module connections. */
+    AsyncIO = pAsyncIO;
+    AsyncIO->Kernel = Kernel;
+
+    /* Register the request handlers. */
+    Error = OE_Kernel_registerHandlers(
+        Kernel,
+        RequestIDs,
+        RequestHandlers,
+        sizeof(RequestIDs)/sizeof(OE_RequestID_t));
+
+    if (Error == OE_ERROR_NONE)
+    {
+        /* Initialize the module. */
+        Error = init_AsyncIO(Args);
+    }
+
+    /* Check for errors. */
+    if (Error != OE_ERROR_NONE)
+    {
+        /* Unregister handlers if an error occured. */
+        OE_Kernel_unregisterHandlers(
+            Kernel,
+            RequestIDs,
+            RequestHandlers,
+            sizeof(RequestIDs)/sizeof(OE_RequestID_t));
+        
+        AsyncIO->Kernel = NULL;
+        AsyncIO = NULL;  
+
+        return Error; 
+    }
+
+    /* Nice, we're done here. */
+    return OE_ERROR_NONE;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~ Custom init function ~~~~~~~~~~~~~~~~~~~~~~~~//
+
+OE_Error_t init_AsyncIO(void *Args)
+{
+    /* USER CODE MODULE INIT BEGIN */
+	OE_Error_t Error;
+
+	/* Avoid unused warning. */
+	(void)Args;
+
+	AsyncIO->FlushRequested = false;
+
+	Error = OE_AsyncIO_open(&(AsyncIO->Ring));
+
+#if OE_USE_EPOLL
+	/* The kernel handles the completions when it idles. */
+	if (Error == OE_ERROR_NONE)
+	{
+		Error = OE_Epoll_addFile(
+			AsyncIO->Kernel,
+			OE_AsyncIO_getFile(&(AsyncIO->Ring)),
+			EPOLLIN,
+			RID_AsyncIO_Complete);
+
+		if (Error != OE_ERROR_NONE)
+		{
+			OE_AsyncIO_close(&(AsyncIO->Ring));
+		}
+	}
+#endif // OE_USE_EPOLL
+
+	return Error;
+    /* USER CODE MODULE INIT END */
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~ Request handlers ~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+void handleRequest_AsyncIO_Read(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Read_s *Args)
+{
+    /* USER CODE REQUEST ASYNC IO READ BEGIN */
+	submit(Header, &(OE_AsyncIOOperation_t){
+		.Opcode = OE_ASYNC_IO_READ,
+		.File = Args->File,
+		.Buffer = Args->Buffer,
+		.Length = Args->Length,
+		.Offset = Args->Offset,
+	});
+    /* USER CODE REQUEST ASYNC IO READ END */
+}
+
+void handleRequest_AsyncIO_Write(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Write_s *Args)
+{
+    /* USER CODE REQUEST ASYNC IO WRITE BEGIN */
+	submit(Header, &(OE_AsyncIOOperation_t){
+		.Opcode = OE_ASYNC_IO_WRITE,
+		.File = Args->File,
+		.Buffer = (void *)Args->Buffer,
+		.Length = Args->Length,
+		.Offset = Args->Offset,
+	});
+    /* USER CODE REQUEST ASYNC IO WRITE END */
+}
+
+void handleRequest_AsyncIO_Fsync(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Fsync_s *Args)
+{
+    /* USER CODE REQUEST ASYNC IO FSYNC BEGIN */
+	submit(Header, &(OE_AsyncIOOperation_t){
+		.Opcode = OE_ASYNC_IO_FSYNC,
+		.File = Args->File,
+	});
+    /* USER CODE REQUEST ASYNC IO FSYNC END */
+}
+
+void handleRequest_AsyncIO_Accept(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Accept_s *Args)
+{
+    /* USER CODE REQUEST ASYNC IO ACCEPT BEGIN */
+	submit(Header, &(OE_AsyncIOOperation_t){
+		.Opcode = OE_ASYNC_IO_ACCEPT,
+		.File = Args->File,
+	});
+    /* USER CODE REQUEST ASYNC IO ACCEPT END */
+}
+
+void handleRequest_AsyncIO_Recv(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Recv_s *Args)
+{
+    /* USER CODE REQUEST ASYNC IO RECV BEGIN */
+	submit(Header, &(OE_AsyncIOOperation_t){
+		.Opcode = OE_ASYNC_IO_RECV,
+		.File = Args->File,
+		.Buffer = Args->Buffer,
+		.Length = Args->Length,
+	});
+    /* USER CODE REQUEST ASYNC IO RECV END */
+}
+
+void handleRequest_AsyncIO_Send(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Send_s *Args)
+{
+    /* USER CODE REQUEST ASYNC IO SEND BEGIN */
+	submit(Header, &(OE_AsyncIOOperation_t){
+		.Opcode = OE_ASYNC_IO_SEND,
+		.File = Args->File,
+		.Buffer = (void *)Args->Buffer,
+		.Length = Args->Length,
+	});
+    /* USER CODE REQUEST ASYNC IO SEND END */
+}
+
+void handleRequest_AsyncIO_Flush(void)
+{
+    /* USER CODE REQUEST ASYNC IO FLUSH BEGIN */
+	AsyncIO->FlushRequested = false;
+	OE_AsyncIO_flush(&(AsyncIO->Ring));
+    /* USER CODE REQUEST ASYNC IO FLUSH END */
+}
+
+void handleRequest_AsyncIO_Complete(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_AsyncIO_Complete_s *Args)
+{
+    /* USER CODE REQUEST ASYNC IO COMPLETE BEGIN */
+	OE_AsyncIO_complete(&(AsyncIO->Ring));
+    /* USER CODE REQUEST ASYNC IO COMPLETE END */
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~ Response handlers ~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/* This module does not implement any response handlers. */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~ User functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/* USER CODE MODULE FUNCTIONS BEGIN */
+void submit(
+    OE_MessageHeader_t *Header,
+    const OE_AsyncIOOperation_t *Operation)
+{
+    if (OE_AsyncIO_submit(&(AsyncIO->Ring), Header, Operation) != OE_ERROR_NONE)
+    {
+        /* Too many operations are in flight. */
+        OE_Core_sendResponse(Header, &(OE_AsyncIOResult_t){-EBUSY});
+        return;
+    }
+
+    /**
+     * The flush request is queued behind the requests that are queued already,
+     * so that their operations are started with the same system call.
+     */
+    if (!AsyncIO->FlushRequested)
+    {
+        AsyncIO->FlushRequested = req_AsyncIO_Flush() == OE_ERROR_NONE;
+
+        if (!AsyncIO->FlushRequested)
+        {
+            OE_AsyncIO_flush(&(AsyncIO->Ring));
+        }
+    }
+}
+/* USER CODE MODULE FUNCTIONS END */
+
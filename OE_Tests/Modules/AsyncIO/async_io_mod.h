@@ -0,0 +1,75 @@
+/**
+ * @note This file was autogenerated with OpenEDOS v2.2.
+ * Sections inside USER CODE BEGIN and USER CODE END will be left untouched 
+ * when rerunning the code generation. Happy coding!
+ * 
+ * @file async_io_mod.h
+ * @author Samuel Ardaya-Lieb
+ */
+
+/* USER CODE COPYRIGHT NOTICE BEGIN */
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+/* USER CODE COPYRIGHT NOTICE END */
+
+/* USER CODE FILE INTRODUCTION BEGIN */
+/* USER CODE FILE INTRODUCTION END */
+
+#ifndef ASYNC_IO_MOD_H
+#define ASYNC_IO_MOD_H
+
+#include "oe_defines.h"
+#include "async_io_intf.h"
+
+/* Includes, typedefs, globals, etc. */
+/* USER CODE MODULE GLOBALS BEGIN */
+#include "oe_async_io.h"
+/* USER CODE MODULE GLOBALS END */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~ Module definition ~~~~~~~~~~~~~~~~~~~~~~~~//
+
+typedef struct module_AsyncIO_s {
+    /* The connection to the kernel. */
+    OE_Kernel_t *Kernel;
+
+    /* Module data. */
+    /* USER CODE MODULE DATA BEGIN */
+    /* The io_uring instance. It is closed with OE_AsyncIO_close(). */
+    OE_AsyncIO_t Ring;
+
+    /* A flush request is queued. */
+    bool FlushRequested;
+    /* USER CODE MODULE DATA END */
+
+} module_AsyncIO_t;
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~ Init prototype ~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/**
+ * @brief Initialize the module AsyncIO.
+ * 
+ * This function registers the request handlers of the module
+ * and connects the module to the kernel. It then calls 
+ * the specific init function of the module.
+ * 
+ * @param AsyncIO A pointer to the module to be initialized.
+ * @param Args A pointer to the init params for the module.
+ * @param Kernel A pointer to the kernel to be connected.
+ * @return OE_Error_t An error is returned if
+ * - initializing the module results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t initModule_AsyncIO(
+    module_AsyncIO_t *AsyncIO,
+    void *Args,
+    OE_Kernel_t *Kernel);
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~ User prototypes ~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/* USER CODE MODULE PROTOTYPES BEGIN */
+/* USER CODE MODULE PROTOTYPES END */
+
+#endif // ASYNC_IO_MOD_H
\ No newline at end of file
@@ -0,0 +1,195 @@
+/**
+ * @note This file was autogenerated with OpenEDOS v2.2.
+ * Sections inside USER CODE BEGIN and USER CODE END will be left untouched 
+ * when rerunning the code generation. Happy coding!
+ * 
+ * @file bridge_mod.c
+ * @author Samuel Ardaya-Lieb
+ */
+
+/* USER CODE COPYRIGHT NOTICE BEGIN */
+/**
+ * OpenEDOS, (c) 2022-2025 Samuel Ardaya-Lieb, MIT License
+ * 
+ * https://github.com/SamuelArdayaLieb/OpenEDOS
+ */
+/* USER CODE COPYRIGHT NOTICE END */
+
+/* USER CODE FILE INTRODUCTION BEGIN */
+/* USER CODE FILE INTRODUCTION END */
+
+#include "bridge_mod.h"
+#include "oe_kernel.h"
+
+/* Includes, prototypes, globals, etc. */
+/* USER CODE MODULE GLOBALS BEGIN */
+/* USER CODE MODULE GLOBALS END */
+
+/* Global pointer to the module. */
+static module_Bridge_t *Bridge;
+
+//~~~~~~~~~~~~~~~~~~~~~~~~ Custom init prototype ~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/**
+ * @brief Custom initializer for the module: Bridge.
+ * 
+ * @param Args A pointer to the init params for the module.
+ * @return OE_Error_t An error is returned if
+ * - initializing the module results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+static inline OE_Error_t init_Bridge(void *Args);
+
+//~~~~~~~~~~~~~~~~~~~~~~ Request handler prototypes ~~~~~~~~~~~~~~~~~~~~~//
+
+/**
+ * @brief Handle the request: Dummy_Request_1.
+ * 
+ * Forward the request to the other node.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Request_1(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Request_1_s *Args);
+
+/**
+ * @brief Handle the request: Dummy_Sample.
+ * 
+ * Forward the request to the other node.
+ * 
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Sample(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Sample_s *Args);
+
+/**
+ * @brief Handle the request: Dummy_Wire.
+ * 
+ * Forward the request to the other node.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Wire(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Wire_s *Args);
+
+//~~~~~~~~~~~~~~~~~~~~~ Response handler prototypes ~~~~~~~~~~~~~~~~~~~~~//
+
+/* This module does not implement any response handlers. */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~ Module initialization ~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/* Initialize the module and register handlers. */
+OE_Error_t initModule_Bridge(
+    module_Bridge_t *pBridge,
+    void *Args,
+    OE_Kernel_t *Kernel)
+{
+    OE_Error_t Error;
+    
+    /* List the requests this module will handle. */
+    OE_RequestID_t RequestIDs[] = {
+		RID_Dummy_Request_1,
+		RID_Dummy_Sample,
+		RID_Dummy_Wire,
+	};
+
+    /* List the request handlers accordingly. */
+    OE_MessageHandler_t RequestHandlers[] = {
+		(OE_MessageHandler_t)handleRequest_Dummy_Request_1,
+		(OE_MessageHandler_t)handleRequest_Dummy_Sample,
+		(OE_MessageHandler_t)handleRequest_Dummy_Wire,
+	};
+
+    /* Setup the module connections. */
+    Bridge = pBridge;
+    Bridge->Kernel = Kernel;
+
+    /* Register the request handlers. */
+    Error = OE_Kernel_registerHandlers(
+        Kernel,
+        RequestIDs,
+        RequestHandlers,
+        sizeof(RequestIDs)/sizeof(OE_RequestID_t));
+
+    if (Error == OE_ERROR_NONE)
+    {
+        /* Initialize the module. */
+        Error = init_Bridge(Args);
+    }
+
+    /* Check for errors. */
+    if (Error != OE_ERROR_NONE)
+    {
+        /* Unregister handlers if an error occured. */
+        OE_Kernel_unregisterHandlers(
+            Kernel,
+            RequestIDs,
+            RequestHandlers,
+            sizeof(RequestIDs)/sizeof(OE_RequestID_t));
+        
+        Bridge->Kernel = NULL;
+        Bridge = NULL;  
+
+        return Error; 
+    }
+
+    /* Nice, we're done here. */
+    return OE_ERROR_NONE;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~ Custom init function ~~~~~~~~~~~~~~~~~~~~~~~~//
+
+OE_Error_t init_Bridge(void *Args)
+{
+    /* USER CODE MODULE INIT BEGIN */
+    /* The init params are the config of the link. */
+    return OE_Bridge_open(
+        &(Bridge->Link),
+        Bridge->Kernel,
+        (const OE_BridgeConfig_t *)Args);
+    /* USER CODE MODULE INIT END */
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~ Request handlers ~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+void handleRequest_Dummy_Request_1(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Request_1_s *Args)
+{
+    /* USER CODE REQUEST DUMMY REQUEST 1 BEGIN */
+    OE_Bridge_forwardRequest(&(Bridge->Link), Header, Args);
+    /* USER CODE REQUEST DUMMY REQUEST 1 END */
+}
+
+void handleRequest_Dummy_Sample(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Sample_s *Args)
+{
+    /* USER CODE REQUEST DUMMY SAMPLE BEGIN */
+    OE_Bridge_forwardRequest(&(Bridge->Link), Header, Args);
+    /* USER CODE REQUEST DUMMY SAMPLE END */
+}
+
+void handleRequest_Dummy_Wire(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Wire_s *Args)
+{
+    /* USER CODE REQUEST DUMMY WIRE BEGIN */
+    OE_Bridge_forwardRequest(&(Bridge->Link), Header, Args);
+    /* USER CODE REQUEST DUMMY WIRE END */
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~ Response handlers ~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/* This module does not implement any response handlers. */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~ User functions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+/* USER CODE MODULE FUNCTIONS BEGIN */
+/* USER CODE MODULE FUNCTIONS END */
+
@@ -20,6 +20,7 @@
 
 #include "dummy_2_intf.h"
 #include "oe_core_mod.h"
+#include "oe_wire.h"
 
 /* Includes, typedefs, globals, etc. */
 /* USER CODE INTERFACE GLOBALS BEGIN */
@@ -41,6 +42,36 @@ OE_Error_t req_Dummy_2_Req(
 		});
 }
 
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_2_Req(
+	const struct requestArgs_Dummy_2_Req_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->param, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_2_Req(
+	struct requestArgs_Dummy_2_Req_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->param = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
 /* Something else...? */
 /* USER CODE INTERFACE SOURCE BEGIN */
 /* USER CODE INTERFACE SOURCE END */
@@ -46,4 +46,31 @@ struct requestArgs_Dummy_2_Req_s {
 	uint8_t param;
 };
 
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_2_Req.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_2_Req(
+	const struct requestArgs_Dummy_2_Req_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_2_Req.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_2_Req(
+	struct requestArgs_Dummy_2_Req_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
 #endif // DUMMY_2_INTF_H
\ No newline at end of file
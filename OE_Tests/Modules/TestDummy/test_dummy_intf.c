@@ -20,6 +20,7 @@
 
 #include "test_dummy_intf.h"
 #include "oe_core_mod.h"
+#include "oe_wire.h"
 
 /* Includes, typedefs, globals, etc. */
 /* USER CODE INTERFACE GLOBALS BEGIN */
@@ -48,6 +49,65 @@ OE_Error_t req_Dummy_Request_1(
 		});
 }
 
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Request_1(
+	const struct requestArgs_Dummy_Request_1_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Dummy_Request_Param_1, 1);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Dummy_Request_Param_2, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Request_1(
+	struct requestArgs_Dummy_Request_1_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Dummy_Request_Param_1 = (uint8_t)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Dummy_Request_Param_2 = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_Dummy_Request_1_to(
+	OE_KernelID_t ReceiverID,
+	uint8_t Dummy_Request_Param_1,
+	uint8_t Dummy_Request_Param_2,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Request_1,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequestTo(
+		ReceiverID,
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Request_1_s){
+			Dummy_Request_Param_1,
+			Dummy_Request_Param_2,
+		});
+}
+
 OE_Error_t res_Dummy_Request_1(
 	uint8_t Dummy_Response_Param_1,
 	OE_MessageHeader_t* RequestHeader)
@@ -59,6 +119,36 @@ OE_Error_t res_Dummy_Request_1(
 		});
 }
 
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_Dummy_Request_1(
+	const struct responseArgs_Dummy_Request_1_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Dummy_Response_Param_1, 1);
+
+	return Length;
+}
+
+size_t decodeResponse_Dummy_Request_1(
+	struct responseArgs_Dummy_Request_1_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Dummy_Response_Param_1 = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
 OE_Error_t req_Dummy_Request_2(void)
 {
 	OE_MessageHeader_t MessageHeader = {
@@ -70,6 +160,504 @@ OE_Error_t req_Dummy_Request_2(void)
 		NULL);
 }
 
+OE_Error_t req_Dummy_Sample(
+	uint8_t Value)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Sample,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Sample_s){
+			Value,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Sample(
+	const struct requestArgs_Dummy_Sample_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Value, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Sample(
+	struct requestArgs_Dummy_Sample_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Value = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_Dummy_Latest(
+	uint8_t Value)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Latest,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Latest_s){
+			Value,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Latest(
+	const struct requestArgs_Dummy_Latest_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Value, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Latest(
+	struct requestArgs_Dummy_Latest_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Value = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_Dummy_Blocking(void)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Blocking,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		NULL);
+}
+
+OE_Error_t req_Dummy_Status(
+	uint8_t Value)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Status,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Status_s){
+			Value,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Status(
+	const struct requestArgs_Dummy_Status_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Value, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Status(
+	struct requestArgs_Dummy_Status_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Value = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_Dummy_Keyed(
+	uint8_t Key,
+	uint8_t Value)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Keyed,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Keyed_s){
+			Key,
+			Value,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Keyed(
+	const struct requestArgs_Dummy_Keyed_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Key, 1);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Value, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Keyed(
+	struct requestArgs_Dummy_Keyed_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Key = (uint8_t)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Value = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_Dummy_Sharded(
+	uint8_t Key,
+	uint8_t Value)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Sharded,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Sharded_s){
+			Key,
+			Value,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Sharded(
+	const struct requestArgs_Dummy_Sharded_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Key, 1);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Value, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Sharded(
+	struct requestArgs_Dummy_Sharded_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Key = (uint8_t)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Value = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_Dummy_Wire(
+	uint32_t Count,
+	int16_t Offset,
+	bool Enabled,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Wire,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Wire_s){
+			Count,
+			Offset,
+			Enabled,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Wire(
+	const struct requestArgs_Dummy_Wire_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeVarint(Buffer, &Length, (uint64_t)Args->Count);
+	OE_Wire_writeVarint(Buffer, &Length, OE_Wire_zigzag((int64_t)Args->Offset));
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Enabled, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Wire(
+	struct requestArgs_Dummy_Wire_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readVarint(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Count = (uint32_t)Value;
+
+	if (!OE_Wire_readVarint(Buffer, Size, &Length, 2, &Value))
+	{
+		return 0;
+	}
+	Args->Offset = (int16_t)OE_Wire_unzigzag(Value);
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Enabled = (bool)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t res_Dummy_Wire(
+	float Ratio,
+	OE_MessageHeader_t* RequestHeader)
+{
+	return OE_Core_sendResponse(
+		RequestHeader,
+		&(struct responseArgs_Dummy_Wire_s){
+			Ratio,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_Dummy_Wire(
+	const struct responseArgs_Dummy_Wire_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, OE_Wire_fromFloat(Args->Ratio), 4);
+
+	return Length;
+}
+
+size_t decodeResponse_Dummy_Wire(
+	struct responseArgs_Dummy_Wire_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Ratio = OE_Wire_toFloat(Value);
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_Dummy_Ready(
+	int File,
+	uint32_t Events)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Ready,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Ready_s){
+			File,
+			Events,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Ready(
+	const struct requestArgs_Dummy_Ready_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->File, 4);
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Events, 4);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Ready(
+	struct requestArgs_Dummy_Ready_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->File = (int)Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 4, &Value))
+	{
+		return 0;
+	}
+	Args->Events = (uint32_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t req_Dummy_Async(
+	uint8_t Value,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID)
+{
+	OE_MessageHeader_t MessageHeader = {
+		.RequestID = RID_Dummy_Async,
+		.ResponseHandler = ResponseHandler,
+		.KernelID = KernelID,
+	};
+
+	return OE_Core_sendRequest(
+		&MessageHeader,
+		&(struct requestArgs_Dummy_Async_s){
+			Value,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeRequest_Dummy_Async(
+	const struct requestArgs_Dummy_Async_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Value, 1);
+
+	return Length;
+}
+
+size_t decodeRequest_Dummy_Async(
+	struct requestArgs_Dummy_Async_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Value = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
+OE_Error_t res_Dummy_Async(
+	uint8_t Sum,
+	OE_MessageHeader_t* RequestHeader)
+{
+	return OE_Core_sendResponse(
+		RequestHeader,
+		&(struct responseArgs_Dummy_Async_s){
+			Sum,
+		});
+}
+
+#if OE_USE_WIRE_FORMAT
+size_t encodeResponse_Dummy_Async(
+	const struct responseArgs_Dummy_Async_s *Args,
+	uint8_t *Buffer)
+{
+	size_t Length = 0;
+
+	OE_Wire_writeFixed(Buffer, &Length, (uint64_t)Args->Sum, 1);
+
+	return Length;
+}
+
+size_t decodeResponse_Dummy_Async(
+	struct responseArgs_Dummy_Async_s *Args,
+	const uint8_t *Buffer,
+	size_t Size)
+{
+	size_t Length = 0;
+	uint64_t Value;
+
+	if (!OE_Wire_readFixed(Buffer, Size, &Length, 1, &Value))
+	{
+		return 0;
+	}
+	Args->Sum = (uint8_t)Value;
+
+	return Length;
+}
+#endif // OE_USE_WIRE_FORMAT
+
 /* Something else...? */
 /* USER CODE INTERFACE SOURCE BEGIN */
 /* USER CODE INTERFACE SOURCE END */
@@ -56,6 +56,58 @@ struct requestArgs_Dummy_Request_1_s {
 	uint8_t Dummy_Request_Param_2;
 };
 
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Request_1.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Request_1(
+	const struct requestArgs_Dummy_Request_1_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Request_1.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Request_1(
+	struct requestArgs_Dummy_Request_1_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: Dummy_Request_1 to one kernel.
+ * 
+ * This request is used to test the OpenEDOS core.
+ * Response: Yes
+ * 
+ * @param ReceiverID The ID of the kernel
+ * that receives this request.
+ * @param Dummy_Request_Param_1 A dummy parameter for testing.
+ * @param Dummy_Request_Param_2 A dummy parameter for testing.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Request_1_to(
+	OE_KernelID_t ReceiverID,
+	uint8_t Dummy_Request_Param_1,
+	uint8_t Dummy_Request_Param_2,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
 /**
  * @brief Send a response to the request: Dummy_Request_1.
  * 
@@ -76,6 +128,33 @@ struct responseArgs_Dummy_Request_1_s {
 	uint8_t Dummy_Response_Param_1;
 };
 
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: Dummy_Request_1.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_Dummy_Request_1(
+	const struct responseArgs_Dummy_Request_1_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: Dummy_Request_1.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_Dummy_Request_1(
+	struct responseArgs_Dummy_Request_1_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
 /**
  * @brief Send a message to request: Dummy_Request_2.
  * 
@@ -88,4 +167,497 @@ struct responseArgs_Dummy_Request_1_s {
  */
 OE_Error_t req_Dummy_Request_2(void);
 
+/**
+ * @brief Send a message to request: Dummy_Sample.
+ * 
+ * This request is used to test the overload policy 'drop oldest'.
+ * Response: No
+ * 
+ * @param Value The sample value.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Sample(
+	uint8_t Value);
+
+struct requestArgs_Dummy_Sample_s {
+	uint8_t Value;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Sample.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Sample(
+	const struct requestArgs_Dummy_Sample_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Sample.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Sample(
+	struct requestArgs_Dummy_Sample_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: Dummy_Latest.
+ * 
+ * This request is used to test the overload policy 'coalesce latest'.
+ * Response: No
+ * 
+ * @param Value The latest value.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Latest(
+	uint8_t Value);
+
+struct requestArgs_Dummy_Latest_s {
+	uint8_t Value;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Latest.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Latest(
+	const struct requestArgs_Dummy_Latest_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Latest.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Latest(
+	struct requestArgs_Dummy_Latest_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: Dummy_Blocking.
+ * 
+ * This request is used to test the overload policy 'block'.
+ * Response: No
+ * 
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Blocking(void);
+
+/**
+ * @brief Send a message to request: Dummy_Status.
+ * 
+ * This request is used to test coalescing without a key.
+ * Response: No
+ * 
+ * @param Value The status value.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Status(
+	uint8_t Value);
+
+struct requestArgs_Dummy_Status_s {
+	uint8_t Value;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Status.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Status(
+	const struct requestArgs_Dummy_Status_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Status.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Status(
+	struct requestArgs_Dummy_Status_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: Dummy_Keyed.
+ * 
+ * This request is used to test coalescing with a key.
+ * Response: No
+ * 
+ * @param Key The coalescing key.
+ * @param Value The value of the key.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Keyed(
+	uint8_t Key,
+	uint8_t Value);
+
+struct requestArgs_Dummy_Keyed_s {
+	uint8_t Key;
+	uint8_t Value;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Keyed.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Keyed(
+	const struct requestArgs_Dummy_Keyed_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Keyed.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Keyed(
+	struct requestArgs_Dummy_Keyed_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: Dummy_Sharded.
+ * 
+ * This request is used to test the sharding of requests.
+ * Response: No
+ * 
+ * @param Key The shard key.
+ * @param Value The value of the key.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Sharded(
+	uint8_t Key,
+	uint8_t Value);
+
+struct requestArgs_Dummy_Sharded_s {
+	uint8_t Key;
+	uint8_t Value;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Sharded.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Sharded(
+	const struct requestArgs_Dummy_Sharded_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Sharded.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Sharded(
+	struct requestArgs_Dummy_Sharded_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: Dummy_Wire.
+ * 
+ * This request is used to test the wire format.
+ * Response: Yes
+ * 
+ * @param Count A counter that is encoded as varint.
+ * @param Offset A signed offset that is encoded as varint.
+ * @param Enabled A flag with a fixed width.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Wire(
+	uint32_t Count,
+	int16_t Offset,
+	bool Enabled,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
+struct requestArgs_Dummy_Wire_s {
+	uint32_t Count;
+	int16_t Offset;
+	bool Enabled;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Wire.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Wire(
+	const struct requestArgs_Dummy_Wire_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Wire.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Wire(
+	struct requestArgs_Dummy_Wire_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a response to the request: Dummy_Wire.
+ * 
+ * The response is used to test the wire format.
+ * 
+ * @param Ratio A floating point value.
+ * @param RequestHeader A pointer to the header of
+ * the request message to which this response is sent.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t res_Dummy_Wire(
+	float Ratio,
+	OE_MessageHeader_t* RequestHeader);
+
+struct responseArgs_Dummy_Wire_s {
+	float Ratio;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: Dummy_Wire.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_Dummy_Wire(
+	const struct responseArgs_Dummy_Wire_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: Dummy_Wire.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_Dummy_Wire(
+	struct responseArgs_Dummy_Wire_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: Dummy_Ready.
+ * 
+ * This request is sent when a file of the kernel is ready.
+ * Response: No
+ * 
+ * @param File The file descriptor.
+ * @param Events The ready events.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Ready(
+	int File,
+	uint32_t Events);
+
+struct requestArgs_Dummy_Ready_s {
+	int File;
+	uint32_t Events;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Ready.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Ready(
+	const struct requestArgs_Dummy_Ready_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Ready.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Ready(
+	struct requestArgs_Dummy_Ready_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a message to request: Dummy_Async.
+ * 
+ * This request is used to test the coroutines.
+ * Response: Yes
+ * 
+ * @param Value The start value.
+ * @param ResponseHandler A pointer to the function
+ * that will handle the response to this request.
+ * @param KernelID The ID of the kernel to which
+ * the requesting module belongs.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t req_Dummy_Async(
+	uint8_t Value,
+	OE_MessageHandler_t ResponseHandler,
+	OE_KernelID_t KernelID);
+
+struct requestArgs_Dummy_Async_s {
+	uint8_t Value;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the request: Dummy_Async.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeRequest_Dummy_Async(
+	const struct requestArgs_Dummy_Async_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the request: Dummy_Async.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeRequest_Dummy_Async(
+	struct requestArgs_Dummy_Async_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
+/**
+ * @brief Send a response to the request: Dummy_Async.
+ * 
+ * The response is used to test the coroutines.
+ * 
+ * @param Sum The start value plus the responses to two Dummy_Request_1.
+ * @param RequestHeader A pointer to the header of
+ * the request message to which this response is sent.
+ * @return OE_Error_t An error is returned if
+ * - processing the message results in an error.
+ * Otherwise OE_ERROR_NONE is returned.
+ */
+OE_Error_t res_Dummy_Async(
+	uint8_t Sum,
+	OE_MessageHeader_t* RequestHeader);
+
+struct responseArgs_Dummy_Async_s {
+	uint8_t Sum;
+};
+
+#if OE_USE_WIRE_FORMAT
+/**
+ * @brief Encode the parameters of the response: Dummy_Async.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to a buffer of at least OE_WIRE_DATA_LIMIT bytes.
+ * @return size_t The number of written bytes is returned.
+ */
+size_t encodeResponse_Dummy_Async(
+	const struct responseArgs_Dummy_Async_s *Args,
+	uint8_t *Buffer);
+
+/**
+ * @brief Decode the parameters of the response: Dummy_Async.
+ * 
+ * @param Args Pointer to the parameters.
+ * @param Buffer Pointer to the encoded parameters.
+ * @param Size The number of bytes in the buffer.
+ * @return size_t The number of read bytes is returned.
+ * 0 is returned if the buffer is too short or a value does not fit its type.
+ */
+size_t decodeResponse_Dummy_Async(
+	struct responseArgs_Dummy_Async_s *Args,
+	const uint8_t *Buffer,
+	size_t Size);
+#endif // OE_USE_WIRE_FORMAT
+
 #endif // TEST_DUMMY_INTF_H
\ No newline at end of file
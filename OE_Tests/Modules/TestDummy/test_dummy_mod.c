@@ -20,10 +20,12 @@
 
 #include "test_dummy_mod.h"
 #include "oe_kernel.h"
+#include "oe_coroutine.h"
 
 /* Includes, prototypes, globals, etc. */
 /* USER CODE MODULE GLOBALS BEGIN */
 #include "../../oe_test.h"
+#include <unistd.h>
 /* USER CODE MODULE GLOBALS END */
 
 /* Global pointer to the module. */
@@ -73,6 +75,130 @@ static void handleRequest_Kernel_Start(
  */
 static void handleRequest_Dummy_Request_2(void);
 
+/**
+ * @brief Handle the request: Dummy_Sample.
+ * 
+ * Store the sample value.
+ * 
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Sample(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Sample_s *Args);
+
+/**
+ * @brief Handle the request: Dummy_Latest.
+ * 
+ * Store the latest value.
+ * 
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Latest(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Latest_s *Args);
+
+/**
+ * @brief Handle the request: Dummy_Blocking.
+ * 
+ * Count the handled requests.
+ */
+static void handleRequest_Dummy_Blocking(void);
+
+/**
+ * @brief Handle the request: Dummy_Status.
+ * 
+ * Store the status value.
+ * 
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Status(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Status_s *Args);
+
+/**
+ * @brief Handle the request: Dummy_Keyed.
+ * 
+ * Store the key and its value.
+ * 
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Keyed(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Keyed_s *Args);
+
+/**
+ * @brief Handle the request: Dummy_Sharded.
+ * 
+ * Store the key and its value.
+ * 
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Sharded(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Sharded_s *Args);
+
+/**
+ * @brief Handle the request: Dummy_Ready.
+ * 
+ * Read a byte from the ready file.
+ * 
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Ready(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Ready_s *Args);
+
+/**
+ * @brief Handle the request: Dummy_Async.
+ * 
+ * The handler is a coroutine (see oe_coroutine.h).
+ * 
+ * Add the responses to two Dummy_Request_1 to the value.
+ * 
+ * @param Header Pointer to the header of the request message.
+ * @param Args Pointer to the request parameters.
+ */
+static void handleRequest_Dummy_Async(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Async_s *Args);
+
+/* The state of the handler of the request: Dummy_Async. */
+static struct async_Dummy_Async_s {
+	/* The coroutine of the handler. */
+	OE_Coroutine_t Coroutine;
+
+	/* A copy of the request. */
+	OE_MessageHeader_t Header;
+	struct requestArgs_Dummy_Async_s Args;
+
+	/* Locals that are kept across awaits. */
+    /* USER CODE ASYNC DUMMY ASYNC LOCALS BEGIN */
+	uint8_t Sum;
+	uint8_t Count;
+    /* USER CODE ASYNC DUMMY ASYNC LOCALS END */
+} async_Dummy_Async;
+
+/**
+ * @brief Run the handler of the request: Dummy_Async until it awaits a response or ends.
+ */
+static void stepAsync_Dummy_Async(void);
+
+/**
+ * @brief Resume the handler of the request: Dummy_Async with a response.
+ * 
+ * Pass this function as response handler of the awaited requests.
+ * 
+ * @param Header Pointer to the header of the response message.
+ * @param Args Pointer to the response parameters.
+ */
+static void resumeAsync_Dummy_Async(
+	OE_MessageHeader_t *Header,
+	void *Args);
+
+/* Send a request with the ID RequestID and await its response. */
+#define AWAIT_Dummy_Async(RequestID, Send) \
+	OE_COROUTINE_AWAIT(&(async_Dummy_Async.Coroutine), TestDummy->Kernel->KernelID, RequestID, Send)
+
 //~~~~~~~~~~~~~~~~~~~~~ Response handler prototypes ~~~~~~~~~~~~~~~~~~~~~//
 
 /**
@@ -99,6 +225,14 @@ OE_Error_t initModule_TestDummy(
 		RID_Dummy_Request_1,
 		RID_Kernel_Start,
 		RID_Dummy_Request_2,
+		RID_Dummy_Sample,
+		RID_Dummy_Latest,
+		RID_Dummy_Blocking,
+		RID_Dummy_Status,
+		RID_Dummy_Keyed,
+		RID_Dummy_Sharded,
+		RID_Dummy_Ready,
+		RID_Dummy_Async,
 	};
 
     /* List the request handlers accordingly. */
@@ -106,12 +240,23 @@ OE_Error_t initModule_TestDummy(
 		(OE_MessageHandler_t)handleRequest_Dummy_Request_1,
 		(OE_MessageHandler_t)handleRequest_Kernel_Start,
 		(OE_MessageHandler_t)handleRequest_Dummy_Request_2,
+		(OE_MessageHandler_t)handleRequest_Dummy_Sample,
+		(OE_MessageHandler_t)handleRequest_Dummy_Latest,
+		(OE_MessageHandler_t)handleRequest_Dummy_Blocking,
+		(OE_MessageHandler_t)handleRequest_Dummy_Status,
+		(OE_MessageHandler_t)handleRequest_Dummy_Keyed,
+		(OE_MessageHandler_t)handleRequest_Dummy_Sharded,
+		(OE_MessageHandler_t)handleRequest_Dummy_Ready,
+		(OE_MessageHandler_t)handleRequest_Dummy_Async,
 	};
 
     /* Setup the module connections. */
     TestDummy = pTestDummy;
     TestDummy->Kernel = Kernel;
 
+    /* No coroutine awaits a response yet. */
+    async_Dummy_Async.Coroutine = (OE_Coroutine_t){0};
+
     /* Register the request handlers. */
     Error = OE_Kernel_registerHandlers(
         Kernel,
@@ -192,6 +337,146 @@ void handleRequest_Dummy_Request_2(void)
     /* USER CODE REQUEST DUMMY REQUEST 2 END */
 }
 
+void handleRequest_Dummy_Sample(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Sample_s *Args)
+{
+    /* USER CODE REQUEST DUMMY SAMPLE BEGIN */
+	/* Keep the last two samples in the order they were handled. */
+	TestParam_0 = TestParam_1;
+	TestParam_1 = Args->Value;
+    /* USER CODE REQUEST DUMMY SAMPLE END */
+}
+
+void handleRequest_Dummy_Latest(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Latest_s *Args)
+{
+    /* USER CODE REQUEST DUMMY LATEST BEGIN */
+	TestParam_2 = Args->Value;
+    /* USER CODE REQUEST DUMMY LATEST END */
+}
+
+void handleRequest_Dummy_Blocking(void)
+{
+    /* USER CODE REQUEST DUMMY BLOCKING BEGIN */
+	TestParam_2++;
+    /* USER CODE REQUEST DUMMY BLOCKING END */
+}
+
+void handleRequest_Dummy_Status(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Status_s *Args)
+{
+    /* USER CODE REQUEST DUMMY STATUS BEGIN */
+	TestParam_2 = Args->Value;
+    /* USER CODE REQUEST DUMMY STATUS END */
+}
+
+void handleRequest_Dummy_Keyed(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Keyed_s *Args)
+{
+    /* USER CODE REQUEST DUMMY KEYED BEGIN */
+	TestParam_0 = Args->Key;
+	TestParam_1 = Args->Value;
+    /* USER CODE REQUEST DUMMY KEYED END */
+}
+
+void handleRequest_Dummy_Sharded(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Sharded_s *Args)
+{
+    /* USER CODE REQUEST DUMMY SHARDED BEGIN */
+	TestParam_0 = Args->Key;
+	TestParam_1 = Args->Value;
+    /* USER CODE REQUEST DUMMY SHARDED END */
+}
+
+void handleRequest_Dummy_Ready(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Ready_s *Args)
+{
+    /* USER CODE REQUEST DUMMY READY BEGIN */
+	uint8_t Value = 0;
+
+	/* The file stays ready until it is read. */
+	if (read(Args->File, &Value, sizeof(Value)) == sizeof(Value))
+	{
+		TestParam_0 = (uint8_t)Args->File;
+		TestParam_1 = (uint8_t)Args->Events;
+		TestParam_2 = Value;
+	}
+    /* USER CODE REQUEST DUMMY READY END */
+}
+
+void handleRequest_Dummy_Async(
+	OE_MessageHeader_t *Header,
+	struct requestArgs_Dummy_Async_s *Args)
+{
+	/* The handler still awaits a response to an earlier request. */
+	if (OE_COROUTINE_IS_RUNNING(&(async_Dummy_Async.Coroutine)))
+	{
+        /* USER CODE ASYNC DUMMY ASYNC BUSY BEGIN */
+		/* Answer at once, so that the sender does not wait. */
+		res_Dummy_Async(0, Header);
+        /* USER CODE ASYNC DUMMY ASYNC BUSY END */
+		return;
+	}
+
+	async_Dummy_Async.Header = *Header;
+	async_Dummy_Async.Args = *Args;
+	stepAsync_Dummy_Async();
+}
+
+void resumeAsync_Dummy_Async(
+	OE_MessageHeader_t *Header,
+	void *Args)
+{
+	if (OE_Coroutine_resume(&(async_Dummy_Async.Coroutine), Header, Args))
+	{
+		stepAsync_Dummy_Async();
+	}
+}
+
+void stepAsync_Dummy_Async(void)
+{
+	OE_MessageHeader_t *Header = &(async_Dummy_Async.Header);
+	struct requestArgs_Dummy_Async_s *Args = &(async_Dummy_Async.Args);
+
+	/* Avoid unused warning. */
+	(void)Header;
+	(void)Args;
+
+	OE_COROUTINE_BEGIN(&(async_Dummy_Async.Coroutine));
+    /* USER CODE REQUEST DUMMY ASYNC BEGIN */
+	async_Dummy_Async.Sum = Args->Value;
+
+	for (async_Dummy_Async.Count = 0; async_Dummy_Async.Count < 2; async_Dummy_Async.Count++)
+	{
+		AWAIT_Dummy_Async(
+			RID_Dummy_Request_1,
+			req_Dummy_Request_1(
+				TEST_VAL_1,
+				TEST_VAL_2,
+				(OE_MessageHandler_t)resumeAsync_Dummy_Async,
+				TestDummy->Kernel->KernelID));
+
+		if (async_Dummy_Async.Coroutine.Error != OE_ERROR_NONE)
+		{
+			res_Dummy_Async(0, Header);
+			OE_COROUTINE_EXIT(&(async_Dummy_Async.Coroutine));
+		}
+
+		async_Dummy_Async.Sum += ((struct responseArgs_Dummy_Request_1_s *)
+			async_Dummy_Async.Coroutine.Response)->Dummy_Response_Param_1;
+	}
+
+	res_Dummy_Async(async_Dummy_Async.Sum, Header);
+    /* USER CODE REQUEST DUMMY ASYNC END */
+	OE_COROUTINE_END(&(async_Dummy_Async.Coroutine));
+}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~ Response handlers ~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 void handleResponse_Dummy_Request_1(
@@ -241,6 +526,16 @@ OE_Error_t sendRequest_1(void)
 		TestDummy->Kernel->KernelID);
 }
 
+OE_Error_t sendRequest_1_to(OE_KernelID_t ReceiverID)
+{
+	return req_Dummy_Request_1_to(
+		ReceiverID,
+		TEST_VAL_1,
+		TEST_VAL_2,
+		handleResponse_Dummy_Request_1,
+		TestDummy->Kernel->KernelID);
+}
+
 OE_Error_t subscribeRequest_2(void)
 {
 	OE_RequestID_t RequestID = RID_Dummy_Request_2;
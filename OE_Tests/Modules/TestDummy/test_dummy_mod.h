@@ -68,6 +68,7 @@ OE_Error_t initModule_TestDummy(
 OE_Error_t subscribeRequest_1(void);
 void unsubscribeRequest_1(void);
 OE_Error_t sendRequest_1(void);
+OE_Error_t sendRequest_1_to(OE_KernelID_t ReceiverID);
 
 OE_Error_t subscribeRequest_2(void);
 void unsubscribeRequest_2(void);
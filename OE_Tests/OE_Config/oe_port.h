@@ -18,12 +18,31 @@
 #include <pthread.h>
 #include "oe_config.h"
 
-/* Mutexes and conds for thread idling, declared in main.c. */
-extern pthread_mutex_t condition_mutexes[OE_NUMBER_OF_KERNELS];
-extern pthread_cond_t condition_conds[OE_NUMBER_OF_KERNELS];
+/* Mutexes and conds for thread idling, declared in multi_kernel.c. */
+extern pthread_mutex_t *condition_mutexes;
+extern pthread_cond_t *condition_conds;
 
 /* Mutex for critical sections. */
-extern pthread_mutex_t critical_section_mutex;
+extern pthread_mutex_t *critical_section_mutex;
+
+#if OE_USE_SHARED_CORE
+/* The process-shared sync objects are placed in the shared core. */
+typedef struct PortSharedData_s
+{
+    pthread_mutex_t CriticalSectionMutex;
+    pthread_mutex_t ConditionMutexes[OE_NUMBER_OF_KERNELS];
+    pthread_cond_t ConditionConds[OE_NUMBER_OF_KERNELS];
+} PortSharedData_t;
+
+void portSharedInit(PortSharedData_t *PortData);
+void portSharedAttach(PortSharedData_t *PortData);
+void portSharedDetach(PortSharedData_t *PortData);
+
+#define OE_PORT_SHARED_DATA_T PortSharedData_t
+#define OE_PORT_SHARED_INIT(PortData) portSharedInit(PortData)
+#define OE_PORT_SHARED_ATTACH(PortData) portSharedAttach(PortData)
+#define OE_PORT_SHARED_DETACH(PortData) portSharedDetach(PortData)
+#endif // OE_USE_SHARED_CORE
 
 // extern atomic_bool kernel_running[OE_NUMBER_OF_KERNELS];
 
@@ -45,7 +64,11 @@ static inline void __IDLE(uint8_t KernelID)
  * @param KernelID The ID of the kernel that calls this macro.
  * Only needed when there are more than one kernels.
  */
+#if OE_USE_EPOLL
+#define OE_IDLE(KernelID) OE_Epoll_idle(KernelID)
+#else
 #define OE_IDLE(KernelID) __IDLE(KernelID)
+#endif // OE_USE_EPOLL
 
 static inline void __RESUME(uint8_t KernelID)
 {
@@ -61,12 +84,38 @@ static inline void __RESUME(uint8_t KernelID)
  * @param KernelID The ID of the kernel that will leave the idle state.
  * Only needed when there are more than one kernels.
  */
+#if OE_USE_EPOLL
+#define OE_RESUME(KernelID) OE_Epoll_resume(KernelID)
+#else
 #define OE_RESUME(KernelID) __RESUME(KernelID)
+#endif // OE_USE_EPOLL
 
 /* Enter a section of the programm that must not be interrupted. */
-#define OE_ENTER_CRITICAL() pthread_mutex_lock(&critical_section_mutex)
+#define OE_ENTER_CRITICAL() pthread_mutex_lock(critical_section_mutex)
 
 /* Exit a section of the programm that must not be interrupted. */
-#define OE_EXIT_CRITICAL() pthread_mutex_unlock(&critical_section_mutex)
+#define OE_EXIT_CRITICAL() pthread_mutex_unlock(critical_section_mutex)
+
+/* The tests advance the ticks manually, declared in main.c. */
+extern uint32_t TestTicks;
+
+/* Return the current value of a free running tick counter. */
+#define OE_GET_TICKS() TestTicks
+
+/* A waiting sender lets one tick pass each time it yields. */
+#define OE_YIELD() (TestTicks++)
+
+/**
+ * The kernel a thread runs, set by the kernel threads of the tests. Tests that run a
+ * kernel with OE_Kernel_runOnce() set it as well. Declared in main.c.
+ */
+#ifdef __cplusplus
+extern thread_local uint8_t TestCurrentKernel;
+#else
+extern _Thread_local uint8_t TestCurrentKernel;
+#endif
+
+/* Return the ID of the kernel the caller runs in. */
+#define OE_CURRENT_KERNEL() TestCurrentKernel
 
 #endif // OE_PORT_H
\ No newline at end of file
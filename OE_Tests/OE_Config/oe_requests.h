@@ -50,9 +50,79 @@ typedef enum OE_RequestID_e
 	/* TestDummy */
 	RID_Dummy_Request_1,
 	RID_Dummy_Request_2,
+	RID_Dummy_Sample,
+	RID_Dummy_Latest,
+	RID_Dummy_Blocking,
+	RID_Dummy_Status,
+	RID_Dummy_Keyed,
+	RID_Dummy_Sharded,
+	RID_Dummy_Wire,
+	RID_Dummy_Ready,
+	RID_Dummy_Async,
+
+	/* AsyncIO */
+	RID_AsyncIO_Read,
+	RID_AsyncIO_Write,
+	RID_AsyncIO_Fsync,
+	RID_AsyncIO_Accept,
+	RID_AsyncIO_Recv,
+	RID_AsyncIO_Send,
+	RID_AsyncIO_Flush,
+	RID_AsyncIO_Complete,
 
 	/* The LAST element in this enum MUST be "OE_NUMBER_OF_REQESTS"! */
     OE_NUMBER_OF_REQUESTS
 } OE_RequestID_t;
 
+/**
+ * The request attributes set the request limit, the rate limit, the overload policy, the
+ * coalescing and the sharding of single requests. Requests that are not listed use
+ * OE_REQUEST_LIMIT, are not rate limited, are rejected on overload and are never
+ * coalesced or sharded.
+ */
+#define OE_REQUEST_ATTRIBUTES { \
+	[RID_Dummy_Request_2] = {.RequestLimit = 5, .RateLimit = 3, .RatePeriod = 10, .RateBurst = 0, .OverloadPolicy = OE_OVERLOAD_REJECT, .BlockTimeout = 0, .Coalesce = false, .CoalesceKeySize = 0, .ShardKeySize = 0}, \
+	[RID_Dummy_Sample] = {.RequestLimit = 2, .RateLimit = 0, .RatePeriod = 0, .RateBurst = 0, .OverloadPolicy = OE_OVERLOAD_DROP_OLDEST, .BlockTimeout = 0, .Coalesce = false, .CoalesceKeySize = 0, .ShardKeySize = 0}, \
+	[RID_Dummy_Latest] = {.RequestLimit = 2, .RateLimit = 0, .RatePeriod = 0, .RateBurst = 0, .OverloadPolicy = OE_OVERLOAD_COALESCE_LATEST, .BlockTimeout = 0, .Coalesce = false, .CoalesceKeySize = 0, .ShardKeySize = 0}, \
+	[RID_Dummy_Blocking] = {.RequestLimit = 1, .RateLimit = 0, .RatePeriod = 0, .RateBurst = 0, .OverloadPolicy = OE_OVERLOAD_BLOCK, .BlockTimeout = 5, .Coalesce = false, .CoalesceKeySize = 0, .ShardKeySize = 0}, \
+	[RID_Dummy_Status] = {.RequestLimit = 0, .RateLimit = 0, .RatePeriod = 0, .RateBurst = 0, .OverloadPolicy = OE_OVERLOAD_REJECT, .BlockTimeout = 0, .Coalesce = true, .CoalesceKeySize = 0, .ShardKeySize = 0}, \
+	[RID_Dummy_Keyed] = {.RequestLimit = 0, .RateLimit = 0, .RatePeriod = 0, .RateBurst = 0, .OverloadPolicy = OE_OVERLOAD_REJECT, .BlockTimeout = 0, .Coalesce = true, .CoalesceKeySize = sizeof(uint8_t), .ShardKeySize = 0}, \
+	[RID_Dummy_Sharded] = {.RequestLimit = 0, .RateLimit = 0, .RatePeriod = 0, .RateBurst = 0, .OverloadPolicy = OE_OVERLOAD_REJECT, .BlockTimeout = 0, .Coalesce = false, .CoalesceKeySize = 0, .ShardKeySize = sizeof(uint8_t)}, \
+}
+
+/**
+ * The request codecs list the generated functions that encode the request and response
+ * parameters in the wire format (see oe_wire.h). The functions are declared in the
+ * interface headers, so the list can only be used where all of them are included.
+ */
+#define OE_REQUEST_CODECS { \
+	[RID_Dummy_2_Req] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_2_Req, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_2_Req}, \
+	[RID_Dummy_0_Req] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_0_Req, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_0_Req, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_Dummy_0_Req, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_Dummy_0_Req}, \
+	[RID_Dummy_Request_1] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Request_1, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Request_1, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_Dummy_Request_1, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_Dummy_Request_1}, \
+	[RID_Dummy_Sample] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Sample, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Sample}, \
+	[RID_Dummy_Latest] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Latest, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Latest}, \
+	[RID_Dummy_Status] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Status, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Status}, \
+	[RID_Dummy_Keyed] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Keyed, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Keyed}, \
+	[RID_Dummy_Sharded] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Sharded, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Sharded}, \
+	[RID_Dummy_Wire] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Wire, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Wire, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_Dummy_Wire, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_Dummy_Wire}, \
+	[RID_Dummy_Ready] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Ready, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Ready}, \
+	[RID_Dummy_Async] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_Dummy_Async, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_Dummy_Async, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_Dummy_Async, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_Dummy_Async}, \
+	[RID_AsyncIO_Read] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_AsyncIO_Read, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_AsyncIO_Read, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_AsyncIO_Read, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_AsyncIO_Read}, \
+	[RID_AsyncIO_Write] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_AsyncIO_Write, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_AsyncIO_Write, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_AsyncIO_Write, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_AsyncIO_Write}, \
+	[RID_AsyncIO_Fsync] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_AsyncIO_Fsync, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_AsyncIO_Fsync, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_AsyncIO_Fsync, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_AsyncIO_Fsync}, \
+	[RID_AsyncIO_Accept] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_AsyncIO_Accept, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_AsyncIO_Accept, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_AsyncIO_Accept, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_AsyncIO_Accept}, \
+	[RID_AsyncIO_Recv] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_AsyncIO_Recv, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_AsyncIO_Recv, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_AsyncIO_Recv, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_AsyncIO_Recv}, \
+	[RID_AsyncIO_Send] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_AsyncIO_Send, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_AsyncIO_Send, .EncodeResponse = (OE_WireEncoder_t)encodeResponse_AsyncIO_Send, .DecodeResponse = (OE_WireDecoder_t)decodeResponse_AsyncIO_Send}, \
+	[RID_AsyncIO_Complete] = {.EncodeRequest = (OE_WireEncoder_t)encodeRequest_AsyncIO_Complete, .DecodeRequest = (OE_WireDecoder_t)decodeRequest_AsyncIO_Complete}, \
+}
+
+/**
+ * The persistent requests are appended to the journal and sent again on startup
+ * (see oe_journal.h).
+ */
+#define OE_PERSISTENT_REQUESTS { \
+	RID_Dummy_Status, \
+	RID_Dummy_Keyed, \
+}
+
 #endif // OE_REQUESTS_H
\ No newline at end of file
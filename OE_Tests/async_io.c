@@ -0,0 +1,227 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+#include "oe_epoll.h"
+
+/* Modules */
+#include "async_io_intf.h"
+#include "async_io_mod.h"
+
+#if OE_USE_ASYNC_IO && OE_USE_EPOLL
+#include <errno.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#define NUMBER_OF_OPERATIONS (RID_AsyncIO_Send - RID_AsyncIO_Read + 1)
+
+static OE_Core_t Core;
+static module_AsyncIO_t AsyncIO;
+
+/* The results of the responses by request. */
+static int32_t Results[NUMBER_OF_OPERATIONS];
+static size_t NumberOfResponses;
+
+static void handleResponse(
+    OE_MessageHeader_t *Header,
+    OE_AsyncIOResult_t *Args)
+{
+    Results[Header->RequestID - RID_AsyncIO_Read] = Args->Result;
+    NumberOfResponses++;
+}
+
+static void init(CuTest *tc, OE_Kernel_t *Kernel)
+{
+    memset(Results, 0, sizeof(Results));
+    NumberOfResponses = 0;
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(Kernel));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, initModule_AsyncIO(&AsyncIO, NULL, Kernel));
+}
+
+/* Run the kernel until the responses are handled. It idles while the I/O is in flight. */
+static void run(OE_Kernel_t *Kernel, size_t NumberOfExpectedResponses)
+{
+    while (NumberOfResponses < NumberOfExpectedResponses)
+    {
+        if (!OE_Kernel_runOnce(Kernel))
+        {
+            OE_Epoll_idle(Kernel->KernelID);
+        }
+    }
+}
+
+static void test_asyncIO_file(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    const uint8_t Data[] = {TEST_VAL_1, TEST_VAL_2, TEST_VAL_3};
+    uint8_t Buffer[sizeof(Data)] = {0};
+    int Pipe[2];
+
+    init(tc, &Kernel);
+    CuAssertIntEquals(tc, 0, pipe(Pipe));
+
+    req_AsyncIO_Write(Pipe[1], sizeof(Data), Data, -1,
+        (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+    req_AsyncIO_Read(Pipe[0], sizeof(Buffer), Buffer, -1,
+        (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+
+    /* Both operations are submitted before the flush request is handled. */
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 2, AsyncIO.Ring.Pending);
+    CuAssertTrue(tc, AsyncIO.FlushRequested);
+
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 0, AsyncIO.Ring.Pending);
+
+    run(&Kernel, 2);
+    CuAssertIntEquals(tc, sizeof(Data), Results[RID_AsyncIO_Write - RID_AsyncIO_Read]);
+    CuAssertIntEquals(tc, sizeof(Data), Results[RID_AsyncIO_Read - RID_AsyncIO_Read]);
+    CuAssertTrue(tc, memcmp(Data, Buffer, sizeof(Data)) == 0);
+
+    /* A pipe cannot be synced. */
+    req_AsyncIO_Fsync(Pipe[0], (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+    run(&Kernel, 3);
+    CuAssertIntEquals(tc, -EINVAL, Results[RID_AsyncIO_Fsync - RID_AsyncIO_Read]);
+
+    OE_AsyncIO_close(&(AsyncIO.Ring));
+    close(Pipe[0]);
+    close(Pipe[1]);
+}
+
+static void test_asyncIO_socket(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    struct sockaddr_in Address = {
+        .sin_family = AF_INET,
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    socklen_t AddressLength = sizeof(Address);
+    const uint8_t Data[] = {TEST_VAL_3, TEST_VAL_1};
+    uint8_t Buffer[sizeof(Data)] = {0};
+    int Listener;
+    int Client;
+
+    init(tc, &Kernel);
+
+    Listener = socket(AF_INET, SOCK_STREAM, 0);
+    CuAssertTrue(tc, Listener >= 0);
+    CuAssertIntEquals(tc, 0, bind(Listener, (struct sockaddr *)&Address, sizeof(Address)));
+    CuAssertIntEquals(tc, 0, listen(Listener, 1));
+    CuAssertIntEquals(tc, 0, getsockname(Listener, (struct sockaddr *)&Address, &AddressLength));
+
+    req_AsyncIO_Accept(Listener, (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+
+    Client = socket(AF_INET, SOCK_STREAM, 0);
+    CuAssertIntEquals(tc, 0, connect(Client, (struct sockaddr *)&Address, sizeof(Address)));
+
+    run(&Kernel, 1);
+    CuAssertTrue(tc, Results[RID_AsyncIO_Accept - RID_AsyncIO_Read] >= 0);
+
+    /* Send from the client, receive on the accepted connection. */
+    req_AsyncIO_Send(Client, sizeof(Data), Data,
+        (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+    req_AsyncIO_Recv(Results[RID_AsyncIO_Accept - RID_AsyncIO_Read], sizeof(Buffer), Buffer,
+        (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+
+    run(&Kernel, 3);
+    CuAssertIntEquals(tc, sizeof(Data), Results[RID_AsyncIO_Send - RID_AsyncIO_Read]);
+    CuAssertIntEquals(tc, sizeof(Data), Results[RID_AsyncIO_Recv - RID_AsyncIO_Read]);
+    CuAssertTrue(tc, memcmp(Data, Buffer, sizeof(Data)) == 0);
+
+    OE_AsyncIO_close(&(AsyncIO.Ring));
+    close(Results[RID_AsyncIO_Accept - RID_AsyncIO_Read]);
+    close(Client);
+    close(Listener);
+}
+
+static void test_asyncIO_limit(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    uint8_t Buffer;
+    int Pipe[2];
+
+    init(tc, &Kernel);
+    CuAssertIntEquals(tc, 0, pipe(Pipe));
+
+    /* The reads wait for data, so they stay in flight. */
+    for (size_t Index = 0; Index <= OE_ASYNC_IO_QUEUE_LENGTH; Index++)
+    {
+        CuAssertIntEquals(tc, OE_ERROR_NONE, req_AsyncIO_Read(Pipe[0], 1, &Buffer, -1,
+            (OE_MessageHandler_t)handleResponse, Kernel.KernelID));
+    }
+
+    /* One read too many is answered at once. */
+    run(&Kernel, 1);
+    CuAssertIntEquals(tc, -EBUSY, Results[RID_AsyncIO_Read - RID_AsyncIO_Read]);
+    CuAssertIntEquals(tc, 0, AsyncIO.Ring.NumberOfFreeSlots);
+
+    /* Closing the instance cancels the reads. */
+    OE_AsyncIO_close(&(AsyncIO.Ring));
+    close(Pipe[0]);
+    close(Pipe[1]);
+}
+
+static void test_asyncIO_retry(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    OE_MessageQueue_t *Queue;
+    const uint8_t Data = TEST_VAL_1;
+    int Pipe[2];
+
+    init(tc, &Kernel);
+    Queue = &Core.MessageQueues[Kernel.KernelID];
+    CuAssertIntEquals(tc, 0, pipe(Pipe));
+
+    req_AsyncIO_Write(Pipe[1], sizeof(Data), &Data, -1,
+        (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+
+    /* Submit and flush the write. */
+    while (OE_Kernel_runOnce(&Kernel))
+    {
+    }
+    CuAssertIntEquals(tc, 0, AsyncIO.Ring.Pending);
+
+    /* Wait for the completion while the kernel has no room for the response. */
+    while (OE_MessageQueue_allocateMessage(Queue) != NULL)
+    {
+    }
+
+    while (*(AsyncIO.Ring.CompletionHead) == __atomic_load_n(AsyncIO.Ring.CompletionTail, __ATOMIC_ACQUIRE))
+    {
+        usleep(100);
+    }
+
+    /* The completion and its slot are kept. */
+    CuAssertIntEquals(tc, 0, OE_AsyncIO_complete(&(AsyncIO.Ring)));
+    CuAssertIntEquals(tc, OE_ASYNC_IO_QUEUE_LENGTH - 1, AsyncIO.Ring.NumberOfFreeSlots);
+
+    /* The response is sent once there is room. */
+    OE_MessageQueue_staticInit(Queue);
+    run(&Kernel, 1);
+    CuAssertIntEquals(tc, sizeof(Data), Results[RID_AsyncIO_Write - RID_AsyncIO_Read]);
+    CuAssertIntEquals(tc, OE_ASYNC_IO_QUEUE_LENGTH, AsyncIO.Ring.NumberOfFreeSlots);
+
+    OE_AsyncIO_close(&(AsyncIO.Ring));
+    close(Pipe[0]);
+    close(Pipe[1]);
+}
+#endif // OE_USE_ASYNC_IO && OE_USE_EPOLL
+
+void add_asyncIO(CuSuite *suite)
+{
+#if OE_USE_ASYNC_IO && OE_USE_EPOLL
+    SUITE_ADD_TEST(suite, test_asyncIO_file);
+    SUITE_ADD_TEST(suite, test_asyncIO_socket);
+    SUITE_ADD_TEST(suite, test_asyncIO_limit);
+    SUITE_ADD_TEST(suite, test_asyncIO_retry);
+#else
+    (void)suite;
+#endif // OE_USE_ASYNC_IO && OE_USE_EPOLL
+}
@@ -0,0 +1,374 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+
+/* Modules */
+#include "oe_all_modules.h"
+#include "test_dummy_intf.h"
+#include "bridge_mod.h"
+
+/* Processes */
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#if OE_USE_BRIDGE
+/* Both nodes run on this host. */
+#define LOCAL_HOST "127.0.0.1"
+#define PORT_NODE_A 47311
+#define PORT_NODE_B 47312
+#define NODE_TIMEOUT_S 10
+
+static OE_Core_t Core;
+static OE_Kernel_t Kernel;
+static module_Bridge_t BridgeModule;
+
+static volatile size_t RequestCount;
+static volatile size_t SampleCount;
+static volatile size_t WireCount;
+static volatile size_t ResponseCount;
+static volatile size_t ResponseSum;
+static volatile float ResponseRatio;
+
+#if OE_USE_WIRE_FORMAT
+static const OE_WireCodec_t Codecs[OE_NUMBER_OF_REQUESTS] = OE_REQUEST_CODECS;
+#endif
+
+static void handleRequest_Dummy_Request_1(
+    OE_MessageHeader_t *Header,
+    struct requestArgs_Dummy_Request_1_s *Args)
+{
+    RequestCount++;
+
+    res_Dummy_Request_1(
+        Args->Dummy_Request_Param_1 + Args->Dummy_Request_Param_2,
+        Header);
+}
+
+static void handleRequest_Dummy_Sample(
+    OE_MessageHeader_t *Header,
+    struct requestArgs_Dummy_Sample_s *Args)
+{
+    (void)Header;
+
+    if (Args->Value == TEST_VAL_3)
+    {
+        SampleCount++;
+    }
+}
+
+static void handleRequest_Dummy_Wire(
+    OE_MessageHeader_t *Header,
+    struct requestArgs_Dummy_Wire_s *Args)
+{
+    if (Args->Count == 70000 && Args->Offset == -300 && Args->Enabled)
+    {
+        WireCount++;
+    }
+
+    res_Dummy_Wire(0.5f, Header);
+}
+
+static void handleResponse_Dummy_Wire(
+    OE_MessageHeader_t *Header,
+    struct responseArgs_Dummy_Wire_s *Args)
+{
+    (void)Header;
+
+    ResponseCount++;
+    ResponseRatio = Args->Ratio;
+}
+
+static void handleResponse_Dummy_Request_1(
+    OE_MessageHeader_t *Header,
+    struct responseArgs_Dummy_Request_1_s *Args)
+{
+    (void)Header;
+
+    ResponseCount++;
+    ResponseSum += Args->Dummy_Response_Param_1;
+}
+
+static OE_BridgeConfig_t nodeConfig(
+    OE_BridgeTransport_t Transport,
+    uint16_t LocalPort,
+    uint16_t RemotePort,
+    bool Listen)
+{
+    return (OE_BridgeConfig_t){
+        .Transport = Transport,
+        .LocalAddress = LOCAL_HOST,
+        .LocalPort = LocalPort,
+        .RemoteAddress = LOCAL_HOST,
+        .RemotePort = RemotePort,
+        .Listen = Listen,
+        .BatchSize = 5,
+        .FlushTicks = 0,
+#if OE_USE_WIRE_FORMAT
+        .Codecs = Codecs,
+#endif
+    };
+}
+
+/**
+ * Node B handles the requests of node A and responds over its own bridge.
+ * It runs in a child process with its own core.
+ */
+static int runNodeB(OE_BridgeTransport_t Transport, int ReadyFile)
+{
+    OE_BridgeConfig_t Config = nodeConfig(Transport, PORT_NODE_B, PORT_NODE_A, true);
+    OE_RequestID_t RequestIDs[3] = {RID_Dummy_Request_1, RID_Dummy_Sample, RID_Dummy_Wire};
+    OE_MessageHandler_t RequestHandlers[3] = {
+        (OE_MessageHandler_t)handleRequest_Dummy_Request_1,
+        (OE_MessageHandler_t)handleRequest_Dummy_Sample,
+        (OE_MessageHandler_t)handleRequest_Dummy_Wire};
+    time_t Start = time(NULL);
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    if (OE_Kernel_staticInit(&Kernel) != OE_ERROR_NONE)
+    {
+        return 1;
+    }
+
+    /* The bridge module also subscribes the requests, but must not send them back. */
+    if (OE_Kernel_registerHandlers(&Kernel, RequestIDs, RequestHandlers, 3) != OE_ERROR_NONE ||
+        initModule_Bridge(&BridgeModule, &Config, &Kernel) != OE_ERROR_NONE)
+    {
+        return 2;
+    }
+
+    RequestCount = 0;
+    SampleCount = 0;
+    WireCount = 0;
+
+    if (write(ReadyFile, "B", 1) != 1)
+    {
+        return 3;
+    }
+
+    while (BridgeModule.Link.MessagesSent < 3)
+    {
+        if (time(NULL) - Start > NODE_TIMEOUT_S)
+        {
+            return 4;
+        }
+
+        OE_Bridge_poll(&(BridgeModule.Link));
+        while (OE_Kernel_runOnce(&Kernel));
+    }
+
+    if (RequestCount != 2 || SampleCount != 1 || WireCount != 1)
+    {
+        return 5;
+    }
+
+    /* Only the three responses were sent in one frame. */
+    if (BridgeModule.Link.MessagesSent != 3 || BridgeModule.Link.FramesSent != 1 ||
+        BridgeModule.Link.TxCount != 0 || BridgeModule.Link.MessagesDropped != 0)
+    {
+        return 6;
+    }
+
+    OE_Bridge_close(&(BridgeModule.Link));
+
+    return 0;
+}
+
+static void runNodeA(CuTest *tc, OE_BridgeTransport_t Transport)
+{
+    OE_BridgeConfig_t Config = nodeConfig(Transport, PORT_NODE_A, PORT_NODE_B, false);
+    OE_Error_t Error;
+    int ReadyFiles[2];
+    char Ready;
+    pid_t Child;
+    int Status;
+    time_t Start;
+
+    CuAssertIntEquals(tc, 0, pipe(ReadyFiles));
+
+    Child = fork();
+    CuAssertTrue(tc, Child >= 0);
+
+    if (Child == 0)
+    {
+        close(ReadyFiles[0]);
+        _exit(runNodeB(Transport, ReadyFiles[1]));
+    }
+
+    close(ReadyFiles[1]);
+
+    /* Wait until node B has opened its bridge. */
+    CuAssertIntEquals(tc, 1, read(ReadyFiles[0], &Ready, 1));
+    close(ReadyFiles[0]);
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    Error = OE_Kernel_staticInit(&Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = initModule_Bridge(&BridgeModule, &Config, &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    ResponseCount = 0;
+    ResponseSum = 0;
+    ResponseRatio = 0.0f;
+
+    Error = req_Dummy_Request_1(
+        TEST_VAL_2,
+        TEST_VAL_3,
+        (OE_MessageHandler_t)handleResponse_Dummy_Request_1,
+        Kernel.KernelID);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = req_Dummy_Request_1(
+        TEST_VAL_3,
+        TEST_VAL_3,
+        (OE_MessageHandler_t)handleResponse_Dummy_Request_1,
+        Kernel.KernelID);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = req_Dummy_Sample(TEST_VAL_3);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = req_Dummy_Wire(
+        70000,
+        -300,
+        true,
+        (OE_MessageHandler_t)handleResponse_Dummy_Wire,
+        Kernel.KernelID);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* The bridge module batches the requests until the next poll. */
+    while (OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 4, BridgeModule.Link.TxCount);
+    CuAssertIntEquals(tc, 0, BridgeModule.Link.FramesSent);
+
+    Start = time(NULL);
+    while (ResponseCount < 3 && time(NULL) - Start <= NODE_TIMEOUT_S)
+    {
+        OE_Bridge_poll(&(BridgeModule.Link));
+        while (OE_Kernel_runOnce(&Kernel));
+    }
+
+    /* The responses reached the original response handlers. */
+    CuAssertIntEquals(tc, 3, ResponseCount);
+    CuAssertIntEquals(tc, (TEST_VAL_2 + TEST_VAL_3) + (TEST_VAL_3 + TEST_VAL_3), ResponseSum);
+    CuAssertTrue(tc, ResponseRatio == 0.5f);
+
+    CuAssertIntEquals(tc, 1, BridgeModule.Link.FramesSent);
+    CuAssertIntEquals(tc, 4, BridgeModule.Link.MessagesSent);
+    CuAssertIntEquals(tc, 1, BridgeModule.Link.FramesReceived);
+    CuAssertIntEquals(tc, 3, BridgeModule.Link.MessagesReceived);
+    CuAssertIntEquals(tc, 0, BridgeModule.Link.MessagesDropped);
+
+    CuAssertIntEquals(tc, Child, waitpid(Child, &Status, 0));
+    CuAssertTrue(tc, WIFEXITED(Status));
+    CuAssertIntEquals(tc, 0, WEXITSTATUS(Status));
+
+    OE_Bridge_close(&(BridgeModule.Link));
+}
+
+static void test_bridge_udp(CuTest *tc)
+{
+    runNodeA(tc, OE_BRIDGE_UDP);
+}
+
+static void test_bridge_tcp(CuTest *tc)
+{
+    runNodeA(tc, OE_BRIDGE_TCP);
+}
+
+static void test_bridge_config(CuTest *tc)
+{
+    OE_BridgeConfig_t Config = nodeConfig(OE_BRIDGE_UDP, 0, PORT_NODE_B, false);
+    OE_Bridge_t Bridges[OE_NUMBER_OF_BRIDGES + 1];
+    OE_Error_t Error;
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    Error = OE_Kernel_staticInit(&Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Config.BatchSize = OE_BRIDGE_BATCH_LIMIT + 1;
+    Error = OE_Bridge_open(&Bridges[0], &Kernel, &Config);
+    CuAssertIntEquals(tc, OE_ERROR_PARAMETER_INVALID, Error);
+
+    Config.BatchSize = 1;
+    Config.RemoteAddress = "no address";
+    Error = OE_Bridge_open(&Bridges[0], &Kernel, &Config);
+    CuAssertIntEquals(tc, OE_ERROR_PARAMETER_INVALID, Error);
+
+    /* Not more than OE_NUMBER_OF_BRIDGES bridges can be open. */
+    Config.RemoteAddress = LOCAL_HOST;
+    for (size_t Index = 0; Index < OE_NUMBER_OF_BRIDGES; Index++)
+    {
+        Error = OE_Bridge_open(&Bridges[Index], &Kernel, &Config);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+
+    Error = OE_Bridge_open(&Bridges[OE_NUMBER_OF_BRIDGES], &Kernel, &Config);
+    CuAssertIntEquals(tc, OE_ERROR_HANDLER_LIMIT_REACHED, Error);
+
+    for (size_t Index = 0; Index < OE_NUMBER_OF_BRIDGES; Index++)
+    {
+        OE_Bridge_close(&Bridges[Index]);
+    }
+
+    /* A TCP bridge keeps its frame until it is connected. */
+    Config = nodeConfig(OE_BRIDGE_TCP, 0, PORT_NODE_B, false);
+    Error = OE_Bridge_open(&Bridges[0], &Kernel, &Config);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = OE_Bridge_forwardRequest(
+        &Bridges[0],
+        &(OE_MessageHeader_t){.RequestID = RID_Dummy_Sample},
+        &(struct requestArgs_Dummy_Sample_s){TEST_VAL_1});
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = OE_Bridge_flush(&Bridges[0]);
+    CuAssertIntEquals(tc, OE_ERROR_UNSPECIFIED, Error);
+    CuAssertIntEquals(tc, 1, Bridges[0].TxCount);
+
+#if OE_USE_WIRE_FORMAT
+    /* The encoded parameter takes one byte instead of the whole message data. */
+    CuAssertIntEquals(
+        tc,
+        OE_BRIDGE_FRAME_HEADER_SIZE + OE_BRIDGE_MESSAGE_HEADER_SIZE + 1,
+        Bridges[0].TxLength);
+
+    OE_Bridge_close(&Bridges[0]);
+
+    /* Without codecs the parameters are copied as they are. */
+    Config.Codecs = NULL;
+    Error = OE_Bridge_open(&Bridges[0], &Kernel, &Config);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = OE_Bridge_forwardRequest(
+        &Bridges[0],
+        &(OE_MessageHeader_t){.RequestID = RID_Dummy_Sample},
+        &(struct requestArgs_Dummy_Sample_s){TEST_VAL_1});
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    CuAssertIntEquals(
+        tc,
+        OE_BRIDGE_FRAME_HEADER_SIZE + OE_BRIDGE_MESSAGE_HEADER_SIZE + OE_MESSAGE_DATA_SIZE,
+        Bridges[0].TxLength);
+#endif // OE_USE_WIRE_FORMAT
+
+    OE_Bridge_close(&Bridges[0]);
+}
+#endif // OE_USE_BRIDGE
+
+void add_bridge(CuSuite *suite)
+{
+#if OE_USE_BRIDGE
+    SUITE_ADD_TEST(suite, test_bridge_config);
+    SUITE_ADD_TEST(suite, test_bridge_udp);
+    SUITE_ADD_TEST(suite, test_bridge_tcp);
+#else
+    (void)suite;
+#endif // OE_USE_BRIDGE
+}
@@ -0,0 +1,170 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+
+/* Modules */
+#include "test_dummy_intf.h"
+#include "test_dummy_mod.h"
+#include "oe_coroutine.h"
+
+static OE_Core_t Core;
+
+/* The sums of the responses in the order they were handled. */
+static uint8_t Sums[4];
+static size_t NumberOfSums;
+
+static void handleResponse(
+    OE_MessageHeader_t *Header,
+    struct responseArgs_Dummy_Async_s *Args)
+{
+    (void)Header;
+    Sums[NumberOfSums++] = Args->Sum;
+}
+
+/* The number of requests the second subscriber has answered. */
+static uint8_t NumberOfLateResponses;
+
+/* A second subscriber whose responses tell which request they answer. */
+static void handleLateRequest(
+    OE_MessageHeader_t *Header,
+    struct requestArgs_Dummy_Request_1_s *Args)
+{
+    (void)Args;
+    NumberOfLateResponses++;
+    res_Dummy_Request_1(0x10 * NumberOfLateResponses, Header);
+}
+
+static void init(CuTest *tc, OE_Kernel_t *Kernel, module_TestDummy_t *TestDummy)
+{
+    memset(Sums, 0, sizeof(Sums));
+    NumberOfSums = 0;
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(Kernel));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, initModule_TestDummy(TestDummy, NULL, Kernel));
+}
+
+static void test_coroutine_await(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+
+    init(tc, &Kernel, &TestDummy);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        req_Dummy_Async(TEST_VAL_1, (OE_MessageHandler_t)handleResponse, Kernel.KernelID));
+
+    /* The handler sends the first Dummy_Request_1 and returns. */
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 1, Core.MessageQueues[Kernel.KernelID].NumberOfMessages);
+    CuAssertIntEquals(tc, 0, NumberOfSums);
+
+    /* Each response resumes the handler. */
+    while (OE_Kernel_runOnce(&Kernel));
+
+    CuAssertIntEquals(tc, 1, NumberOfSums);
+    CuAssertIntEquals(tc, TEST_VAL_1 + 2 * TEST_VAL_3, Sums[0]);
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_0);
+    CuAssertIntEquals(tc, TEST_VAL_2, TestParam_1);
+
+    /* The handler starts again with the next request. */
+    req_Dummy_Async(TEST_VAL_2, (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+    while (OE_Kernel_runOnce(&Kernel));
+
+    CuAssertIntEquals(tc, 2, NumberOfSums);
+    CuAssertIntEquals(tc, TEST_VAL_2 + 2 * TEST_VAL_3, Sums[1]);
+}
+
+static void test_coroutine_busy(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+
+    init(tc, &Kernel, &TestDummy);
+
+    req_Dummy_Async(TEST_VAL_1, (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+    req_Dummy_Async(TEST_VAL_2, (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+
+    while (OE_Kernel_runOnce(&Kernel));
+
+    /* The second request arrives while the first one awaits a response. */
+    CuAssertIntEquals(tc, 2, NumberOfSums);
+    CuAssertIntEquals(tc, 0, Sums[0]);
+    CuAssertIntEquals(tc, TEST_VAL_1 + 2 * TEST_VAL_3, Sums[1]);
+}
+
+static void test_coroutine_subscribers(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    OE_Kernel_t Kernel_1;
+    module_TestDummy_t TestDummy;
+    OE_RequestID_t RequestID = RID_Dummy_Request_1;
+    OE_MessageHandler_t RequestHandler = (OE_MessageHandler_t)handleLateRequest;
+
+    init(tc, &Kernel, &TestDummy);
+    NumberOfLateResponses = 0;
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(&Kernel_1));
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE_Kernel_registerHandlers(&Kernel_1, &RequestID, &RequestHandler, 1));
+
+    req_Dummy_Async(TEST_VAL_1, (OE_MessageHandler_t)handleResponse, Kernel.KernelID);
+
+    /* The first await sends Dummy_Request_1 to both kernels. */
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 1, Core.MessageQueues[Kernel_1.KernelID].NumberOfMessages);
+
+    /* The response of the first kernel lets the coroutine await the second request. */
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 2, Core.MessageQueues[Kernel_1.KernelID].NumberOfMessages);
+
+    /* The second kernel answers both requests late. */
+    while (OE_Kernel_runOnce(&Kernel_1));
+    CuAssertIntEquals(tc, 2, NumberOfLateResponses);
+
+    /**
+     * The late response to the first await is dropped, although the coroutine awaits
+     * the same request again. The response to the second await resumes it first.
+     */
+    while (OE_Kernel_runOnce(&Kernel));
+
+    CuAssertIntEquals(tc, 1, NumberOfSums);
+    CuAssertIntEquals(tc, TEST_VAL_1 + TEST_VAL_3 + 0x20, Sums[0]);
+}
+
+static void test_coroutine_resume(CuTest *tc)
+{
+    OE_Coroutine_t Coroutine = {0};
+    OE_MessageHeader_t Header = {.RequestID = RID_Dummy_Request_1, .AwaitTag = 2};
+    uint8_t Response = TEST_VAL_3;
+
+    /* A coroutine that does not await a response is not resumed. */
+    CuAssertTrue(tc, !OE_Coroutine_resume(&Coroutine, &Header, &Response));
+
+    Coroutine.Line = __LINE__;
+    Coroutine.Awaiting = RID_Dummy_Request_2;
+    CuAssertTrue(tc, !OE_Coroutine_resume(&Coroutine, &Header, &Response));
+
+    /* A response to an earlier await of the same request is not passed. */
+    Coroutine.Awaiting = RID_Dummy_Request_1;
+    Coroutine.AwaitTag = 3;
+    CuAssertTrue(tc, !OE_Coroutine_resume(&Coroutine, &Header, &Response));
+
+    /* Only the first response to the awaited request resumes it. */
+    Coroutine.AwaitTag = 2;
+    CuAssertTrue(tc, OE_Coroutine_resume(&Coroutine, &Header, &Response));
+    CuAssertTrue(tc, Coroutine.Response == &Response);
+    CuAssertTrue(tc, !OE_Coroutine_resume(&Coroutine, &Header, &Response));
+}
+
+void add_coroutine(CuSuite *suite)
+{
+    SUITE_ADD_TEST(suite, test_coroutine_await);
+    SUITE_ADD_TEST(suite, test_coroutine_busy);
+    SUITE_ADD_TEST(suite, test_coroutine_subscribers);
+    SUITE_ADD_TEST(suite, test_coroutine_resume);
+}
@@ -0,0 +1,142 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+#include "oe_epoll.h"
+
+/* Modules */
+#include "test_dummy_intf.h"
+#include "test_dummy_mod.h"
+
+#if OE_USE_EPOLL
+#include <unistd.h>
+
+static OE_Core_t Core;
+
+static void init(CuTest *tc, OE_Kernel_t *Kernel, module_TestDummy_t *TestDummy)
+{
+    TestParam_0 = TEST_VAL_TEST_BEGIN;
+    TestParam_1 = TEST_VAL_TEST_BEGIN;
+    TestParam_2 = TEST_VAL_TEST_BEGIN;
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(Kernel));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, initModule_TestDummy(TestDummy, NULL, Kernel));
+}
+
+static void test_epoll_ready(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    uint8_t Value = TEST_VAL_3;
+    int Pipe[2];
+
+    init(tc, &Kernel, &TestDummy);
+    CuAssertIntEquals(tc, 0, pipe(Pipe));
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE_Epoll_addFile(&Kernel, Pipe[0], EPOLLIN, RID_Dummy_Ready));
+
+    /* A file can only be added once. */
+    CuAssertIntEquals(tc, OE_ERROR_PARAMETER_INVALID,
+        OE_Epoll_addFile(&Kernel, Pipe[0], EPOLLIN, RID_Dummy_Ready));
+
+    CuAssertIntEquals(tc, OE_ERROR_REQUEST_ID_INVALID,
+        OE_Epoll_addFile(&Kernel, Pipe[1], EPOLLOUT, OE_NUMBER_OF_REQUESTS));
+
+    CuAssertIntEquals(tc, sizeof(Value), write(Pipe[1], &Value, sizeof(Value)));
+
+    /* The readiness of the pipe is sent as request to the kernel. */
+    OE_Epoll_idle(Kernel.KernelID);
+    CuAssertIntEquals(tc, 1, Core.MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, (uint8_t)Pipe[0], TestParam_0);
+    CuAssertIntEquals(tc, EPOLLIN, TestParam_1);
+    CuAssertIntEquals(tc, TEST_VAL_3, TestParam_2);
+
+    /* The handler read the pipe, so only the resume ends the next idle. */
+    OE_Epoll_resume(Kernel.KernelID);
+    OE_Epoll_idle(Kernel.KernelID);
+    CuAssertIntEquals(tc, 0, Core.MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    close(Pipe[0]);
+    close(Pipe[1]);
+}
+
+static void test_epoll_resume(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+
+    init(tc, &Kernel, &TestDummy);
+
+    /* A kernel that is resumed before it idles does not wait. */
+    OE_Epoll_resume(Kernel.KernelID);
+    OE_Epoll_resume(Kernel.KernelID);
+    OE_Epoll_idle(Kernel.KernelID);
+
+    CuAssertIntEquals(tc, 0, Core.MessageQueues[Kernel.KernelID].NumberOfMessages);
+    CuAssertTrue(tc, !OE_Kernel_runOnce(&Kernel));
+
+    /* Sending a message resumes the kernel. */
+    req_Dummy_Request_2();
+    OE_Epoll_idle(Kernel.KernelID);
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+}
+
+static void test_epoll_removeFile(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    uint8_t Value = TEST_VAL_2;
+    int Pipe[2];
+
+    init(tc, &Kernel, &TestDummy);
+    CuAssertIntEquals(tc, 0, pipe(Pipe));
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE_Epoll_addFile(&Kernel, Pipe[0], EPOLLIN, RID_Dummy_Ready));
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE_Epoll_removeFile(&Kernel, Pipe[0]));
+    CuAssertIntEquals(tc, OE_ERROR_PARAMETER_INVALID,
+        OE_Epoll_removeFile(&Kernel, Pipe[0]));
+
+    CuAssertIntEquals(tc, sizeof(Value), write(Pipe[1], &Value, sizeof(Value)));
+
+    /* The pipe is ready, but nothing is sent. */
+    OE_Epoll_resume(Kernel.KernelID);
+    OE_Epoll_idle(Kernel.KernelID);
+    CuAssertIntEquals(tc, 0, Core.MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* Reinitializing the kernel removes all files. */
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE_Epoll_addFile(&Kernel, Pipe[0], EPOLLIN, RID_Dummy_Ready));
+    init(tc, &Kernel, &TestDummy);
+
+    OE_Epoll_resume(Kernel.KernelID);
+    OE_Epoll_idle(Kernel.KernelID);
+    CuAssertIntEquals(tc, 0, Core.MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* The pipe was never read. */
+    Value = TEST_VAL_TEST_BEGIN;
+    CuAssertIntEquals(tc, sizeof(Value), read(Pipe[0], &Value, sizeof(Value)));
+    CuAssertIntEquals(tc, TEST_VAL_2, Value);
+
+    close(Pipe[0]);
+    close(Pipe[1]);
+}
+#endif // OE_USE_EPOLL
+
+void add_epoll(CuSuite *suite)
+{
+#if OE_USE_EPOLL
+    SUITE_ADD_TEST(suite, test_epoll_ready);
+    SUITE_ADD_TEST(suite, test_epoll_resume);
+    SUITE_ADD_TEST(suite, test_epoll_removeFile);
+#else
+    (void)suite;
+#endif // OE_USE_EPOLL
+}
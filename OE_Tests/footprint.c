@@ -0,0 +1,27 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+
+#if OE_TEST_FOOTPRINT
+/* Generated by the Systembuilder when the tests are configured, see CMakeLists.txt. */
+#include "oe_footprint.h"
+
+static void test_footprint_sizes(CuTest *tc)
+{
+    CuAssertIntEquals(tc, OE_FOOTPRINT_MESSAGE_SIZE, sizeof(OE_Message_t));
+    CuAssertIntEquals(tc, OE_FOOTPRINT_CORE_SIZE, sizeof(OE_Core_t));
+    CuAssertIntEquals(tc, OE_FOOTPRINT_REQUEST_MAP_SIZE, sizeof(OE_RequestMap_t));
+    CuAssertIntEquals(tc, OE_FOOTPRINT_KERNEL_SIZE, sizeof(OE_Kernel_t));
+}
+#endif // OE_TEST_FOOTPRINT
+
+void add_footprint(CuSuite *suite)
+{
+#if OE_TEST_FOOTPRINT
+    SUITE_ADD_TEST(suite, test_footprint_sizes);
+#else
+    (void)suite;
+#endif // OE_TEST_FOOTPRINT
+}
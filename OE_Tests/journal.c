@@ -0,0 +1,282 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+#include "oe_journal.h"
+
+/* Modules */
+#include "oe_all_modules.h"
+#include "test_dummy_intf.h"
+#include "test_dummy_mod.h"
+
+#if OE_USE_JOURNAL
+#include <fcntl.h>
+#include <unistd.h>
+
+static OE_Core_t Core;
+
+/* The application kernel and the kernel of the journal. */
+static OE_Kernel_t Kernel;
+static OE_Kernel_t JournalKernel;
+static module_TestDummy_t TestDummy;
+
+static const OE_RequestID_t PersistentRequests[] = OE_PERSISTENT_REQUESTS;
+
+#if OE_USE_WIRE_FORMAT
+static const OE_WireCodec_t Codecs[OE_NUMBER_OF_REQUESTS] = OE_REQUEST_CODECS;
+#endif
+
+static char Path[64];
+
+static OE_JournalConfig_t config(size_t Size, size_t GroupSize)
+{
+    return (OE_JournalConfig_t){
+        .Path = Path,
+        .Size = Size,
+        .Requests = PersistentRequests,
+        .NumberOfRequests = sizeof(PersistentRequests) / sizeof(OE_RequestID_t),
+        .GroupSize = GroupSize,
+        .CommitTicks = 5,
+#if OE_USE_WIRE_FORMAT
+        .Codecs = Codecs,
+#endif
+    };
+}
+
+/* Start the system as after a reboot. */
+static void boot(CuTest *tc)
+{
+    TestParam_0 = TEST_VAL_TEST_BEGIN;
+    TestParam_1 = TEST_VAL_TEST_BEGIN;
+    TestParam_2 = TEST_VAL_TEST_BEGIN;
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(&Kernel));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(&JournalKernel));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, initModule_TestDummy(&TestDummy, NULL, &Kernel));
+}
+
+static void run(OE_Kernel_t *pKernel)
+{
+    while (OE_Kernel_runOnce(pKernel))
+    {
+    }
+}
+
+static void init(CuTest *tc)
+{
+    snprintf(Path, sizeof(Path), "/tmp/oe_journal_%d.log", (int)getpid());
+    unlink(Path);
+
+    boot(tc);
+}
+
+static void test_journal_replay(CuTest *tc)
+{
+    OE_Journal_t Journal;
+    OE_Journal_t Other;
+    OE_JournalConfig_t Config;
+
+    init(tc);
+    Config = config(4096, 2);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+
+    /* Only one journal can be open. */
+    CuAssertIntEquals(tc, OE_ERROR_HANDLER_LIMIT_REACHED, OE_Journal_open(&Other, &JournalKernel, &Config));
+
+    /* A new log has nothing to replay. */
+    CuAssertIntEquals(tc, 0, OE_Journal_replay(&Journal));
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, req_Dummy_Status(TEST_VAL_3));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, req_Dummy_Sample(TEST_VAL_2));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, req_Dummy_Keyed(TEST_VAL_1, TEST_VAL_2));
+
+    /* Only the persistent requests reach the journal. They are committed as one group. */
+    CuAssertIntEquals(tc, 2, Core.MessageQueues[JournalKernel.KernelID].NumberOfMessages);
+    run(&JournalKernel);
+    run(&Kernel);
+
+    CuAssertIntEquals(tc, 2, Journal.RecordsAppended);
+    CuAssertIntEquals(tc, 2, Journal.RecordsCommitted);
+    CuAssertIntEquals(tc, 1, Journal.Commits);
+
+    OE_Journal_close(&Journal);
+
+    /* Reboot. The requests are sent again before the kernels start. */
+    boot(tc);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+    CuAssertIntEquals(tc, 2, OE_Journal_replay(&Journal));
+    CuAssertIntEquals(tc, 0, OE_Journal_replay(&Journal));
+
+    run(&Kernel);
+    CuAssertIntEquals(tc, TEST_VAL_3, TestParam_2);
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_0);
+    CuAssertIntEquals(tc, TEST_VAL_2, TestParam_1);
+
+    /* The replayed requests are not appended again. */
+    run(&JournalKernel);
+    CuAssertIntEquals(tc, 0, Journal.RecordsAppended);
+    CuAssertIntEquals(tc, 2, Journal.RecordsReplayed);
+
+    OE_Journal_close(&Journal);
+    unlink(Path);
+}
+
+static void test_journal_forgedReplay(CuTest *tc)
+{
+    OE_Journal_t Journal;
+    OE_JournalConfig_t Config;
+    OE_MessageHeader_t Header;
+
+    init(tc);
+    Config = config(4096, 1);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+
+    /* A sender cannot mark its own request as replayed. */
+    Header = (OE_MessageHeader_t){
+        .Information = OE_MESSAGE_REPLAYED,
+        .RequestID = RID_Dummy_Status,
+    };
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE_Core_sendRequest(&Header, &(struct requestArgs_Dummy_Status_s){TEST_VAL_3}));
+
+    run(&JournalKernel);
+    run(&Kernel);
+    CuAssertIntEquals(tc, TEST_VAL_3, TestParam_2);
+    CuAssertIntEquals(tc, 1, Journal.RecordsAppended);
+    CuAssertIntEquals(tc, 0, Journal.RecordsReplayed);
+
+    OE_Journal_close(&Journal);
+    unlink(Path);
+}
+
+static void test_journal_recover(CuTest *tc)
+{
+    OE_Journal_t Journal;
+    OE_JournalConfig_t Config;
+    size_t Second;
+    uint8_t Byte;
+    int File;
+
+    init(tc);
+    Config = config(4096, 10);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+
+    /* A group that is not full is committed after the commit ticks. */
+    req_Dummy_Status(TEST_VAL_1);
+    run(&JournalKernel);
+    CuAssertIntEquals(tc, 0, OE_Journal_poll(&Journal));
+    TestTicks += 5;
+    CuAssertIntEquals(tc, 1, OE_Journal_poll(&Journal));
+    CuAssertIntEquals(tc, 0, OE_Journal_poll(&Journal));
+
+    Second = Journal.Length;
+    req_Dummy_Status(TEST_VAL_2);
+    run(&JournalKernel);
+    req_Dummy_Status(TEST_VAL_3);
+    run(&JournalKernel);
+    OE_Journal_close(&Journal);
+
+    /* Tear the second record. The log ends before it. */
+    File = open(Path, O_RDWR);
+    CuAssertTrue(tc, File >= 0);
+    CuAssertIntEquals(tc, 1, pread(File, &Byte, 1, (off_t)Second));
+    Byte ^= 0xFF;
+    CuAssertIntEquals(tc, 1, pwrite(File, &Byte, 1, (off_t)Second));
+    close(File);
+
+    boot(tc);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+    CuAssertIntEquals(tc, 1, OE_Journal_replay(&Journal));
+    run(&Kernel);
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_2);
+
+    /* New records follow the last valid one. The third record is gone for good. */
+    req_Dummy_Keyed(TEST_VAL_2, TEST_VAL_3);
+    run(&JournalKernel);
+    OE_Journal_close(&Journal);
+
+    boot(tc);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+    CuAssertIntEquals(tc, 2, OE_Journal_replay(&Journal));
+    run(&Kernel);
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_2);
+    CuAssertIntEquals(tc, TEST_VAL_2, TestParam_0);
+    CuAssertIntEquals(tc, TEST_VAL_3, TestParam_1);
+
+    OE_Journal_close(&Journal);
+    unlink(Path);
+}
+
+static void test_journal_clear(CuTest *tc)
+{
+    OE_Journal_t Journal;
+    OE_JournalConfig_t Config;
+    size_t Count = 0;
+    uint8_t Byte = 0;
+    int File;
+
+    init(tc);
+    Config = config(256, 4);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+
+    /* The log does not wrap. */
+    while (Journal.RecordsDropped == 0)
+    {
+        req_Dummy_Status((uint8_t)Count++);
+        run(&JournalKernel);
+    }
+
+    CuAssertIntEquals(tc, Count - 1, Journal.RecordsAppended);
+    CuAssertIntEquals(tc, OE_ERROR_MESSAGE_QUEUE_FULL,
+        OE_Journal_append(&Journal, &(OE_MessageHeader_t){.RequestID = RID_Dummy_Status}, &Byte));
+
+    /* Clearing the log invalidates all records at once. */
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_clear(&Journal));
+    req_Dummy_Status(TEST_VAL_2);
+    run(&JournalKernel);
+    OE_Journal_close(&Journal);
+
+    boot(tc);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+    CuAssertIntEquals(tc, 1, OE_Journal_replay(&Journal));
+    run(&Kernel);
+    CuAssertIntEquals(tc, TEST_VAL_2, TestParam_2);
+    OE_Journal_close(&Journal);
+
+    /* The log of another configuration is cleared. */
+    File = open(Path, O_RDWR);
+    CuAssertTrue(tc, File >= 0);
+    CuAssertIntEquals(tc, 1, pwrite(File, &Byte, 1, 6));
+    close(File);
+
+    boot(tc);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Journal_open(&Journal, &JournalKernel, &Config));
+    CuAssertIntEquals(tc, 0, OE_Journal_replay(&Journal));
+    OE_Journal_close(&Journal);
+
+    /* The log must hold at least one record. */
+    Config.Size = OE_JOURNAL_HEADER_SIZE;
+    CuAssertIntEquals(tc, OE_ERROR_PARAMETER_INVALID, OE_Journal_open(&Journal, &JournalKernel, &Config));
+
+    unlink(Path);
+}
+#endif // OE_USE_JOURNAL
+
+void add_journal(CuSuite *suite)
+{
+#if OE_USE_JOURNAL
+    SUITE_ADD_TEST(suite, test_journal_replay);
+    SUITE_ADD_TEST(suite, test_journal_forgedReplay);
+    SUITE_ADD_TEST(suite, test_journal_recover);
+    SUITE_ADD_TEST(suite, test_journal_clear);
+#else
+    (void)suite;
+#endif // OE_USE_JOURNAL
+}
@@ -29,6 +29,8 @@
 uint8_t TestParam_0;
 uint8_t TestParam_1;
 uint8_t TestParam_2;
+uint32_t TestTicks;
+_Thread_local uint8_t TestCurrentKernel = OE_NO_KERNEL;
 /* USER CODE MAIN GLOBALS END */
 
 /* Kernel threads. */
@@ -47,6 +49,16 @@ int main(void)
     CuString *output = CuStringNew();
     CuSuite* suite = CuSuiteNew();
     
+    add_multiProcess(suite);
+    add_bridge(suite);
+    add_wire(suite);
+    add_epoll(suite);
+    add_asyncIO(suite);
+    add_coroutine(suite);
+    add_typed(suite);
+    add_messagePool(suite);
+    add_journal(suite);
+    add_footprint(suite);
     add_singleKernel(suite);
     add_multiKernel(suite);
 
@@ -0,0 +1,227 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+
+/* Modules */
+#include "test_dummy_intf.h"
+#include "test_dummy_mod.h"
+
+#if OE_USE_MESSAGE_POOL
+#include <string.h>
+
+static OE_Core_t Core;
+
+static void init(CuTest *tc, OE_Kernel_t *Kernel, module_TestDummy_t *TestDummy)
+{
+    TestParam_0 = TEST_VAL_TEST_BEGIN;
+    TestParam_1 = TEST_VAL_TEST_BEGIN;
+    TestParam_2 = TEST_VAL_TEST_BEGIN;
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(Kernel));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, initModule_TestDummy(TestDummy, NULL, Kernel));
+}
+
+static OE_Error_t sendSample(uint8_t Value, OE_Block_t Block)
+{
+    OE_MessageHeader_t MessageHeader = {
+        .RequestID = RID_Dummy_Sample,
+        .Block = Block,
+    };
+
+    return OE_Core_sendRequest(
+        &MessageHeader,
+        &(struct requestArgs_Dummy_Sample_s){
+            Value,
+        });
+}
+
+static void test_messagePool_allocate(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_Block_t Blocks[8];
+    OE_Block_t Block;
+    size_t Size;
+
+    init(tc, &Kernel, &TestDummy);
+
+    /* The smallest class that fits is used. */
+    Block = OE_Core_allocateBlock(100);
+    CuAssertTrue(tc, Block != OE_NO_BLOCK);
+    CuAssertPtrNotNull(tc, OE_Core_getBlock(Block, &Size));
+    CuAssertIntEquals(tc, 256, Size);
+    OE_Core_releaseBlock(Block);
+
+    /* No class fits. */
+    CuAssertIntEquals(tc, OE_NO_BLOCK, OE_Core_allocateBlock(1025));
+
+    /* A larger class is used once the small one is exhausted. */
+    for (size_t Count = 0; Count < 8; Count++)
+    {
+        Blocks[Count] = OE_Core_allocateBlock(1);
+        CuAssertTrue(tc, Blocks[Count] != OE_NO_BLOCK);
+        CuAssertPtrNotNull(tc, OE_Core_getBlock(Blocks[Count], &Size));
+        CuAssertIntEquals(tc, 64, Size);
+    }
+
+    Block = OE_Core_allocateBlock(1);
+    CuAssertPtrNotNull(tc, OE_Core_getBlock(Block, &Size));
+    CuAssertIntEquals(tc, 256, Size);
+    OE_Core_releaseBlock(Block);
+
+    for (size_t Count = 0; Count < 8; Count++)
+    {
+        OE_Core_releaseBlock(Blocks[Count]);
+    }
+
+    /* The large class has two blocks. */
+    Blocks[0] = OE_Core_allocateBlock(1024);
+    Blocks[1] = OE_Core_allocateBlock(1024);
+    CuAssertTrue(tc, Blocks[0] != OE_NO_BLOCK && Blocks[1] != OE_NO_BLOCK);
+    CuAssertIntEquals(tc, OE_NO_BLOCK, OE_Core_allocateBlock(1024));
+
+    /* A freed block can be allocated again, but its old handle is invalid. */
+    OE_Core_releaseBlock(Blocks[0]);
+    CuAssertPtrEquals(tc, NULL, OE_Core_getBlock(Blocks[0], &Size));
+    CuAssertIntEquals(tc, 0, Size);
+    CuAssertTrue(tc, !OE_Core_retainBlock(Blocks[0]));
+
+    Block = OE_Core_allocateBlock(1024);
+    CuAssertTrue(tc, Block != OE_NO_BLOCK && Block != Blocks[0]);
+
+    /* Releasing a stale handle does not free the new owner's block. */
+    OE_Core_releaseBlock(Blocks[0]);
+    CuAssertPtrNotNull(tc, OE_Core_getBlock(Block, NULL));
+
+    OE_Core_releaseBlock(Block);
+    OE_Core_releaseBlock(Blocks[1]);
+}
+
+static void test_messagePool_request(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_Block_t Block;
+    uint8_t *Data;
+
+    init(tc, &Kernel, &TestDummy);
+
+    Block = OE_Core_allocateBlock(64);
+    Data = OE_Core_getBlock(Block, NULL);
+    memset(Data, TEST_VAL_2, 64);
+
+    /* Sending the request passes the reference of the sender to the message. */
+    CuAssertIntEquals(tc, OE_ERROR_NONE, sendSample(TEST_VAL_1, Block));
+    CuAssertPtrEquals(tc, Data, OE_Core_getBlock(Block, NULL));
+
+    /* The handler may keep the block. */
+    CuAssertTrue(tc, OE_Core_retainBlock(Block));
+
+    /* The block is released after the handlers of the kernel returned. */
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_1);
+    CuAssertPtrEquals(tc, Data, OE_Core_getBlock(Block, NULL));
+    CuAssertIntEquals(tc, TEST_VAL_2, Data[63]);
+
+    OE_Core_releaseBlock(Block);
+    CuAssertPtrEquals(tc, NULL, OE_Core_getBlock(Block, NULL));
+
+    /* A request without subscribers still frees its block. */
+    initModule_OE_Core(&Core, NULL, NULL);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(&Kernel));
+
+    Block = OE_Core_allocateBlock(64);
+    sendSample(TEST_VAL_1, Block);
+    CuAssertPtrEquals(tc, NULL, OE_Core_getBlock(Block, NULL));
+}
+
+static void test_messagePool_retry(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_MessageQueue_t *Queue;
+    OE_Block_t Block;
+    uint8_t *Data;
+    OE_MessageHeader_t MessageHeader = {
+        .RequestID = RID_Dummy_Sample,
+    };
+    struct requestArgs_Dummy_Sample_s Args = {
+        TEST_VAL_1,
+    };
+
+    init(tc, &Kernel, &TestDummy);
+    Queue = &Core.MessageQueues[Kernel.KernelID];
+
+    Block = OE_Core_allocateBlock(64);
+    Data = OE_Core_getBlock(Block, NULL);
+    memset(Data, TEST_VAL_2, 64);
+    MessageHeader.Block = Block;
+
+    while (OE_MessageQueue_allocateMessage(Queue) != NULL)
+    {
+    }
+
+    /* A request that is not sent leaves the block with the sender. */
+    CuAssertIntEquals(tc, OE_ERROR_MESSAGE_QUEUE_FULL, OE_Core_sendRequest(&MessageHeader, &Args));
+    CuAssertIntEquals(tc, Block, MessageHeader.Block);
+    CuAssertPtrEquals(tc, Data, OE_Core_getBlock(Block, NULL));
+
+    /* The same header can be sent again once there is room. */
+    OE_MessageQueue_staticInit(Queue);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Core_sendRequest(&MessageHeader, &Args));
+    CuAssertIntEquals(tc, OE_NO_BLOCK, MessageHeader.Block);
+    CuAssertPtrEquals(tc, Data, OE_Core_getBlock(Block, NULL));
+
+    /* The queued message holds the only reference. */
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_1);
+    CuAssertPtrEquals(tc, NULL, OE_Core_getBlock(Block, NULL));
+
+    /* Sending the header once more does not send the released block. */
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Core_sendRequest(&MessageHeader, &Args));
+    CuAssertIntEquals(tc, OE_NO_BLOCK, Queue->Messages[Queue->Tail].Header.Block);
+}
+
+static void test_messagePool_dropOldest(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_Block_t Blocks[3];
+
+    init(tc, &Kernel, &TestDummy);
+
+    /* The limit of Dummy_Sample is two, the oldest message is dropped with its block. */
+    for (uint8_t Count = 0; Count < 3; Count++)
+    {
+        Blocks[Count] = OE_Core_allocateBlock(64);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, sendSample(Count, Blocks[Count]));
+    }
+
+    CuAssertPtrEquals(tc, NULL, OE_Core_getBlock(Blocks[0], NULL));
+    CuAssertPtrNotNull(tc, OE_Core_getBlock(Blocks[1], NULL));
+    CuAssertPtrNotNull(tc, OE_Core_getBlock(Blocks[2], NULL));
+
+    while (OE_Kernel_runOnce(&Kernel))
+    {
+    }
+
+    CuAssertPtrEquals(tc, NULL, OE_Core_getBlock(Blocks[1], NULL));
+    CuAssertPtrEquals(tc, NULL, OE_Core_getBlock(Blocks[2], NULL));
+}
+#endif // OE_USE_MESSAGE_POOL
+
+void add_messagePool(CuSuite *suite)
+{
+#if OE_USE_MESSAGE_POOL
+    SUITE_ADD_TEST(suite, test_messagePool_allocate);
+    SUITE_ADD_TEST(suite, test_messagePool_request);
+    SUITE_ADD_TEST(suite, test_messagePool_retry);
+    SUITE_ADD_TEST(suite, test_messagePool_dropOldest);
+#else
+    (void)suite;
+#endif // OE_USE_MESSAGE_POOL
+}
@@ -20,9 +20,13 @@ static OE_Kernel_t Kernel_0, Kernel_1, Kernel_2, Kernel_3;
 
 /* OpenEDOS threads */
 static pthread_t kernel_threads[OE_NUMBER_OF_KERNELS];
-pthread_mutex_t critical_section_mutex = PTHREAD_MUTEX_INITIALIZER;
-pthread_mutex_t condition_mutexes[OE_NUMBER_OF_KERNELS] = { PTHREAD_MUTEX_INITIALIZER };
-pthread_cond_t condition_conds[OE_NUMBER_OF_KERNELS] = { PTHREAD_COND_INITIALIZER };
+static pthread_mutex_t local_critical_section_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t local_condition_mutexes[OE_NUMBER_OF_KERNELS] = { PTHREAD_MUTEX_INITIALIZER };
+static pthread_cond_t local_condition_conds[OE_NUMBER_OF_KERNELS] = { PTHREAD_COND_INITIALIZER };
+/* The port uses the local sync objects unless a shared core is attached. */
+pthread_mutex_t *critical_section_mutex = &local_critical_section_mutex;
+pthread_mutex_t *condition_mutexes = local_condition_mutexes;
+pthread_cond_t *condition_conds = local_condition_conds;
 /* Useful for debugging */
 // atomic_bool kernel_running[OE_NUMBER_OF_KERNELS];
 
@@ -131,6 +135,7 @@ static __attribute__ ((__unused__)) void test_multiKernel_staticInit(CuTest *tc)
 
 static void Test_Kernel_run(CuTest* tc)
 {
+    TestCurrentKernel = ((OE_Kernel_t*)tc->args)->KernelID;
     OE_Kernel_run((OE_Kernel_t*)tc->args);
 }
 
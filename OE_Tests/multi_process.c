@@ -0,0 +1,221 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_core_mod.h"
+#include "oe_kernel.h"
+#include "oe_shared_core.h"
+
+/* Modules */
+#include "test_dummy_intf.h"
+
+/* Processes */
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#if OE_USE_SHARED_CORE
+#define SHARED_CORE_NAME "/oe_tests_shared_core"
+#define PROCESS_TIMEOUT_S 10
+
+void portSharedInit(PortSharedData_t *PortData)
+{
+    pthread_mutexattr_t MutexAttributes;
+    pthread_condattr_t CondAttributes;
+
+    pthread_mutexattr_init(&MutexAttributes);
+    pthread_mutexattr_setpshared(&MutexAttributes, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_init(&CondAttributes);
+    pthread_condattr_setpshared(&CondAttributes, PTHREAD_PROCESS_SHARED);
+
+    pthread_mutex_init(&PortData->CriticalSectionMutex, &MutexAttributes);
+
+    for (int KernelID = 0; KernelID < OE_NUMBER_OF_KERNELS; KernelID++)
+    {
+        pthread_mutex_init(&PortData->ConditionMutexes[KernelID], &MutexAttributes);
+        pthread_cond_init(&PortData->ConditionConds[KernelID], &CondAttributes);
+    }
+
+    pthread_mutexattr_destroy(&MutexAttributes);
+    pthread_condattr_destroy(&CondAttributes);
+}
+
+/* The local sync objects are used again after detaching. */
+static pthread_mutex_t *local_critical_section_mutex;
+static pthread_mutex_t *local_condition_mutexes;
+static pthread_cond_t *local_condition_conds;
+
+void portSharedAttach(PortSharedData_t *PortData)
+{
+    local_critical_section_mutex = critical_section_mutex;
+    local_condition_mutexes = condition_mutexes;
+    local_condition_conds = condition_conds;
+
+    critical_section_mutex = &PortData->CriticalSectionMutex;
+    condition_mutexes = PortData->ConditionMutexes;
+    condition_conds = PortData->ConditionConds;
+}
+
+void portSharedDetach(PortSharedData_t *PortData)
+{
+    (void)PortData;
+
+    critical_section_mutex = local_critical_section_mutex;
+    condition_mutexes = local_condition_mutexes;
+    condition_conds = local_condition_conds;
+}
+
+static volatile bool responseReceived;
+
+static void handleRequest_Dummy_Request_1(
+    OE_MessageHeader_t *Header,
+    struct requestArgs_Dummy_Request_1_s *Args)
+{
+    /* Function pointers of the other process are never shared. */
+    if (Header->ResponseHandler != NULL || Header->ResponseIndex == OE_NO_RESPONSE_INDEX)
+    {
+        return;
+    }
+
+    res_Dummy_Request_1(
+        Args->Dummy_Request_Param_1 + Args->Dummy_Request_Param_2,
+        Header);
+
+    responseReceived = true;
+}
+
+static void handleResponse_Dummy_Request_1(
+    OE_MessageHeader_t *Header,
+    struct responseArgs_Dummy_Request_1_s *Args)
+{
+    (void)Header;
+
+    if (Args->Dummy_Response_Param_1 == TEST_VAL_2 + TEST_VAL_3)
+    {
+        responseReceived = true;
+    }
+}
+
+/**
+ * The child process attaches to the shared core, connects its own kernel
+ * and answers one request of the parent process.
+ */
+static int runChildProcess(void)
+{
+    OE_Kernel_t Kernel;
+    module_OE_Core_t *Core;
+    OE_RequestID_t RequestID = RID_Dummy_Request_1;
+    OE_MessageHandler_t RequestHandler = (OE_MessageHandler_t)handleRequest_Dummy_Request_1;
+    time_t Start = time(NULL);
+
+    if (OE_SharedCore_attach(SHARED_CORE_NAME, &Core) != OE_ERROR_NONE)
+    {
+        return 1;
+    }
+
+    if (OE_Kernel_staticInit(&Kernel) != OE_ERROR_NONE || Kernel.KernelID != 1)
+    {
+        return 2;
+    }
+
+    if (OE_Kernel_registerHandlers(&Kernel, &RequestID, &RequestHandler, 1) != OE_ERROR_NONE)
+    {
+        return 3;
+    }
+
+    responseReceived = false;
+
+    while (!responseReceived)
+    {
+        if (time(NULL) - Start > PROCESS_TIMEOUT_S)
+        {
+            return 4;
+        }
+        OE_Kernel_runOnce(&Kernel);
+    }
+
+    OE_SharedCore_detach(Core);
+
+    return 0;
+}
+
+static void test_multiProcess_sharedCore(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_OE_Core_t *Core;
+    OE_Error_t Error;
+    pid_t Child;
+    int Status;
+    time_t Start;
+
+    /* A previous run may have left the segment behind. */
+    OE_SharedCore_unlink(SHARED_CORE_NAME);
+
+    Error = OE_SharedCore_create(SHARED_CORE_NAME, NULL, &Core);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* The segment cannot be created twice. */
+    Error = OE_SharedCore_create(SHARED_CORE_NAME, NULL, &Core);
+    CuAssertIntEquals(tc, OE_ERROR_UNSPECIFIED, Error);
+
+    Error = OE_Kernel_staticInit(&Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 0, Kernel.KernelID);
+
+    Child = fork();
+    CuAssertTrue(tc, Child >= 0);
+
+    if (Child == 0)
+    {
+        _exit(runChildProcess());
+    }
+
+    /* Wait for the kernel of the child process. */
+    Start = time(NULL);
+    while (!((volatile bool *)Core->RequestSubscribed[1])[RID_Dummy_Request_1]
+        && time(NULL) - Start <= PROCESS_TIMEOUT_S)
+    {
+        OE_YIELD();
+    }
+    CuAssertTrue(tc, Core->RequestSubscribed[1][RID_Dummy_Request_1]);
+    CuAssertIntEquals(tc, 2, Core->NumberOfKernels);
+
+    responseReceived = false;
+
+    Error = req_Dummy_Request_1(
+        TEST_VAL_2,
+        TEST_VAL_3,
+        (OE_MessageHandler_t)handleResponse_Dummy_Request_1,
+        Kernel.KernelID);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* The response is handled in this process. */
+    Start = time(NULL);
+    while (!responseReceived && time(NULL) - Start <= PROCESS_TIMEOUT_S)
+    {
+        OE_Kernel_runOnce(&Kernel);
+    }
+    CuAssertTrue(tc, responseReceived);
+
+    CuAssertIntEquals(tc, Child, waitpid(Child, &Status, 0));
+    CuAssertTrue(tc, WIFEXITED(Status));
+    CuAssertIntEquals(tc, 0, WEXITSTATUS(Status));
+
+    OE_SharedCore_detach(Core);
+
+    Error = OE_SharedCore_unlink(SHARED_CORE_NAME);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* Attaching fails once the segment is gone. */
+    Error = OE_SharedCore_attach(SHARED_CORE_NAME, &Core);
+    CuAssertIntEquals(tc, OE_ERROR_UNSPECIFIED, Error);
+}
+#endif // OE_USE_SHARED_CORE
+
+void add_multiProcess(CuSuite *suite)
+{
+#if OE_USE_SHARED_CORE
+    SUITE_ADD_TEST(suite, test_multiProcess_sharedCore);
+#else
+    (void)suite;
+#endif // OE_USE_SHARED_CORE
+}
@@ -25,6 +25,8 @@
 #include "dummy_2_mod.h"
 #include "dummy_0_mod.h"
 #include "test_dummy_mod.h"
+#include "bridge_mod.h"
+#include "async_io_mod.h"
 #include "oe_core_mod.h"
 
 #endif // OE_ALL_MODULES_H
\ No newline at end of file
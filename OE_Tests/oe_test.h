@@ -22,6 +22,16 @@ extern uint8_t TestParam_2;
 
 void add_singleKernel(CuSuite *suite);
 void add_multiKernel(CuSuite *suite);
+void add_multiProcess(CuSuite *suite);
+void add_bridge(CuSuite *suite);
+void add_wire(CuSuite *suite);
+void add_epoll(CuSuite *suite);
+void add_asyncIO(CuSuite *suite);
+void add_coroutine(CuSuite *suite);
+void add_typed(CuSuite *suite);
+void add_messagePool(CuSuite *suite);
+void add_journal(CuSuite *suite);
+void add_footprint(CuSuite *suite);
 
 void summarizeKernelTests(CuSuite* suite, int Kernel_ID);
 
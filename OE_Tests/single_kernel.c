@@ -224,6 +224,879 @@ static void test_singleKernel_requestLimitReached(CuTest *tc)
     CuAssertIntEquals(tc, OE_REQUEST_LIMIT, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
 }
 
+static void test_singleKernel_sendRequests(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_MessageHeader_t Headers[4];
+    struct requestArgs_Dummy_Keyed_s Args[3];
+    const void *Parameters[4];
+    OE_Error_t Error;
+    uint8_t i;
+
+    TestTicks = 0;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    for (i = 0; i < 3; i++)
+    {
+        Headers[i] = (OE_MessageHeader_t){.RequestID = RID_Dummy_Keyed};
+        Args[i] = (struct requestArgs_Dummy_Keyed_s){i + 1, 10 * (i + 1)};
+        Parameters[i] = &Args[i];
+    }
+    Headers[3] = (OE_MessageHeader_t){.RequestID = RID_Dummy_Blocking};
+    Parameters[3] = NULL;
+
+    /* The whole batch is queued in order. */
+    Error = OE_Core_sendRequests(Headers, Parameters, 4);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 4, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    TestParam_2 = 0;
+    for (i = 1; i <= 3; i++)
+    {
+        CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+        CuAssertIntEquals(tc, i, TestParam_0);
+        CuAssertIntEquals(tc, 10 * i, TestParam_1);
+    }
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 1, TestParam_2);
+
+    /* Dummy_Blocking has a request limit of 1. Nothing is queued if the batch does not fit. */
+    Headers[2] = Headers[3];
+    Parameters[2] = NULL;
+    Error = OE_Core_sendRequests(&Headers[1], &Parameters[1], 3);
+    CuAssertIntEquals(tc, OE_ERROR_REQUEST_LIMIT_REACHED, Error);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    Headers[0].RequestID = OE_NUMBER_OF_REQUESTS;
+    Error = OE_Core_sendRequests(Headers, Parameters, 2);
+    CuAssertIntEquals(tc, OE_ERROR_REQUEST_ID_INVALID, Error);
+
+    /* Without parameters and with an empty batch. */
+    Error = OE_Core_sendRequests(&Headers[3], NULL, 1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = OE_Core_sendRequests(Headers, NULL, 0);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 1, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+#if OE_USE_RATE_LIMIT
+    /* Dummy_Request_2 may be sent 3 times per 10 ticks, the tokens are checked for the whole batch. */
+    for (i = 0; i < 4; i++)
+    {
+        Headers[i] = (OE_MessageHeader_t){.RequestID = RID_Dummy_Request_2};
+    }
+
+    Error = OE_Core_sendRequests(Headers, NULL, 4);
+    CuAssertIntEquals(tc, OE_ERROR_RATE_LIMIT_REACHED, Error);
+    CuAssertIntEquals(tc, 1, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    Error = OE_Core_sendRequests(Headers, NULL, 3);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 4, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    Error = OE_Core_sendRequests(Headers, NULL, 1);
+    CuAssertIntEquals(tc, OE_ERROR_RATE_LIMIT_REACHED, Error);
+#endif // OE_USE_RATE_LIMIT
+}
+
+static void test_singleKernel_sendRequestTo(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_Error_t Error;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* The request and its response are handled like a broadcast request. */
+    Error = sendRequest_1_to(Kernel.KernelID);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 1, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_0);
+    CuAssertIntEquals(tc, TEST_VAL_2, TestParam_1);
+    CuAssertIntEquals(tc, 1, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, TEST_VAL_3, TestParam_2);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* Only existing kernels can be addressed. */
+    Error = sendRequest_1_to(OE_NUMBER_OF_KERNELS);
+    CuAssertIntEquals(tc, OE_ERROR_KERNEL_ID_INVALID, Error);
+    Error = sendRequest_1_to(OE_NO_KERNEL);
+    CuAssertIntEquals(tc, OE_ERROR_KERNEL_ID_INVALID, Error);
+
+    /* Nothing is sent if the kernel does not subscribe the request. */
+    unsubscribeRequest_1();
+    Error = sendRequest_1_to(Kernel.KernelID);
+    CuAssertIntEquals(tc, OE_ERROR_NO_RECEIVER, Error);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+}
+
+#if OE_USE_RATE_LIMIT
+static void test_singleKernel_requestAttributes(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_Error_t Error;
+    int i = 0;
+
+    TestTicks = 0;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);    
+
+    /* Dummy_Request_2 may be sent 3 times per 10 ticks. */
+    while (i++ < 3)
+    {
+        Error = sendRequest_2();
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_RATE_LIMIT_REACHED, Error);
+    CuAssertIntEquals(tc, 3, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* Other requests are not affected. */
+    Error = sendRequest_1();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 4, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* Not a full rate period has passed. */
+    TestTicks = 9;
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_RATE_LIMIT_REACHED, Error);
+
+    /* After one period, the bucket is refilled. The request limit of 5 is reached first. */
+    TestTicks = 10;
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_REQUEST_LIMIT_REACHED, Error);
+    CuAssertIntEquals(tc, 6, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* A request that is not sent does not take a token. */
+    OE_Kernel_runOnce(&Kernel);
+    OE_Kernel_runOnce(&Kernel);
+    OE_Kernel_runOnce(&Kernel);
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_RATE_LIMIT_REACHED, Error);
+
+    /* The tick counter may wrap around. */
+    TestTicks = UINT32_MAX - 4;
+    init(tc, &Kernel);
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    for (i = 0; i < 3; i++)
+    {
+        Error = sendRequest_2();
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_RATE_LIMIT_REACHED, Error);
+
+    TestTicks = 5;
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    TestTicks = 0;
+}
+#endif // OE_USE_RATE_LIMIT
+
+#if OE_USE_OVERLOAD_POLICY
+static void test_singleKernel_overloadPolicy(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_Error_t Error;
+    uint8_t i;
+
+    TestTicks = 0;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* Dummy_Sample drops the oldest sample if its request limit of 2 is reached. */
+    for (i = 1; i <= 4; i++)
+    {
+        Error = req_Dummy_Sample(i);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+    CuAssertIntEquals(tc, 2, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    OE_Kernel_runOnce(&Kernel);
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 3, TestParam_0);
+    CuAssertIntEquals(tc, 4, TestParam_1);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* Dropping a message in the middle of the queue keeps the order of the others. */
+    Error = req_Dummy_Sample(5);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Latest(1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Sample(6);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Sample(7);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 3, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 1, TestParam_2);
+    OE_Kernel_runOnce(&Kernel);
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 6, TestParam_0);
+    CuAssertIntEquals(tc, 7, TestParam_1);
+
+    /* Dummy_Latest overwrites the newest queued value if its request limit of 2 is reached. */
+    for (i = 1; i <= 4; i++)
+    {
+        Error = req_Dummy_Latest(i);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+    CuAssertIntEquals(tc, 2, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 1, TestParam_2);
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 4, TestParam_2);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /**
+     * Dummy_Blocking waits for room until its block timeout of 5 ticks has passed.
+     * The test port advances the ticks each time the sender yields.
+     */
+    TestParam_2 = 0;
+    Error = req_Dummy_Blocking();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = req_Dummy_Blocking();
+    CuAssertIntEquals(tc, OE_ERROR_REQUEST_LIMIT_REACHED, Error);
+    CuAssertIntEquals(tc, 5, TestTicks);
+    CuAssertIntEquals(tc, 1, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* Once the message has been handled, the next request is sent right away. */
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 1, TestParam_2);
+    Error = req_Dummy_Blocking();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 5, TestTicks);
+
+    /* The kernel itself never waits, only it could make room in its queue. */
+    TestCurrentKernel = Kernel.KernelID;
+    Error = req_Dummy_Blocking();
+    CuAssertIntEquals(tc, OE_ERROR_REQUEST_LIMIT_REACHED, Error);
+    CuAssertIntEquals(tc, 5, TestTicks);
+    TestCurrentKernel = OE_NO_KERNEL;
+
+    TestTicks = 0;
+}
+#endif // OE_USE_OVERLOAD_POLICY
+
+#if OE_USE_COALESCING
+static void test_singleKernel_coalescing(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_Error_t Error;
+    uint8_t i;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* Dummy_Status is coalesced without a key. Only the last value is handled. */
+    for (i = 1; i <= 3; i++)
+    {
+        Error = req_Dummy_Status(i);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+    CuAssertIntEquals(tc, 1, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 3, TestParam_2);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* A coalesced request keeps its place in the queue. */
+    Error = req_Dummy_Status(4);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Keyed(1, 10);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Status(5);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 2, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 5, TestParam_2);
+    CuAssertIntEquals(tc, TEST_VAL_MODULE_INIT, TestParam_0);
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 1, TestParam_0);
+    CuAssertIntEquals(tc, 10, TestParam_1);
+
+    /* Dummy_Keyed is only coalesced with a queued request of the same key. */
+    Error = req_Dummy_Keyed(1, 11);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Keyed(2, 20);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Keyed(1, 12);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 2, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 1, TestParam_0);
+    CuAssertIntEquals(tc, 12, TestParam_1);
+    OE_Kernel_runOnce(&Kernel);
+    CuAssertIntEquals(tc, 2, TestParam_0);
+    CuAssertIntEquals(tc, 20, TestParam_1);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+}
+#endif // OE_USE_COALESCING
+
+#if OE_USE_SHARDING
+static void handleRequest_Shard(
+    OE_MessageHeader_t *Header,
+    struct requestArgs_Dummy_Sharded_s *Args)
+{
+    TestParam_2 = Args->Key;
+}
+
+/* Send a sharded request and return the kernel that received it. */
+static OE_KernelID_t sendSharded(uint8_t Key, uint8_t Value)
+{
+    size_t Queued[OE_NUMBER_OF_KERNELS];
+    OE_KernelID_t KernelID;
+
+    for (KernelID = 0; KernelID < OE_NUMBER_OF_KERNELS; KernelID++)
+    {
+        Queued[KernelID] = Core.MessageQueues[KernelID].NumberOfMessages;
+    }
+
+    if (req_Dummy_Sharded(Key, Value) != OE_ERROR_NONE)
+    {
+        return OE_NO_KERNEL;
+    }
+
+    for (KernelID = 0; KernelID < OE_NUMBER_OF_KERNELS; KernelID++)
+    {
+        if (Core.MessageQueues[KernelID].NumberOfMessages != Queued[KernelID])
+        {
+            return KernelID;
+        }
+    }
+
+    return OE_NO_KERNEL;
+}
+
+static void test_singleKernel_sharding(CuTest *tc)
+{
+    OE_Kernel_t Kernel, Kernel_1;
+    module_TestDummy_t TestDummy;
+    OE_RequestID_t RequestID = RID_Dummy_Sharded;
+    OE_MessageHandler_t RequestHandler = (OE_MessageHandler_t)handleRequest_Shard;
+    OE_KernelID_t Shards[16];
+#if OE_USE_REQUEST_FILTERS
+    OE_Kernel_t Kernel_2;
+    OE_RequestFilter_t Filter = OE_REQUEST_FILTER(struct requestArgs_Dummy_Sharded_s, Value, 0xFF, 0xFF);
+    OE_KernelID_t Shard;
+    size_t Moved = 0;
+#endif // OE_USE_REQUEST_FILTERS
+    OE_MessageQueue_t *Queue_0 = &Core.MessageQueues[0];
+    OE_MessageQueue_t *Queue_1 = &Core.MessageQueues[1];
+    OE_MessageHeader_t Headers[2];
+    struct requestArgs_Dummy_Sharded_s Args[2];
+    const void *Parameters[2];
+    size_t Queued_0, Queued_1;
+    OE_Error_t Error;
+    uint8_t Key;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* A second kernel subscribes the request and owns the other shards. */
+    Error = OE_Kernel_staticInit(&Kernel_1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 1, Kernel_1.KernelID);
+
+    Error = OE_Kernel_registerHandlers(&Kernel_1, &RequestID, &RequestHandler, 1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* Each key is sent to one kernel only, and always to the same one. */
+    for (Key = 0; Key < 8; Key++)
+    {
+        Queued_0 = Queue_0->NumberOfMessages;
+        Queued_1 = Queue_1->NumberOfMessages;
+
+        Error = req_Dummy_Sharded(Key, 1);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+        Error = req_Dummy_Sharded(Key, 2);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+        CuAssertIntEquals(tc, Queued_0 + Queued_1 + 2, Queue_0->NumberOfMessages + Queue_1->NumberOfMessages);
+        CuAssertTrue(tc, Queue_0->NumberOfMessages == Queued_0 || Queue_1->NumberOfMessages == Queued_1);
+    }
+
+    /* The keys are spread over both kernels. */
+    CuAssertTrue(tc, Queue_0->NumberOfMessages > 0);
+    CuAssertTrue(tc, Queue_1->NumberOfMessages > 0);
+
+    /* A batch is sharded the same way. */
+    Queued_0 = Queue_0->NumberOfMessages;
+    Queued_1 = Queue_1->NumberOfMessages;
+    for (Key = 0; Key < 2; Key++)
+    {
+        Headers[Key] = (OE_MessageHeader_t){.RequestID = RID_Dummy_Sharded};
+        Args[Key] = (struct requestArgs_Dummy_Sharded_s){Key, 3};
+        Parameters[Key] = &Args[Key];
+    }
+    Error = OE_Core_sendRequests(Headers, Parameters, 2);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, Queued_0 + Queued_1 + 2, Queue_0->NumberOfMessages + Queue_1->NumberOfMessages);
+
+    /* A unicast request ignores the shard key. */
+    Queued_0 = Queue_0->NumberOfMessages;
+    Queued_1 = Queue_1->NumberOfMessages;
+    for (Key = 0; Key < 2; Key++)
+    {
+        Error = OE_Core_sendRequestTo(Key, &Headers[0], Parameters[0]);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+    CuAssertIntEquals(tc, Queued_0 + 1, Queue_0->NumberOfMessages);
+    CuAssertIntEquals(tc, Queued_1 + 1, Queue_1->NumberOfMessages);
+
+    for (Key = 0; Key < 16; Key++)
+    {
+        Shards[Key] = sendSharded(Key, 5);
+        CuAssertTrue(tc, Shards[Key] != OE_NO_KERNEL);
+    }
+
+#if OE_USE_REQUEST_FILTERS
+    /* A kernel whose filter rejects the request is not a shard. Its keys are not lost. */
+    Error = OE_Kernel_staticInit(&Kernel_2);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = OE_Kernel_registerFilteredHandlers(&Kernel_2, &RequestID, &RequestHandler, &Filter, 1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    for (Key = 0; Key < 16; Key++)
+    {
+        CuAssertIntEquals(tc, Shards[Key], sendSharded(Key, 6));
+    }
+
+    /* Once it accepts the request, only keys move to it. */
+    OE_Kernel_unregisterHandlers(&Kernel_2, &RequestID, &RequestHandler, 1);
+    Error = OE_Kernel_registerHandlers(&Kernel_2, &RequestID, &RequestHandler, 1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    for (Key = 0; Key < 16; Key++)
+    {
+        Shard = sendSharded(Key, 7);
+        CuAssertTrue(tc, Shard == Shards[Key] || Shard == Kernel_2.KernelID);
+        Moved += (Shard == Kernel_2.KernelID);
+    }
+    CuAssertTrue(tc, Moved > 0);
+    OE_Kernel_unregisterHandlers(&Kernel_2, &RequestID, &RequestHandler, 1);
+#endif // OE_USE_REQUEST_FILTERS
+
+    /* Without the second subscriber, all keys go to the first kernel. */
+    OE_Kernel_unregisterHandlers(&Kernel_1, &RequestID, &RequestHandler, 1);
+    Queued_1 = Queue_1->NumberOfMessages;
+    for (Key = 0; Key < 8; Key++)
+    {
+        Error = req_Dummy_Sharded(Key, 4);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+    CuAssertIntEquals(tc, Queued_1, Queue_1->NumberOfMessages);
+}
+#endif // OE_USE_SHARDING
+
+#if OE_USE_REQUEST_FILTERS
+static uint8_t KeyHandlerCalls, ValueHandlerCalls;
+
+static void handleRequest_KeyFiltered(
+    OE_MessageHeader_t *Header,
+    struct requestArgs_Dummy_Keyed_s *Args)
+{
+    KeyHandlerCalls++;
+}
+
+static void handleRequest_ValueFiltered(
+    OE_MessageHeader_t *Header,
+    struct requestArgs_Dummy_Keyed_s *Args)
+{
+    ValueHandlerCalls++;
+}
+
+static void test_singleKernel_requestFilters(CuTest *tc)
+{
+    OE_Kernel_t Kernel, Kernel_1;
+    module_TestDummy_t TestDummy;
+    OE_RequestID_t RequestIDs[2] = {RID_Dummy_Keyed, RID_Dummy_Keyed};
+    OE_MessageHandler_t RequestHandlers[2] = {
+        (OE_MessageHandler_t)handleRequest_KeyFiltered,
+        (OE_MessageHandler_t)handleRequest_ValueFiltered};
+    OE_RequestFilter_t Filters[2] = {
+        OE_REQUEST_FILTER(struct requestArgs_Dummy_Keyed_s, Key, 0xFF, 1),
+        OE_REQUEST_FILTER(struct requestArgs_Dummy_Keyed_s, Value, 0xF0, 0x20)};
+    OE_MessageQueue_t *Queue_1 = &Core.MessageQueues[1];
+    OE_Error_t Error;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = OE_Kernel_staticInit(&Kernel_1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = OE_Kernel_registerFilteredHandlers(&Kernel_1, RequestIDs, RequestHandlers, Filters, 2);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* Requests that no filter matches are not queued in the second kernel. */
+    KeyHandlerCalls = 0;
+    ValueHandlerCalls = 0;
+    Error = req_Dummy_Keyed(3, 0x10);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 0, Queue_1->NumberOfMessages);
+    CuAssertIntEquals(tc, 1, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* A unicast request that no filter of the kernel matches is an error. */
+    Error = OE_Core_sendRequestTo(
+        Kernel_1.KernelID,
+        &(OE_MessageHeader_t){.RequestID = RID_Dummy_Keyed},
+        &(struct requestArgs_Dummy_Keyed_s){.Key = 3, .Value = 0x10});
+    CuAssertIntEquals(tc, OE_ERROR_NO_RECEIVER, Error);
+    CuAssertIntEquals(tc, 0, Queue_1->NumberOfMessages);
+
+    /* Only the handlers whose filter matches are called. */
+    Error = req_Dummy_Keyed(1, 0x10);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Keyed(4, 0x2F);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Keyed(5, 0x31);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 2, Queue_1->NumberOfMessages);
+
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel_1));
+    CuAssertIntEquals(tc, 1, KeyHandlerCalls);
+    CuAssertIntEquals(tc, 0, ValueHandlerCalls);
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel_1));
+    CuAssertIntEquals(tc, 1, KeyHandlerCalls);
+    CuAssertIntEquals(tc, 1, ValueHandlerCalls);
+
+    /* The filters are updated when a handler is unregistered. */
+    OE_Kernel_unregisterHandlers(&Kernel_1, RequestIDs, RequestHandlers, 1);
+    Error = req_Dummy_Keyed(1, 0x10);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 0, Queue_1->NumberOfMessages);
+
+    /* A handler without a filter takes every request. */
+    Error = OE_Kernel_registerHandlers(&Kernel_1, RequestIDs, RequestHandlers, 1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Keyed(3, 0x10);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 1, Queue_1->NumberOfMessages);
+
+    /* Filters have to fit into the message data. */
+    OE_Kernel_unregisterHandlers(&Kernel_1, RequestIDs, RequestHandlers, 2);
+    Filters[0].Offset = OE_MESSAGE_DATA_SIZE;
+    Error = OE_Kernel_registerFilteredHandlers(&Kernel_1, RequestIDs, RequestHandlers, Filters, 1);
+    CuAssertIntEquals(tc, OE_ERROR_PARAMETER_INVALID, Error);
+    Filters[0].Offset = 0;
+    Filters[0].Size = 3;
+    Error = OE_Kernel_registerFilteredHandlers(&Kernel_1, RequestIDs, RequestHandlers, Filters, 1);
+    CuAssertIntEquals(tc, OE_ERROR_PARAMETER_INVALID, Error);
+    CuAssertTrue(tc, !OE_Kernel_handlerRegistered(&Kernel_1, RID_Dummy_Keyed));
+}
+#endif // OE_USE_REQUEST_FILTERS
+
+static OE_Kernel_t *DispatchKernel;
+static uint8_t DispatchCalls[3];
+
+static void handleRequest_Dispatch_1(void);
+
+static void handleRequest_Dispatch_0(void)
+{
+    OE_RequestID_t RequestID = RID_Dummy_Keyed;
+    OE_MessageHandler_t RequestHandler = (OE_MessageHandler_t)handleRequest_Dispatch_1;
+
+    DispatchCalls[0]++;
+
+    /* Remove the next handler while the kernel dispatches the request. */
+    OE_Kernel_unregisterHandlers(DispatchKernel, &RequestID, &RequestHandler, 1);
+}
+
+static void handleRequest_Dispatch_1(void)
+{
+    DispatchCalls[1]++;
+}
+
+static void handleRequest_Dispatch_2(void)
+{
+    DispatchCalls[2]++;
+}
+
+static void test_singleKernel_registerDuringDispatch(CuTest *tc)
+{
+    OE_Kernel_t Kernel, Kernel_1;
+    module_TestDummy_t TestDummy;
+    OE_RequestID_t RequestIDs[3] = {RID_Dummy_Keyed, RID_Dummy_Keyed, RID_Dummy_Keyed};
+    OE_MessageHandler_t RequestHandlers[3] = {
+        (OE_MessageHandler_t)handleRequest_Dispatch_0,
+        (OE_MessageHandler_t)handleRequest_Dispatch_1,
+        (OE_MessageHandler_t)handleRequest_Dispatch_2};
+    OE_Error_t Error;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = OE_Kernel_staticInit(&Kernel_1);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    DispatchKernel = &Kernel_1;
+
+    Error = OE_Kernel_registerHandlers(&Kernel_1, RequestIDs, RequestHandlers, 3);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* An idle kernel does not hold up a writer. */
+    CuAssertIntEquals(tc, 0, Kernel_1.Epoch & 1);
+    OE_Kernel_synchronize(&Kernel_1);
+
+    memset(DispatchCalls, 0, sizeof(DispatchCalls));
+    Error = req_Dummy_Keyed(1, 2);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = req_Dummy_Keyed(3, 4);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* The running dispatch still calls the removed handler and skips none. */
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel_1));
+    CuAssertIntEquals(tc, 1, DispatchCalls[0]);
+    CuAssertIntEquals(tc, 1, DispatchCalls[1]);
+    CuAssertIntEquals(tc, 1, DispatchCalls[2]);
+    CuAssertIntEquals(tc, 2, Kernel_1.RequestMap.MapNodes[RID_Dummy_Keyed].NumberOfHandlers);
+
+    /* The next dispatch uses the new handlers. */
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel_1));
+    CuAssertIntEquals(tc, 2, DispatchCalls[0]);
+    CuAssertIntEquals(tc, 1, DispatchCalls[1]);
+    CuAssertIntEquals(tc, 2, DispatchCalls[2]);
+
+    /* The kernel is inside a message until it asks for the next one. */
+    CuAssertIntEquals(tc, 1, Kernel_1.Epoch & 1);
+    CuAssertTrue(tc, !OE_Kernel_runOnce(&Kernel_1));
+    CuAssertIntEquals(tc, 0, Kernel_1.Epoch & 1);
+    OE_Kernel_synchronize(&Kernel_1);
+
+    /* Every change of a map node is counted twice. */
+    CuAssertIntEquals(tc, 8, Kernel_1.RequestMap.MapNodes[RID_Dummy_Keyed].Sequence);
+
+    OE_Kernel_unregisterHandlers(&Kernel_1, RequestIDs, RequestHandlers, 3);
+    CuAssertTrue(tc, !OE_Kernel_handlerRegistered(&Kernel_1, RID_Dummy_Keyed));
+}
+
+#if OE_USE_ISR_SEND
+static OE_Error_t sendKeyedFromISR(size_t SourceID, uint8_t Key)
+{
+    OE_MessageHeader_t Header = {
+        .RequestID = RID_Dummy_Keyed,
+    };
+
+    return OE_Core_sendRequestFromISR(
+        SourceID,
+        &Header,
+        &(struct requestArgs_Dummy_Keyed_s){
+            Key,
+            Key,
+        });
+}
+
+static void test_singleKernel_sendRequestFromISR(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_MessageHeader_t Header = {
+        .RequestID = RID_Dummy_Blocking,
+    };
+    OE_Error_t Error;
+    uint8_t i;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = sendKeyedFromISR(OE_NUMBER_OF_ISR_SOURCES, 1);
+    CuAssertIntEquals(tc, OE_ERROR_PARAMETER_INVALID, Error);
+
+    /* The requests are staged until the kernel gets its next message. */
+    for (i = 1; i <= OE_STAGING_RING_LENGTH; i++)
+    {
+        Error = sendKeyedFromISR(0, i);
+        CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    }
+
+    Error = sendKeyedFromISR(0, i);
+    CuAssertIntEquals(tc, OE_ERROR_MESSAGE_QUEUE_FULL, Error);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    /* Each source has its own ring. */
+    Error = sendKeyedFromISR(1, i);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* The requests of one source are delivered in order. */
+    for (i = 1; i <= OE_STAGING_RING_LENGTH + 1; i++)
+    {
+        CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+        CuAssertIntEquals(tc, i, TestParam_0);
+    }
+    CuAssertTrue(tc, !OE_Kernel_runOnce(&Kernel));
+
+    /**
+     * Dummy_Blocking has a request limit of 1. The second request stays staged
+     * until the first one has been handled. The request behind it has to wait.
+     */
+    TestParam_2 = 0;
+    Error = OE_Core_sendRequestFromISR(0, &Header, NULL);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = OE_Core_sendRequestFromISR(0, &Header, NULL);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    Error = sendKeyedFromISR(0, 10);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 1, TestParam_2);
+    CuAssertIntEquals(tc, 0, Kernel.Core->MessageQueues[Kernel.KernelID].NumberOfMessages);
+
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 2, TestParam_2);
+    CuAssertTrue(tc, OE_Kernel_runOnce(&Kernel));
+    CuAssertIntEquals(tc, 10, TestParam_0);
+    CuAssertTrue(tc, !OE_Kernel_runOnce(&Kernel));
+}
+#endif // OE_USE_ISR_SEND
+
+#if OE_USE_MESSAGE_STATISTICS
+static void countStatistics(
+    OE_KernelID_t SenderID,
+    OE_RequestID_t RequestID,
+    OE_KernelID_t ReceiverID,
+    const OE_MessageStatistics_t *Statistics,
+    void *Context)
+{
+    (void)SenderID;
+    (void)RequestID;
+    (void)ReceiverID;
+    (void)Statistics;
+
+    (*(int*)Context)++;
+}
+
+static void test_singleKernel_messageStatistics(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+    OE_MessageStatistics_t Statistics;
+    OE_Error_t Error;
+    int Entries = 0;
+
+    init(tc, &Kernel);
+
+    Error = initModule_TestDummy(
+        &TestDummy,
+        NULL,
+        &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    /* Request 1 is sent from kernel 0 and answered with a response. */
+    Error = sendRequest_1();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    OE_Kernel_runOnce(&Kernel);
+    OE_Kernel_runOnce(&Kernel);
+
+    Error = OE_Core_getMessageStatistics(0, RID_Dummy_Request_1, 0, &Statistics);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 1, Statistics.Requests);
+    CuAssertIntEquals(tc, 1, Statistics.Responses);
+    CuAssertIntEquals(tc, 2 * OE_MESSAGE_DATA_SIZE, Statistics.Bytes);
+
+    /* Request 2 carries no kernel ID, so the sender is unknown. */
+    Error = sendRequest_2();
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+
+    Error = OE_Core_getMessageStatistics(OE_NO_KERNEL, RID_Dummy_Request_2, 0, &Statistics);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Error);
+    CuAssertIntEquals(tc, 1, Statistics.Requests);
+    CuAssertIntEquals(tc, 0, Statistics.Responses);
+    CuAssertIntEquals(tc, 0, Statistics.Bytes);
+
+    /* Invalid IDs should return an error. */
+    Error = OE_Core_getMessageStatistics(0, OE_NUMBER_OF_REQUESTS, 0, &Statistics);
+    CuAssertIntEquals(tc, OE_ERROR_REQUEST_ID_INVALID, Error);
+    Error = OE_Core_getMessageStatistics(0, RID_Dummy_Request_1, OE_NUMBER_OF_KERNELS, &Statistics);
+    CuAssertIntEquals(tc, OE_ERROR_KERNEL_ID_INVALID, Error);
+
+    /* Only the two used entries should be exported. */
+    OE_Core_exportMessageStatistics(countStatistics, &Entries);
+    CuAssertIntEquals(tc, 2, Entries);
+
+    /* Nothing should be exported after a reset. */
+    Entries = 0;
+    OE_Core_resetMessageStatistics();
+    OE_Core_exportMessageStatistics(countStatistics, &Entries);
+    CuAssertIntEquals(tc, 0, Entries);
+}
+#endif // OE_USE_MESSAGE_STATISTICS
+
 void add_singleKernel(CuSuite *suite)
 {
     SUITE_ADD_TEST(suite, test_singleKernel_staticInit);
@@ -232,4 +1105,28 @@ void add_singleKernel(CuSuite *suite)
     SUITE_ADD_TEST(suite, test_singleKernel_subscribeRequest);
     //SUITE_ADD_TEST(suite, test_singleKernel_messageQueueFull);
     SUITE_ADD_TEST(suite, test_singleKernel_requestLimitReached);
+    SUITE_ADD_TEST(suite, test_singleKernel_sendRequests);
+    SUITE_ADD_TEST(suite, test_singleKernel_sendRequestTo);
+#if OE_USE_RATE_LIMIT
+    SUITE_ADD_TEST(suite, test_singleKernel_requestAttributes);
+#endif // OE_USE_RATE_LIMIT
+#if OE_USE_OVERLOAD_POLICY
+    SUITE_ADD_TEST(suite, test_singleKernel_overloadPolicy);
+#endif // OE_USE_OVERLOAD_POLICY
+#if OE_USE_COALESCING
+    SUITE_ADD_TEST(suite, test_singleKernel_coalescing);
+#endif // OE_USE_COALESCING
+#if OE_USE_SHARDING
+    SUITE_ADD_TEST(suite, test_singleKernel_sharding);
+#endif // OE_USE_SHARDING
+#if OE_USE_REQUEST_FILTERS
+    SUITE_ADD_TEST(suite, test_singleKernel_requestFilters);
+#endif // OE_USE_REQUEST_FILTERS
+    SUITE_ADD_TEST(suite, test_singleKernel_registerDuringDispatch);
+#if OE_USE_ISR_SEND
+    SUITE_ADD_TEST(suite, test_singleKernel_sendRequestFromISR);
+#endif // OE_USE_ISR_SEND
+#if OE_USE_MESSAGE_STATISTICS
+    SUITE_ADD_TEST(suite, test_singleKernel_messageStatistics);
+#endif // OE_USE_MESSAGE_STATISTICS
 }
\ No newline at end of file
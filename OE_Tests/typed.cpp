@@ -0,0 +1,144 @@
+extern "C" {
+#include "oe_test.h"
+
+/* Modules */
+#include "test_dummy_intf.h"
+#include "test_dummy_mod.h"
+}
+
+/* OpenEDOS core */
+#include "oe_typed.hpp"
+
+static OE_Core_t Core;
+
+using Request_1 = OE::Request<
+    RID_Dummy_Request_1,
+    requestArgs_Dummy_Request_1_s,
+    responseArgs_Dummy_Request_1_s>;
+
+using Request_2 = OE::Request<RID_Dummy_Request_2>;
+
+using Sample = OE::Request<RID_Dummy_Sample, requestArgs_Dummy_Sample_s>;
+
+static_assert(Request_1::RequestSize == 2);
+static_assert(Request_1::ResponseSize == 1);
+static_assert(Request_1::HasResponse && !Request_2::HasResponse);
+static_assert(Request_2::RequestSize == 0 && !Request_2::HasRequestArgs);
+
+static uint8_t Responses[2];
+static size_t NumberOfResponses;
+static size_t NumberOfRequests_2;
+
+static void handleResponse(
+    OE_MessageHeader_t *Header,
+    responseArgs_Dummy_Request_1_s *Args)
+{
+    (void)Header;
+    Responses[NumberOfResponses++] = Args->Dummy_Response_Param_1;
+}
+
+static void handleRequest_1(
+    OE_MessageHeader_t *Header,
+    requestArgs_Dummy_Request_1_s *Args)
+{
+    TestParam_0 = Args->Dummy_Request_Param_1;
+    TestParam_1 = Args->Dummy_Request_Param_2;
+
+    OE::respond<Request_1>(Header, {TEST_VAL_2});
+}
+
+static void handleRequest_2(
+    OE_MessageHeader_t *Header)
+{
+    (void)Header;
+    NumberOfRequests_2++;
+}
+
+static void handleSample(
+    OE_MessageHeader_t *Header,
+    requestArgs_Dummy_Sample_s *Args)
+{
+    (void)Header;
+    TestParam_2 = Args->Value;
+}
+
+using Handlers = OE::HandlerTable<
+    OE::On<Request_1, handleRequest_1>,
+    OE::On<Request_2, handleRequest_2>,
+    OE::On<Sample, handleSample>>;
+
+static void init(CuTest *tc, OE_Kernel_t *Kernel)
+{
+    memset(Responses, 0, sizeof(Responses));
+    NumberOfResponses = 0;
+    NumberOfRequests_2 = 0;
+    TestParam_0 = TEST_VAL_TEST_BEGIN;
+    TestParam_1 = TEST_VAL_TEST_BEGIN;
+    TestParam_2 = TEST_VAL_TEST_BEGIN;
+
+    initModule_OE_Core(&Core, NULL, NULL);
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE_Kernel_staticInit(Kernel));
+}
+
+static void test_typed_send(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+    module_TestDummy_t TestDummy;
+
+    init(tc, &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, initModule_TestDummy(&TestDummy, NULL, &Kernel));
+
+    /* The C handler of the TestDummy takes the typed request. */
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE::send<Request_1>({TEST_VAL_1, TEST_VAL_2}, handleResponse, Kernel.KernelID));
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE::sendTo<Request_1>(Kernel.KernelID, {TEST_VAL_2, TEST_VAL_1}, handleResponse, Kernel.KernelID));
+
+    while (OE_Kernel_runOnce(&Kernel));
+
+    CuAssertIntEquals(tc, TEST_VAL_2, TestParam_0);
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_1);
+    CuAssertIntEquals(tc, 2, NumberOfResponses);
+    CuAssertIntEquals(tc, TEST_VAL_3, Responses[0]);
+    CuAssertIntEquals(tc, TEST_VAL_3, Responses[1]);
+
+    CuAssertIntEquals(tc, OE_ERROR_KERNEL_ID_INVALID,
+        OE::sendTo<Sample>(OE_NUMBER_OF_KERNELS, {TEST_VAL_1}));
+}
+
+static void test_typed_handlerTable(CuTest *tc)
+{
+    OE_Kernel_t Kernel;
+
+    init(tc, &Kernel);
+    CuAssertIntEquals(tc, OE_ERROR_NONE, Handlers::registerAt(&Kernel));
+
+    CuAssertIntEquals(tc, OE_ERROR_NONE,
+        OE::send<Request_1>({TEST_VAL_3, TEST_VAL_1}, handleResponse, Kernel.KernelID));
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE::send<Request_2>());
+    CuAssertIntEquals(tc, OE_ERROR_NONE, OE::send<Sample>({TEST_VAL_3}));
+
+    while (OE_Kernel_runOnce(&Kernel));
+
+    CuAssertIntEquals(tc, TEST_VAL_3, TestParam_0);
+    CuAssertIntEquals(tc, TEST_VAL_1, TestParam_1);
+    CuAssertIntEquals(tc, TEST_VAL_3, TestParam_2);
+    CuAssertIntEquals(tc, 1, NumberOfRequests_2);
+    CuAssertIntEquals(tc, 1, NumberOfResponses);
+    CuAssertIntEquals(tc, TEST_VAL_2, Responses[0]);
+
+    /* Unregistered handlers are not called anymore. */
+    Handlers::unregisterAt(&Kernel);
+
+    OE::send<Request_2>();
+    while (OE_Kernel_runOnce(&Kernel));
+
+    CuAssertIntEquals(tc, 1, NumberOfRequests_2);
+}
+
+void add_typed(CuSuite *suite)
+{
+    SUITE_ADD_TEST(suite, test_typed_send);
+    SUITE_ADD_TEST(suite, test_typed_handlerTable);
+}
@@ -0,0 +1,163 @@
+#include "oe_test.h"
+
+/* OpenEDOS core */
+#include "oe_wire.h"
+
+/* Modules */
+#include "oe_all_modules.h"
+#include "test_dummy_intf.h"
+
+#if OE_USE_WIRE_FORMAT
+static const OE_WireCodec_t Codecs[OE_NUMBER_OF_REQUESTS] = OE_REQUEST_CODECS;
+
+static void test_wire_requestArgs(CuTest *tc)
+{
+    struct requestArgs_Dummy_Wire_s Args = {
+        .Count = 300,
+        .Offset = -2,
+        .Enabled = true,
+    };
+    struct requestArgs_Dummy_Wire_s Decoded = {0};
+    uint8_t Buffer[OE_WIRE_DATA_LIMIT];
+    const uint8_t Expected[] = {0xAC, 0x02, 0x03, 0x01};
+    size_t Length;
+
+    /* The varints take 2 and 1 bytes, the flag takes 1 byte. */
+    Length = encodeRequest_Dummy_Wire(&Args, Buffer);
+    CuAssertIntEquals(tc, sizeof(Expected), Length);
+    CuAssertTrue(tc, memcmp(Buffer, Expected, sizeof(Expected)) == 0);
+
+    Length = decodeRequest_Dummy_Wire(&Decoded, Buffer, Length);
+    CuAssertIntEquals(tc, sizeof(Expected), Length);
+    CuAssertIntEquals(tc, Args.Count, Decoded.Count);
+    CuAssertIntEquals(tc, Args.Offset, Decoded.Offset);
+    CuAssertTrue(tc, Decoded.Enabled);
+
+    /* A truncated buffer is rejected. */
+    Length = decodeRequest_Dummy_Wire(&Decoded, Buffer, sizeof(Expected) - 1);
+    CuAssertIntEquals(tc, 0, Length);
+
+    /* The offset does not fit into an int16_t. */
+    Buffer[2] = 0x80;
+    Buffer[3] = 0x80;
+    Buffer[4] = 0x04;
+    Length = decodeRequest_Dummy_Wire(&Decoded, Buffer, 6);
+    CuAssertIntEquals(tc, 0, Length);
+}
+
+static void test_wire_responseArgs(CuTest *tc)
+{
+    struct responseArgs_Dummy_Wire_s Args = {.Ratio = -0.75f};
+    struct responseArgs_Dummy_Wire_s Decoded = {0};
+    struct responseArgs_Dummy_Request_1_s Response = {.Dummy_Response_Param_1 = 0xA5};
+    uint8_t Buffer[OE_WIRE_DATA_LIMIT];
+    size_t Length;
+
+    Length = encodeResponse_Dummy_Wire(&Args, Buffer);
+    CuAssertIntEquals(tc, 4, Length);
+
+    /* The IEEE 754 bit pattern of -0.75 is 0xBF400000. */
+    CuAssertIntEquals(tc, 0x00, Buffer[0]);
+    CuAssertIntEquals(tc, 0x00, Buffer[1]);
+    CuAssertIntEquals(tc, 0x40, Buffer[2]);
+    CuAssertIntEquals(tc, 0xBF, Buffer[3]);
+
+    Length = decodeResponse_Dummy_Wire(&Decoded, Buffer, Length);
+    CuAssertIntEquals(tc, 4, Length);
+    CuAssertTrue(tc, Decoded.Ratio == Args.Ratio);
+
+    Length = encodeResponse_Dummy_Request_1(&Response, Buffer);
+    CuAssertIntEquals(tc, 1, Length);
+    CuAssertIntEquals(tc, 0xA5, Buffer[0]);
+}
+
+static void test_wire_plainIntegers(CuTest *tc)
+{
+    struct requestArgs_Dummy_Ready_s Args = {
+        .File = -2,
+        .Events = 7,
+    };
+    struct requestArgs_Dummy_Ready_s Decoded = {0};
+    uint8_t Buffer[OE_WIRE_DATA_LIMIT];
+    const uint8_t Expected[] = {0xFE, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00};
+    size_t Length;
+
+    /* An int is written with 4 bytes in little endian, whatever its native size is. */
+    Length = encodeRequest_Dummy_Ready(&Args, Buffer);
+    CuAssertIntEquals(tc, sizeof(Expected), Length);
+    CuAssertTrue(tc, memcmp(Buffer, Expected, sizeof(Expected)) == 0);
+
+    Length = decodeRequest_Dummy_Ready(&Decoded, Buffer, Length);
+    CuAssertIntEquals(tc, sizeof(Expected), Length);
+    CuAssertIntEquals(tc, Args.File, Decoded.File);
+    CuAssertIntEquals(tc, Args.Events, Decoded.Events);
+}
+
+static void test_wire_varint(CuTest *tc)
+{
+    const int64_t Values[] = {0, -1, 1, INT64_MIN, INT64_MAX};
+    uint8_t Buffer[16];
+    size_t Offset = 0;
+    uint64_t Value;
+
+    /* A 64 bit value takes up to 10 bytes. */
+    OE_Wire_writeVarint(Buffer, &Offset, UINT64_MAX);
+    CuAssertIntEquals(tc, 10, Offset);
+
+    Offset = 0;
+    CuAssertTrue(tc, OE_Wire_readVarint(Buffer, 10, &Offset, 8, &Value));
+    CuAssertTrue(tc, Value == UINT64_MAX);
+    CuAssertIntEquals(tc, 10, Offset);
+
+    /* The value does not fit into 4 bytes. */
+    Offset = 0;
+    CuAssertTrue(tc, !OE_Wire_readVarint(Buffer, 10, &Offset, 4, &Value));
+    CuAssertIntEquals(tc, 0, Offset);
+
+    /* More than 10 bytes are never read. */
+    memset(Buffer, 0x80, sizeof(Buffer));
+    Offset = 0;
+    CuAssertTrue(tc, !OE_Wire_readVarint(Buffer, sizeof(Buffer), &Offset, 8, &Value));
+
+    for (size_t Index = 0; Index < sizeof(Values) / sizeof(Values[0]); Index++)
+    {
+        CuAssertTrue(tc, OE_Wire_unzigzag(OE_Wire_zigzag(Values[Index])) == Values[Index]);
+    }
+
+    /* Small negative values stay small. */
+    CuAssertTrue(tc, OE_Wire_zigzag(-1) == 1);
+    CuAssertTrue(tc, OE_Wire_zigzag(-64) == 127);
+}
+
+static void test_wire_codecs(CuTest *tc)
+{
+    uint8_t Buffer[OE_WIRE_DATA_LIMIT];
+    size_t Length;
+
+    /* Requests without parameters have no codec. */
+    CuAssertTrue(tc, Codecs[RID_Dummy_Request_2].EncodeRequest == NULL);
+    CuAssertTrue(tc, Codecs[RID_Dummy_Sample].EncodeResponse == NULL);
+
+    CuAssertTrue(tc, Codecs[RID_Dummy_Wire].EncodeRequest != NULL);
+    CuAssertTrue(tc, Codecs[RID_Dummy_Wire].DecodeResponse != NULL);
+
+    Length = Codecs[RID_Dummy_Sample].EncodeRequest(
+        &(struct requestArgs_Dummy_Sample_s){TEST_VAL_3},
+        Buffer);
+    CuAssertIntEquals(tc, 1, Length);
+    CuAssertIntEquals(tc, TEST_VAL_3, Buffer[0]);
+}
+#endif // OE_USE_WIRE_FORMAT
+
+void add_wire(CuSuite *suite)
+{
+#if OE_USE_WIRE_FORMAT
+    SUITE_ADD_TEST(suite, test_wire_requestArgs);
+    SUITE_ADD_TEST(suite, test_wire_responseArgs);
+    SUITE_ADD_TEST(suite, test_wire_plainIntegers);
+    SUITE_ADD_TEST(suite, test_wire_varint);
+    SUITE_ADD_TEST(suite, test_wire_codecs);
+#else
+    (void)suite;
+#endif // OE_USE_WIRE_FORMAT
+}